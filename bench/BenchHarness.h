@@ -0,0 +1,339 @@
+/**
+ * @file BenchHarness.h
+ * @brief Minimal Google Benchmark-style microbenchmark harness
+ * @author AI-Enhanced Development System
+ *
+ * Usage:
+ * @code
+ * static void BM_Something(bench::State& state) {
+ *     for (auto _ : state) { ... }
+ *     state.setItemsProcessed(state.iterations() * itemsPerIteration);
+ *     state.setRealTimeRate(44100);   // optional: also report items/s as a multiple of real time
+ * }
+ * BENCHMARK(BM_Something);
+ * BENCH_MAIN();
+ * @endcode
+ *
+ * Command line (flag names follow Google Benchmark):
+ *   --benchmark_filter=TEXT     run only benchmarks whose name contains TEXT
+ *   --benchmark_min_time=SEC    measure each benchmark for at least SEC seconds
+ *   --benchmark_repetitions=N   measure N times and report the fastest
+ *   --benchmark_out=FILE        also write the results to FILE as JSON
+ */
+
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bench {
+
+/**
+ * @brief Prevent the compiler from optimizing away a value
+ * @param value Value that must be materialized
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Per-run benchmark state; iterate it with a range-for loop
+ *
+ * Only the loop is timed, so setup before it (including lazily built
+ * fixtures) does not count towards the result.
+ */
+class State {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t maxIterations;     ///< Iterations requested for this run
+    uint64_t itemsProcessed;    ///< Items reported by the benchmark body
+    double realTimeRate;        ///< Items per second needed for real time (0 if not applicable)
+    Clock::time_point loopStart;    ///< When the loop began
+    Clock::time_point loopEnd;      ///< When the loop finished
+    bool finished;              ///< Whether the loop ran to completion
+
+    void finish() {
+        loopEnd = Clock::now();
+        finished = true;
+    }
+
+public:
+    /**
+     * @brief Iterator counting down the requested iterations
+     */
+    struct Iterator {
+        /// Non-trivial so `for (auto _ : state)` does not warn about an unused variable
+        struct Value {
+            Value() {}
+            ~Value() {}
+        };
+        uint64_t remaining;     ///< Iterations left
+        State* state;           ///< Stopped when the loop ends
+        bool operator!=(const Iterator&) const {
+            if (remaining != 0) return true;
+            state->finish();
+            return false;
+        }
+        void operator++() { --remaining; }
+        Value operator*() const { return Value(); }
+    };
+
+    explicit State(uint64_t iterations)
+        : maxIterations(iterations), itemsProcessed(0), realTimeRate(0.0), finished(false) {}
+
+    Iterator begin() {
+        loopStart = Clock::now();
+        return Iterator{maxIterations, this};
+    }
+    Iterator end() { return Iterator{0, nullptr}; }
+
+    uint64_t iterations() const { return maxIterations; }
+    void setItemsProcessed(uint64_t items) { itemsProcessed = items; }
+    uint64_t getItemsProcessed() const { return itemsProcessed; }
+    void setRealTimeRate(double itemsPerSecond) { realTimeRate = itemsPerSecond; }
+    double getRealTimeRate() const { return realTimeRate; }
+
+    /**
+     * @brief Wall time of the timed loop
+     * @param fallback Seconds to report if the loop did not run to completion
+     * @return Seconds
+     */
+    double loopSeconds(double fallback) const {
+        return finished ? std::chrono::duration<double>(loopEnd - loopStart).count() : fallback;
+    }
+};
+
+/**
+ * @brief Result of one benchmark
+ */
+struct Result {
+    std::string name;           ///< Benchmark name
+    uint64_t iterations;        ///< Iterations in the measured run
+    double nsPerIteration;      ///< Wall time per iteration in nanoseconds
+    double itemsPerSecond;      ///< Reported items per second (0 if not reported)
+    double realTimeFactor;      ///< itemsPerSecond over the real-time rate (0 if not reported)
+};
+
+using BenchmarkFunction = std::function<void(State&)>;
+
+/**
+ * @brief Global benchmark registry
+ * @return Registered (name, function) pairs
+ */
+inline std::vector<std::pair<std::string, BenchmarkFunction>>& registry() {
+    static std::vector<std::pair<std::string, BenchmarkFunction>> benchmarks;
+    return benchmarks;
+}
+
+/**
+ * @brief Registers a benchmark at static-initialization time
+ */
+struct Registrar {
+    Registrar(const char* name, BenchmarkFunction fn) {
+        registry().emplace_back(name, std::move(fn));
+    }
+};
+
+/**
+ * @brief Time one call of a benchmark
+ * @param name Benchmark name
+ * @param fn Benchmark body
+ * @param iterations Loop iterations
+ * @return Measured result
+ */
+inline Result measure(const std::string& name, const BenchmarkFunction& fn, uint64_t iterations) {
+    State state(iterations);
+    auto start = std::chrono::steady_clock::now();
+    fn(state);
+    double seconds = state.loopSeconds(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    double items = static_cast<double>(state.getItemsProcessed());
+    double itemsPerSecond = items > 0 && seconds > 0 ? items / seconds : 0.0;
+    double rate = state.getRealTimeRate();
+    return Result{name, iterations, seconds * 1e9 / static_cast<double>(iterations),
+                  itemsPerSecond, rate > 0 ? itemsPerSecond / rate : 0.0};
+}
+
+/**
+ * @brief Run one benchmark, growing the iteration count until it runs long enough
+ *
+ * Further repetitions reuse that iteration count; the fastest is kept, as
+ * interference from other processes only ever adds time.
+ * @param name Benchmark name
+ * @param fn Benchmark body
+ * @param minSeconds Minimum measured wall time
+ * @param repetitions Measured runs
+ * @return Fastest measured result
+ */
+inline Result run(const std::string& name, const BenchmarkFunction& fn, double minSeconds = 0.2,
+                  int repetitions = 1) {
+    uint64_t iterations = 1;
+    while (true) {
+        Result result = measure(name, fn, iterations);
+        double seconds = result.nsPerIteration * static_cast<double>(iterations) / 1e9;
+        if (seconds >= minSeconds || iterations >= (1ull << 40)) {
+            for (int i = 1; i < repetitions; ++i) {
+                Result again = measure(name, fn, iterations);
+                if (again.nsPerIteration < result.nsPerIteration) result = again;
+            }
+            return result;
+        }
+        // Aim slightly past the target so the next run is usually the last
+        double scale = seconds > 0 ? (minSeconds * 1.4) / seconds : 10.0;
+        uint64_t next = static_cast<uint64_t>(static_cast<double>(iterations) * std::min(scale, 10.0));
+        iterations = std::max(iterations + 1, next);
+    }
+}
+
+/**
+ * @brief Options from the benchmark command line
+ */
+struct Options {
+    std::string filter;         ///< Substring a benchmark name must contain (empty = all)
+    double minSeconds = 0.2;    ///< Minimum measured wall time per benchmark
+    int repetitions = 1;        ///< Measured runs per benchmark
+    std::string jsonPath;       ///< JSON output file (empty = none)
+};
+
+/**
+ * @brief Parse the command line
+ * @param argc Argument count
+ * @param argv Arguments
+ * @param options Receives the options
+ * @return False on an unknown or malformed argument
+ */
+inline bool parseOptions(int argc, char** argv, Options& options) {
+    const std::string filterFlag = "--benchmark_filter=";
+    const std::string minTimeFlag = "--benchmark_min_time=";
+    const std::string repetitionsFlag = "--benchmark_repetitions=";
+    const std::string outFlag = "--benchmark_out=";
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.compare(0, filterFlag.size(), filterFlag) == 0) {
+            options.filter = arg.substr(filterFlag.size());
+        } else if (arg.compare(0, minTimeFlag.size(), minTimeFlag) == 0) {
+            char* end = nullptr;
+            options.minSeconds = std::strtod(arg.c_str() + minTimeFlag.size(), &end);
+            if (*end != '\0' || options.minSeconds <= 0) return false;
+        } else if (arg.compare(0, repetitionsFlag.size(), repetitionsFlag) == 0) {
+            char* end = nullptr;
+            const long count = std::strtol(arg.c_str() + repetitionsFlag.size(), &end, 10);
+            if (*end != '\0' || count < 1 || count > 100) return false;
+            options.repetitions = static_cast<int>(count);
+        } else if (arg.compare(0, outFlag.size(), outFlag) == 0 && arg.size() > outFlag.size()) {
+            options.jsonPath = arg.substr(outFlag.size());
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Quote a string for JSON
+ * @param text Text
+ * @return Quoted, escaped text
+ */
+inline std::string jsonString(const std::string& text) {
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') quoted += '\\';
+        if (static_cast<unsigned char>(c) >= 0x20) quoted += c;
+    }
+    return quoted + "\"";
+}
+
+/**
+ * @brief Write results in Google Benchmark's JSON layout
+ * @param path Output file
+ * @param executable Benchmark binary name
+ * @param results Results in run order
+ * @return False if the file cannot be written
+ */
+inline bool writeJson(const std::string& path, const std::string& executable, const std::vector<Result>& results) {
+    std::ofstream out(path);
+    out << "{\n  \"context\": {\n"
+        << "    \"executable\": " << jsonString(executable) << ",\n"
+        << "    \"num_cpus\": " << std::thread::hardware_concurrency() << "\n  },\n"
+        << "  \"benchmarks\": [";
+    out << std::setprecision(6);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\"name\": " << jsonString(r.name)
+            << ", \"iterations\": " << r.iterations
+            << ", \"real_time\": " << r.nsPerIteration
+            << ", \"time_unit\": \"ns\"";
+        if (r.itemsPerSecond > 0) out << ", \"items_per_second\": " << r.itemsPerSecond;
+        if (r.realTimeFactor > 0) out << ", \"real_time_factor\": " << r.realTimeFactor;
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+    return static_cast<bool>(out.flush());
+}
+
+/**
+ * @brief Run the selected benchmarks, print a result table and optionally write JSON
+ * @param argc Argument count
+ * @param argv Arguments (see the file comment)
+ * @return Process exit code
+ */
+inline int runAll(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::cerr << "usage: " << argv[0]
+                  << " [--benchmark_filter=TEXT] [--benchmark_min_time=SEC] [--benchmark_repetitions=N]"
+                  << " [--benchmark_out=FILE]" << std::endl;
+        return 2;
+    }
+    std::cout << std::left << std::setw(40) << "Benchmark" << std::right
+              << std::setw(14) << "ns/iter" << std::setw(14) << "iterations"
+              << std::setw(18) << "items/s" << std::endl;
+    std::cout << std::string(86, '-') << std::endl;
+    std::vector<Result> results;
+    for (const auto& entry : registry()) {
+        if (entry.first.find(options.filter) == std::string::npos) continue;
+        Result r = run(entry.first, entry.second, options.minSeconds, options.repetitions);
+        std::cout << std::left << std::setw(40) << r.name << std::right
+                  << std::setw(14) << std::fixed << std::setprecision(1) << r.nsPerIteration
+                  << std::setw(14) << r.iterations;
+        if (r.itemsPerSecond > 0) {
+            std::cout << std::setw(18) << std::scientific << std::setprecision(3) << r.itemsPerSecond;
+        }
+        if (r.realTimeFactor > 0) {
+            std::cout << std::setw(10) << std::fixed << std::setprecision(1) << r.realTimeFactor << "x realtime";
+        }
+        std::cout << std::endl;
+        results.push_back(r);
+    }
+    if (!options.jsonPath.empty() && !writeJson(options.jsonPath, argv[0], results)) {
+        std::cerr << "Cannot write " << options.jsonPath << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace bench
+
+#define BENCH_CONCAT_INNER(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_INNER(a, b)
+#define BENCHMARK(fn) static ::bench::Registrar BENCH_CONCAT(benchRegistrar_, __LINE__)(#fn, fn)
+#define BENCH_MAIN() int main(int argc, char** argv) { return ::bench::runAll(argc, argv); }
+
+#endif // BENCH_HARNESS_H
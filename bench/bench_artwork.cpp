@@ -0,0 +1,83 @@
+/**
+ * @file bench_artwork.cpp
+ * @brief Artwork cache hit/miss latency and one-time downscale cost
+ */
+
+#include "BenchHarness.h"
+#include "ArtworkCache.h"
+#include <cstdio>
+
+namespace {
+constexpr int ALBUMS = 64;
+const char* const PACK_FILE = "bench_artwork.pack";
+
+DecodedImage makeCover(int size, uint8_t seed) {
+    DecodedImage image;
+    image.width = size;
+    image.height = size;
+    image.rgb.resize(static_cast<size_t>(size) * size * 3);
+    for (size_t i = 0; i < image.rgb.size(); ++i) {
+        image.rgb[i] = static_cast<uint8_t>(i * 7 + seed);
+    }
+    return image;
+}
+
+std::string albumPath(int album) {
+    return "/media/usb/album" + std::to_string(album) + "/01.flac";
+}
+
+void buildPack() {
+    std::remove(PACK_FILE);
+    ArtworkCache cache(0);
+    cache.open(PACK_FILE);
+    const DecodedImage cover = makeCover(600, 1);
+    for (int album = 0; album < ALBUMS; ++album) {
+        cache.store(albumPath(album), cover);
+    }
+}
+} // namespace
+
+static void BM_ArtworkDownscale600(bench::State& state) {
+    const DecodedImage cover = makeCover(600, 3);
+    for (auto _ : state) {
+        Thumbnail thumbnail = ArtworkCache::downscale(cover, ArtworkCache::DEFAULT_THUMBNAIL_SIZE);
+        bench::doNotOptimize(thumbnail.pixels.data());
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ArtworkDownscale600);
+
+static void BM_ArtworkCacheHit(bench::State& state) {
+    buildPack();
+    ArtworkCache cache(ALBUMS * 128 * 128 * sizeof(uint16_t));
+    cache.open(PACK_FILE);
+    for (int album = 0; album < ALBUMS; ++album) cache.get(albumPath(album));
+    std::vector<std::string> paths;
+    for (int album = 0; album < ALBUMS; ++album) paths.push_back(albumPath(album));
+
+    size_t i = 0;
+    for (auto _ : state) {
+        bench::doNotOptimize(cache.get(paths[i++ % ALBUMS]).get());
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ArtworkCacheHit);
+
+static void BM_ArtworkCacheMiss(bench::State& state) {
+    buildPack();
+    // Room for one thumbnail: cycling through albums misses every time
+    ArtworkCache cache(128 * 128 * sizeof(uint16_t));
+    cache.open(PACK_FILE);
+    std::vector<std::string> paths;
+    for (int album = 0; album < ALBUMS; ++album) paths.push_back(albumPath(album));
+
+    size_t i = 0;
+    for (auto _ : state) {
+        bench::doNotOptimize(cache.get(paths[i++ % ALBUMS]).get());
+    }
+    std::remove(PACK_FILE);
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ArtworkCacheMiss);
+
+BENCH_MAIN();
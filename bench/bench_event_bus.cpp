@@ -0,0 +1,107 @@
+/**
+ * @file bench_event_bus.cpp
+ * @brief Event bus dispatch cost against direct calls, std::function lists and queued delivery
+ */
+
+#include "BenchHarness.h"
+#include "EventQueue.h"
+#include "VehicleEvents.h"
+#include <functional>
+#include <vector>
+
+namespace {
+const int QUEUE_BATCH = 64;
+
+double total = 0.0;
+
+// Out of line, as a call into another subsystem would be
+__attribute__((noinline)) void onSpeed(const SpeedChangedEvent& event) {
+    total += event.speedKmh;
+}
+} // namespace
+
+// The floor: one function call per event
+static void BM_DirectCall(bench::State& state) {
+    SpeedChangedEvent event{60.0};
+    for (auto _ : state) {
+        onSpeed(event);
+        event.speedKmh += 0.5;
+    }
+    bench::doNotOptimize(total);
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DirectCall);
+
+// Ad hoc callback wiring without the bus
+static void BM_FunctionVector1(bench::State& state) {
+    std::vector<std::function<void(const SpeedChangedEvent&)>> handlers{onSpeed};
+    SpeedChangedEvent event{60.0};
+    for (auto _ : state) {
+        for (const auto& handler : handlers) handler(event);
+        event.speedKmh += 0.5;
+    }
+    bench::doNotOptimize(total);
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FunctionVector1);
+
+// Publishing a type nobody subscribed to
+static void BM_BusPublishNoHandlers(bench::State& state) {
+    VehicleEventBus bus;
+    SpeedChangedEvent event{60.0};
+    for (auto _ : state) {
+        bus.publish(event);
+        event.speedKmh += 0.5;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BusPublishNoHandlers);
+
+// Same handler through the bus: pin, load the flat vector, call
+static void BM_BusPublish1(bench::State& state) {
+    VehicleEventBus bus;
+    bus.subscribe<SpeedChangedEvent>(onSpeed);
+    SpeedChangedEvent event{60.0};
+    for (auto _ : state) {
+        bus.publish(event);
+        event.speedKmh += 0.5;
+    }
+    bench::doNotOptimize(total);
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BusPublish1);
+
+// Fan-out: items are handler calls
+static void BM_BusPublish8(bench::State& state) {
+    VehicleEventBus bus;
+    for (int i = 0; i < 8; ++i) bus.subscribe<SpeedChangedEvent>(onSpeed);
+    SpeedChangedEvent event{60.0};
+    for (auto _ : state) {
+        bus.publish(event);
+        event.speedKmh += 0.5;
+    }
+    bench::doNotOptimize(total);
+    state.setItemsProcessed(state.iterations() * 8);
+}
+BENCHMARK(BM_BusPublish8);
+
+// Cross-thread delivery path, publisher and consumer on one thread: post a
+// burst, then drain it
+static void BM_BusQueuedDeliver(bench::State& state) {
+    VehicleEventBus bus;
+    EventQueue queue;
+    bus.subscribe<SpeedChangedEvent>(onSpeed, &queue);
+    SpeedChangedEvent event{60.0};
+    for (auto _ : state) {
+        for (int i = 0; i < QUEUE_BATCH; ++i) {
+            bus.publish(event);
+            event.speedKmh += 0.5;
+        }
+        queue.drain();
+    }
+    bench::doNotOptimize(total);
+    state.setItemsProcessed(state.iterations() * QUEUE_BATCH);
+}
+BENCHMARK(BM_BusQueuedDeliver);
+
+BENCH_MAIN();
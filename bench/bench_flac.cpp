@@ -0,0 +1,99 @@
+/**
+ * @file bench_flac.cpp
+ * @brief FLAC decode throughput against the real-time rate on one core
+ */
+
+#include "BenchHarness.h"
+#include "FlacDecoder.h"
+#include "../tests/FlacTestEncoder.h"
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+namespace {
+constexpr uint32_t SAMPLE_RATE = 44100;
+constexpr uint32_t SECONDS = 30;
+constexpr uint64_t TOTAL_FRAMES = static_cast<uint64_t>(SAMPLE_RATE) * SECONDS;
+const char* const FLAC_FILE = "bench_stream.flac";
+
+// 30 s of 16-bit stereo music-like signal, written once per process
+const std::string& fixture() {
+    static const std::string path = [] {
+        std::vector<int32_t> pcm(TOTAL_FRAMES * 2);
+        std::mt19937 rng(1);
+        for (uint64_t i = 0; i < TOTAL_FRAMES; ++i) {
+            double tone = 9000.0 * std::sin(i * 0.02) + 4000.0 * std::sin(i * 0.173);
+            int noise = static_cast<int>(rng() % 600) - 300;
+            pcm[i * 2] = static_cast<int32_t>(tone) + noise;
+            pcm[i * 2 + 1] = static_cast<int32_t>(tone * 0.8) - noise;
+        }
+        flactest::writeFlac(FLAC_FILE, pcm, 2, 16, SAMPLE_RATE);
+        std::atexit([] { std::remove(FLAC_FILE); });
+        return std::string(FLAC_FILE);
+    }();
+    return path;
+}
+
+// Encode before any benchmark is timed
+const std::string& FIXTURE = fixture();
+} // namespace
+
+static void BM_FlacPlaybackDecode(bench::State& state) {
+    FlacDecoder decoder;
+    decoder.open(FIXTURE);
+    std::vector<float> block(512 * 2);
+    uint64_t frames = 0;
+    for (auto _ : state) {
+        // Same 512-frame pulls as the audio callback
+        size_t n = decoder.read(block.data(), 512);
+        if (n < 512) decoder.seek(0);
+        frames += n;
+        bench::doNotOptimize(block[0]);
+    }
+    state.setItemsProcessed(frames);
+    state.setRealTimeRate(SAMPLE_RATE);
+}
+BENCHMARK(BM_FlacPlaybackDecode);
+
+static void BM_FlacDecodeAll1Thread(bench::State& state) {
+    FlacDecoder decoder;
+    decoder.open(FIXTURE);
+    std::vector<float> out;
+    for (auto _ : state) {
+        decoder.decodeAll(out, 1);
+        bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(state.iterations() * TOTAL_FRAMES);
+    state.setRealTimeRate(SAMPLE_RATE);
+}
+BENCHMARK(BM_FlacDecodeAll1Thread);
+
+static void BM_FlacDecodeAllParallel(bench::State& state) {
+    FlacDecoder decoder;
+    decoder.open(FIXTURE);
+    std::vector<float> out;
+    for (auto _ : state) {
+        decoder.decodeAll(out, 0);
+        bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(state.iterations() * TOTAL_FRAMES);
+    state.setRealTimeRate(SAMPLE_RATE);
+}
+BENCHMARK(BM_FlacDecodeAllParallel);
+
+static void BM_FlacSeekRandom(bench::State& state) {
+    FlacDecoder decoder;
+    decoder.open(FIXTURE);
+    decoder.buildSeekIndex();
+    std::mt19937_64 rng(5);
+    float sample[2];
+    for (auto _ : state) {
+        decoder.seek(rng() % TOTAL_FRAMES);
+        decoder.read(sample, 1);
+        bench::doNotOptimize(sample[0]);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FlacSeekRandom);
+
+BENCH_MAIN();
@@ -0,0 +1,62 @@
+/**
+ * @file bench_gps.cpp
+ * @brief Per-fix GPS math: haversine distance, initial bearing and coordinate formatting
+ */
+
+#include "BenchHarness.h"
+#include "GPSNavigator.h"
+#include "NotificationManager.h"
+#include <memory>
+#include <vector>
+
+namespace {
+// Points along a Los Angeles - San Francisco drive, cycled so inputs vary
+std::vector<GPSCoordinate> route() {
+    std::vector<GPSCoordinate> points;
+    for (int i = 0; i < 64; ++i) {
+        points.emplace_back(34.0522 + i * 0.0594, -118.2437 + i * 0.0597, 100.0 + i);
+    }
+    return points;
+}
+
+GPSNavigator& navigator() {
+    static GPSNavigator gps(std::make_shared<NotificationManager>());
+    return gps;
+}
+} // namespace
+
+static void BM_CalculateDistance(bench::State& state) {
+    const std::vector<GPSCoordinate> points = route();
+    size_t i = 0;
+    for (auto _ : state) {
+        bench::doNotOptimize(navigator().calculateDistance(points[i % points.size()], points[(i + 1) % points.size()]));
+        ++i;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CalculateDistance);
+
+static void BM_CalculateBearing(bench::State& state) {
+    const std::vector<GPSCoordinate> points = route();
+    size_t i = 0;
+    for (auto _ : state) {
+        bench::doNotOptimize(navigator().calculateBearing(points[i % points.size()], points[(i + 1) % points.size()]));
+        ++i;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CalculateBearing);
+
+// Runs for every status line that shows a position
+static void BM_FormatCoordinate(bench::State& state) {
+    const std::vector<GPSCoordinate> points = route();
+    size_t i = 0;
+    for (auto _ : state) {
+        bench::doNotOptimize(GPSNavigator::formatCoordinate(points[i % points.size()]));
+        ++i;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatCoordinate);
+
+BENCH_MAIN();
@@ -0,0 +1,111 @@
+/**
+ * @file bench_library_paging.cpp
+ * @brief Fully loaded versus paged library access with 100k tracks
+ */
+
+#include "BenchHarness.h"
+#include "MediaLibrary.h"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+namespace {
+constexpr size_t LIBRARY_TRACKS = 100000;
+constexpr size_t PAGED_CACHE_TRACKS = 256;
+constexpr size_t BROWSE_PAGE = 20;
+const char* const LIBRARY_FILE = "bench_library.bin";
+
+const std::string& fixture() {
+    static const std::string path = [] {
+        MediaLibrary library;
+        for (size_t i = 0; i < LIBRARY_TRACKS; ++i) {
+            Track track("Song " + std::to_string((i * 7919) % LIBRARY_TRACKS), "Artist " + std::to_string(i % 5000),
+                        "Album " + std::to_string(i % 9000), 180 + static_cast<int>(i % 200));
+            track.filePath = "/usb/music/" + std::to_string(i) + ".flac";
+            library.addTrack(track);
+        }
+        library.save(LIBRARY_FILE);
+        std::atexit([] { std::remove(LIBRARY_FILE); });
+        return std::string(LIBRARY_FILE);
+    }();
+    return path;
+}
+
+// Write the file before any benchmark is timed
+const std::string& FIXTURE = fixture();
+
+const MediaLibrary& pagedLibrary() {
+    static MediaLibrary library;
+    if (!library.isPaged()) library.openPaged(FIXTURE, PAGED_CACHE_TRACKS);
+    return library;
+}
+
+const MediaLibrary& fullLibrary() {
+    static MediaLibrary library;
+    if (library.size() == 0) library.load(FIXTURE);
+    return library;
+}
+
+void randomLookups(bench::State& state, const MediaLibrary& library) {
+    std::mt19937 rng(7);
+    for (auto _ : state) {
+        const Track* track = library.getTrack(static_cast<TrackId>(rng() % LIBRARY_TRACKS));
+        bench::doNotOptimize(track->duration);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+
+// One screen of the title-sorted browser: IDs plus each visible track
+void browsePages(bench::State& state, const MediaLibrary& library) {
+    size_t first = 0;
+    for (auto _ : state) {
+        for (TrackId id : library.browseByTitle(first, BROWSE_PAGE)) {
+            bench::doNotOptimize(library.getTrack(id)->title.size());
+        }
+        first = (first + 997 * BROWSE_PAGE) % LIBRARY_TRACKS;
+    }
+    state.setItemsProcessed(state.iterations() * BROWSE_PAGE);
+}
+} // namespace
+
+static void BM_LibraryLoadFull(bench::State& state) {
+    for (auto _ : state) {
+        MediaLibrary library;
+        library.load(FIXTURE);
+        bench::doNotOptimize(library.size());
+    }
+    state.setItemsProcessed(state.iterations() * LIBRARY_TRACKS);
+}
+BENCHMARK(BM_LibraryLoadFull);
+
+static void BM_LibraryOpenPaged(bench::State& state) {
+    for (auto _ : state) {
+        MediaLibrary library;
+        library.openPaged(FIXTURE, PAGED_CACHE_TRACKS);
+        bench::doNotOptimize(library.size());
+    }
+    state.setItemsProcessed(state.iterations() * LIBRARY_TRACKS);
+}
+BENCHMARK(BM_LibraryOpenPaged);
+
+static void BM_LibraryRandomLookupFull(bench::State& state) {
+    randomLookups(state, fullLibrary());
+}
+BENCHMARK(BM_LibraryRandomLookupFull);
+
+static void BM_LibraryRandomLookupPaged(bench::State& state) {
+    randomLookups(state, pagedLibrary());
+}
+BENCHMARK(BM_LibraryRandomLookupPaged);
+
+static void BM_LibraryBrowsePageFull(bench::State& state) {
+    browsePages(state, fullLibrary());
+}
+BENCHMARK(BM_LibraryBrowsePageFull);
+
+static void BM_LibraryBrowsePagePaged(bench::State& state) {
+    browsePages(state, pagedLibrary());
+}
+BENCHMARK(BM_LibraryBrowsePagePaged);
+
+BENCH_MAIN();
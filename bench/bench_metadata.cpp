@@ -0,0 +1,65 @@
+/**
+ * @file bench_metadata.cpp
+ * @brief Scan-time tag normalization and duplicate detection on a 50k-track scan
+ */
+
+#include "BenchHarness.h"
+#include "MediaLibrary.h"
+#include "MetadataNormalizer.h"
+#include <vector>
+
+namespace {
+constexpr size_t SCANNED_TRACKS = 50000;
+
+// Every fourth entry repeats an earlier track with different spelling
+std::vector<Track> makeScan() {
+    static const char* const FEATURING[] = {"feat.", "Ft", "FEATURING", "ft."};
+    std::vector<Track> scanned;
+    scanned.reserve(SCANNED_TRACKS);
+    for (size_t i = 0; i < SCANNED_TRACKS; ++i) {
+        const size_t song = i % 4 == 3 ? i - 3 : i;
+        scanned.emplace_back("  Song Number " + std::to_string(song), "Artist " + std::to_string(song % 700) + "  " +
+                             FEATURING[i % 4] + " Guest", "Album " + std::to_string(song % 3000), 180 + static_cast<int>(song % 120));
+        scanned.back().filePath = "/usb/music/" + std::to_string(i) + ".flac";
+    }
+    return scanned;
+}
+
+const std::vector<Track>& scan() {
+    static const std::vector<Track> tracks = makeScan();
+    return tracks;
+}
+
+void addScan(bench::State& state, unsigned threads) {
+    size_t tracks = 0;
+    for (auto _ : state) {
+        MediaLibrary library;
+        library.addScannedTracks(scan(), threads);
+        tracks = library.size();
+        bench::doNotOptimize(tracks);
+    }
+    state.setItemsProcessed(state.iterations() * SCANNED_TRACKS);
+}
+} // namespace
+
+static void BM_NormalizeText(bench::State& state) {
+    const std::string artist = "  Mark   Ronson  FEATURING Bruno Mars ";
+    for (auto _ : state) {
+        std::string normalized = MetadataNormalizer::normalizeText(artist);
+        bench::doNotOptimize(normalized);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NormalizeText);
+
+static void BM_AddScannedTracks1Thread(bench::State& state) {
+    addScan(state, 1);
+}
+BENCHMARK(BM_AddScannedTracks1Thread);
+
+static void BM_AddScannedTracksParallel(bench::State& state) {
+    addScan(state, 0);
+}
+BENCHMARK(BM_AddScannedTracksParallel);
+
+BENCH_MAIN();
@@ -0,0 +1,115 @@
+/**
+ * @file bench_playlist.cpp
+ * @brief Playlist editing and persistence with 10k-entry playlists, and MediaPlayer track navigation
+ */
+
+#include "BenchHarness.h"
+#include "MediaLibrary.h"
+#include "MediaPlayer.h"
+#include "NotificationManager.h"
+#include "Playlist.h"
+#include <cstdio>
+#include <iostream>
+#include <memory>
+
+namespace {
+constexpr size_t PLAYLIST_ENTRIES = 10000;
+const char* const PLAYLIST_FILE = "bench_playlist.bin";
+
+MediaLibrary& benchLibrary() {
+    static MediaLibrary library = [] {
+        MediaLibrary lib;
+        for (size_t i = 0; i < PLAYLIST_ENTRIES; ++i) {
+            lib.addTrack(Track("Track " + std::to_string(i), "Artist", "Album", 200));
+        }
+        return lib;
+    }();
+    return library;
+}
+
+Playlist makePlaylist() {
+    Playlist playlist("Bench");
+    for (size_t i = 0; i < PLAYLIST_ENTRIES; ++i) {
+        playlist.append(static_cast<TrackId>((i * 7919) % PLAYLIST_ENTRIES));
+    }
+    return playlist;
+}
+
+// Navigation prints status lines; a null buffer drops them unformatted
+class QuietCout {
+private:
+    std::streambuf* original;
+
+public:
+    QuietCout() : original(std::cout.rdbuf(nullptr)) {}
+    ~QuietCout() { std::cout.rdbuf(original); }
+};
+} // namespace
+
+static void BM_PlaylistMoveMiddle(bench::State& state) {
+    Playlist playlist = makePlaylist();
+    for (auto _ : state) {
+        playlist.move(10, PLAYLIST_ENTRIES / 2);
+        bench::doNotOptimize(playlist.at(0));
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PlaylistMoveMiddle);
+
+static void BM_PlaylistInsertRemoveMiddle(bench::State& state) {
+    Playlist playlist = makePlaylist();
+    const std::vector<TrackId> one{1};
+    for (auto _ : state) {
+        playlist.insert(PLAYLIST_ENTRIES / 2, one);
+        playlist.remove(PLAYLIST_ENTRIES / 2);
+    }
+    state.setItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_PlaylistInsertRemoveMiddle);
+
+static void BM_PlaylistSave10k(bench::State& state) {
+    Playlist playlist = makePlaylist();
+    for (auto _ : state) {
+        playlist.save(PLAYLIST_FILE);
+    }
+    state.setItemsProcessed(state.iterations() * PLAYLIST_ENTRIES);
+}
+BENCHMARK(BM_PlaylistSave10k);
+
+static void BM_PlaylistLoad10k(bench::State& state) {
+    makePlaylist().save(PLAYLIST_FILE);
+    const MediaLibrary& library = benchLibrary();
+    Playlist playlist;
+    for (auto _ : state) {
+        playlist.load(PLAYLIST_FILE, library);
+        bench::doNotOptimize(playlist.size());
+    }
+    std::remove(PLAYLIST_FILE);
+    state.setItemsProcessed(state.iterations() * PLAYLIST_ENTRIES);
+}
+BENCHMARK(BM_PlaylistLoad10k);
+
+// Skip button while stopped: queue step, track load and gain, no audio files
+static void BM_MediaPlayerNextTrack(bench::State& state) {
+    QuietCout quiet;
+    MediaPlayer player(std::make_shared<NotificationManager>());
+    player.loadDemoPlaylist();
+    for (auto _ : state) {
+        player.nextTrack();
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MediaPlayerNextTrack);
+
+static void BM_MediaPlayerPreviousTrack(bench::State& state) {
+    QuietCout quiet;
+    MediaPlayer player(std::make_shared<NotificationManager>());
+    player.loadDemoPlaylist();
+    for (auto _ : state) {
+        player.previousTrack();
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MediaPlayerPreviousTrack);
+
+BENCH_MAIN();
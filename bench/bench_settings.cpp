@@ -0,0 +1,205 @@
+/**
+ * @file bench_settings.cpp
+ * @brief Settings file load latency at boot, durable save cost, profile switching, text import and solar ticks
+ */
+
+#include "BenchHarness.h"
+#include "NotificationManager.h"
+#include "SystemSettings.h"
+#include "SettingsText.h"
+#include "SolarSchedule.h"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+const char* const SETTINGS_FILE = "bench_settings.bin";
+const int PROFILE_COUNT = 1000;
+// Profiles in the provisioning text: 1112 x 9 settings = 10008 keys
+const int TEXT_PROFILE_COUNT = 1112;
+
+// Setters and saves print status lines; keep them out of the results table
+class QuietCout {
+private:
+    std::ostringstream sink;
+    std::streambuf* original;
+
+public:
+    QuietCout() : original(std::cout.rdbuf(sink.rdbuf())) {}
+    ~QuietCout() { std::cout.rdbuf(original); }
+};
+
+std::shared_ptr<NotificationManager> notifications() {
+    static auto manager = std::make_shared<NotificationManager>();
+    return manager;
+}
+
+const std::string& fixture() {
+    static const std::string path = [] {
+        QuietCout quiet;
+        SystemSettings settings(notifications());
+        settings.setDisplayTheme(DisplayTheme::DARK);
+        settings.setTimeFormat("24h");
+        settings.saveSettings(SETTINGS_FILE);
+        std::atexit([] { std::remove(SETTINGS_FILE); });
+        return std::string(SETTINGS_FILE);
+    }();
+    return path;
+}
+
+const std::string& FIXTURE = fixture();
+
+// A bulk-provisioning file with every setting spelled out for each profile
+std::string provisioningText() {
+    std::string text = "# Fleet provisioning\nactive_profile = Driver 0\n";
+    for (int i = 0; i < TEXT_PROFILE_COUNT; ++i) {
+        text += "\n[Driver " + std::to_string(i) + "]\n";
+        text += "system_volume = " + std::to_string(i % 101) + "\n";
+        text += "display_brightness = " + std::to_string((i * 7) % 101) + "\n";
+        text += std::string("theme = ") + THEME_NAMES[i % 3] + "\n";
+        text += "language = " + std::to_string(i % 5) + "\n";
+        text += std::string("night_mode = ") + ON_OFF_NAMES[i % 2] + "\n";
+        text += "voice_guidance = on\n";
+        text += "notification_sounds = OFF\n";
+        text += std::string("time_format = ") + TIME_FORMAT_NAMES[i % 2] + "\n";
+        text += "temperature_unit = C\n";
+    }
+    return text;
+}
+} // namespace
+
+// What boot pays: one read, validation and CRC check
+static void BM_SettingsLoad(bench::State& state) {
+    QuietCout quiet;
+    SystemSettings settings(notifications());
+    for (auto _ : state) {
+        bench::doNotOptimize(settings.loadSettings(FIXTURE));
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SettingsLoad);
+
+// Temp file, fsync, rename and directory fsync
+static void BM_SettingsSaveDurable(bench::State& state) {
+    QuietCout quiet;
+    SystemSettings settings(notifications());
+    for (auto _ : state) {
+        bench::doNotOptimize(settings.saveSettings(FIXTURE));
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SettingsSaveDurable);
+
+// Hot-path read: pin the epoch, load the snapshot pointer, read a field
+static void BM_SettingsSnapshotRead(bench::State& state) {
+    SystemSettings settings(notifications());
+    for (auto _ : state) {
+        const SettingsView view = settings.getSnapshot();
+        bench::doNotOptimize(view->voiceGuidanceEnabled);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SettingsSnapshotRead);
+
+// Getters copy strings out of the snapshot
+static void BM_SettingsTemperatureUnitGetter(bench::State& state) {
+    SystemSettings settings(notifications());
+    for (auto _ : state) {
+        std::string unit = settings.getTemperatureUnit();
+        bench::doNotOptimize(unit);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SettingsTemperatureUnitGetter);
+
+// Driver change on a shared-fleet vehicle: pointer swap plus observers of changed keys
+static void BM_SettingsProfileSwitch(bench::State& state) {
+    QuietCout quiet;
+    SystemSettings settings(notifications());
+    std::vector<std::string> names;
+    for (int i = 0; i < PROFILE_COUNT; ++i) {
+        names.push_back("Driver " + std::to_string(i));
+        settings.createProfile(names.back());
+        settings.switchProfile(names.back());
+        settings.update([i](SettingsSnapshot& s) {
+            s.systemVolume = i % 101;
+            s.displayBrightness = (i * 7) % 101;
+            s.language = static_cast<Language>(i % 5);
+        });
+    }
+    long notified = 0;
+    settings.subscribe({SettingKey::SYSTEM_VOLUME}, [&notified](const SettingsChange&) { ++notified; });
+    size_t next = 0;
+    for (auto _ : state) {
+        bench::doNotOptimize(settings.switchProfile(names[next]));
+        next = (next + 389) % names.size();
+    }
+    bench::doNotOptimize(notified);
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SettingsProfileSwitch);
+
+// Tokenize and convert 10k keys: string_views only, no allocation
+static void BM_SettingsTextParse10k(bench::State& state) {
+    const std::string text = provisioningText();
+    uint64_t keys = 0;
+    for (auto _ : state) {
+        SettingsTextParser parser(text);
+        SettingsTextItem item{};
+        SettingsSnapshot values = defaultSettings();
+        while (parser.next(item)) {
+            if (item.kind != SettingsTextItemKind::VALUE) continue;
+            const SettingSpec* spec = findSetting(item.name);
+            int value = 0;
+            if (spec != nullptr && parseSettingValue(*spec, item.value, value)) {
+                spec->set(values, value);
+                ++keys;
+            }
+        }
+        bench::doNotOptimize(values);
+    }
+    state.setItemsProcessed(keys);
+}
+BENCHMARK(BM_SettingsTextParse10k);
+
+// Full import of 10k keys: parse, build 1112 profiles and publish the active one
+static void BM_SettingsTextImport10k(bench::State& state) {
+    QuietCout quiet;
+    const std::string text = provisioningText();
+    SystemSettings settings(notifications());
+    SettingsTextError error{0, 0, nullptr};
+    for (auto _ : state) {
+        bench::doNotOptimize(settings.importSettingsText(text, error));
+    }
+    state.setItemsProcessed(state.iterations() * TEXT_PROFILE_COUNT * SETTING_COUNT);
+}
+BENCHMARK(BM_SettingsTextImport10k);
+
+// Per-tick daylight check while the vehicle stays in one cell: no trig
+static void BM_SolarDaylightCached(bench::State& state) {
+    SolarSchedule schedule;
+    int64_t now = 1718996400;
+    for (auto _ : state) {
+        bench::doNotOptimize(schedule.daylightLevel(34.0522, -118.2437, now));
+        ++now;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SolarDaylightCached);
+
+// What every tick would cost without the cache
+static void BM_SolarSunTimesCompute(bench::State& state) {
+    int64_t day = 19895;
+    for (auto _ : state) {
+        bench::doNotOptimize(SolarSchedule::compute(34.0522, -118.2437, day));
+        day = 19895 + (day + 1) % 366;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SolarSunTimesCompute);
+
+BENCH_MAIN();
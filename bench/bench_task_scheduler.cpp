@@ -0,0 +1,92 @@
+/**
+ * @file bench_task_scheduler.cpp
+ * @brief Work-stealing scheduler scaling from one core to all of them, against spawning threads per call
+ */
+
+#include "BenchHarness.h"
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+const size_t ELEMENTS = 1 << 20;
+const size_t GRAIN = 4096;
+const int TASKS_PER_BATCH = 1000;
+
+// A few dozen cycles per element, like resampling or distance math
+void computeRange(std::vector<double>& data, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) data[i] = std::sqrt(data[i] * 1.0001 + 1.0) + std::sin(data[i]);
+}
+
+// 1, 2, 4, ... and the core count itself
+std::vector<unsigned> threadCounts() {
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned n = 1; n < cores; n *= 2) counts.push_back(n);
+    counts.push_back(cores);
+    return counts;
+}
+
+// One parallelFor over the array; the caller is one of the 'threads'
+void parallelForCompute(bench::State& state, unsigned threads) {
+    TaskScheduler scheduler(threads - 1);
+    std::vector<double> data(ELEMENTS, 1.0);
+    for (auto _ : state) {
+        scheduler.parallelFor(0, data.size(), GRAIN,
+                              [&data](size_t begin, size_t end) { computeRange(data, begin, end); });
+        bench::doNotOptimize(data.data());
+    }
+    state.setItemsProcessed(state.iterations() * ELEMENTS);
+}
+
+// What the subsystems did before: start and join threads on every call
+void spawnThreadsCompute(bench::State& state, unsigned threads) {
+    std::vector<double> data(ELEMENTS, 1.0);
+    for (auto _ : state) {
+        std::vector<std::thread> pool;
+        const size_t slice = data.size() / threads;
+        for (unsigned t = 1; t < threads; ++t) {
+            const size_t begin = t * slice;
+            const size_t end = t + 1 == threads ? data.size() : begin + slice;
+            pool.emplace_back([&data, begin, end]() { computeRange(data, begin, end); });
+        }
+        computeRange(data, 0, threads == 1 ? data.size() : slice);
+        for (auto& thread : pool) thread.join();
+        bench::doNotOptimize(data.data());
+    }
+    state.setItemsProcessed(state.iterations() * ELEMENTS);
+}
+
+// Scheduling overhead: tiny tasks submitted from outside, then waited for
+void submitThroughput(bench::State& state, unsigned threads) {
+    TaskScheduler scheduler(threads);
+    std::atomic<uint64_t> counter(0);
+    for (auto _ : state) {
+        for (int i = 0; i < TASKS_PER_BATCH; ++i) {
+            scheduler.submit([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        scheduler.waitIdle();
+    }
+    bench::doNotOptimize(counter.load());
+    state.setItemsProcessed(state.iterations() * TASKS_PER_BATCH);
+}
+
+const bool REGISTERED = [] {
+    for (unsigned threads : threadCounts()) {
+        const std::string suffix = "/" + std::to_string(threads);
+        bench::registry().emplace_back("BM_ParallelForCompute" + suffix,
+                                       [threads](bench::State& state) { parallelForCompute(state, threads); });
+        bench::registry().emplace_back("BM_SpawnThreadsCompute" + suffix,
+                                       [threads](bench::State& state) { spawnThreadsCompute(state, threads); });
+        bench::registry().emplace_back("BM_SubmitThroughput" + suffix,
+                                       [threads](bench::State& state) { submitThroughput(state, threads); });
+    }
+    return true;
+}();
+} // namespace
+
+BENCH_MAIN();
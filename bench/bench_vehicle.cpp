@@ -0,0 +1,82 @@
+/**
+ * @file bench_vehicle.cpp
+ * @brief Sensor setter cost in VehicleMonitor and alert recording in NotificationManager
+ */
+
+#include "BenchHarness.h"
+#include "NotificationManager.h"
+#include "VehicleMonitor.h"
+#include <iostream>
+#include <memory>
+
+namespace {
+// Alert banners would swamp the results table; a null buffer drops them unformatted
+class QuietCout {
+private:
+    std::streambuf* original;
+
+public:
+    QuietCout() : original(std::cout.rdbuf(nullptr)) {}
+    ~QuietCout() { std::cout.rdbuf(original); }
+};
+
+// What a long-running unit keeps: a bounded history and no console
+std::shared_ptr<NotificationManager> boundedNotifications() {
+    auto manager = std::make_shared<NotificationManager>();
+    manager->setConsoleOutput(false);
+    manager->setHistoryLimit(1000);
+    return manager;
+}
+} // namespace
+
+// One reading of each sensor, all in their normal ranges: no alerts
+static void BM_VehicleSettersNominal(bench::State& state) {
+    VehicleMonitor monitor(boundedNotifications());
+    double wobble = 0.0;
+    for (auto _ : state) {
+        monitor.setEngineTemperature(90.0 + wobble);
+        monitor.setFuelLevel(60.0 - wobble);
+        monitor.setCurrentSpeed(60.0 + wobble);
+        monitor.setBrakeWearLevel(80.0 - wobble);
+        monitor.setFuelConsumptionRate(7.0 + wobble);
+        wobble = wobble < 5.0 ? wobble + 0.01 : 0.0;
+    }
+    bench::doNotOptimize(monitor.getCurrentSpeed());
+    state.setItemsProcessed(state.iterations() * 5);
+}
+BENCHMARK(BM_VehicleSettersNominal);
+
+// An engine swinging between hot and overheating raises an alert on every reading
+static void BM_VehicleSetterAlerting(bench::State& state) {
+    VehicleMonitor monitor(boundedNotifications());
+    bool overheating = false;
+    for (auto _ : state) {
+        overheating = !overheating;
+        monitor.setEngineTemperature(overheating ? 110.0 : 100.0);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VehicleSetterAlerting);
+
+static void BM_AddNotification(bench::State& state) {
+    auto manager = boundedNotifications();
+    for (auto _ : state) {
+        manager->addNotification("Low fuel: 12% remaining", AlertLevel::WARNING);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AddNotification);
+
+// Interactive default: every warning also formats a console banner
+static void BM_AddNotificationConsole(bench::State& state) {
+    QuietCout quiet;
+    auto manager = std::make_shared<NotificationManager>();
+    manager->setHistoryLimit(1000);
+    for (auto _ : state) {
+        manager->addNotification("Low fuel: 12% remaining", AlertLevel::WARNING);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AddNotificationConsole);
+
+BENCH_MAIN();
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""Compare benchmark JSON results against a stored baseline.
+
+Usage:
+    compare.py [--threshold PERCENT] BASELINE RESULT.json...
+    compare.py --merge OUTPUT RESULT.json...
+
+Results are the files written by a benchmark's --benchmark_out option.
+A benchmark regresses when its time per iteration exceeds the baseline by
+more than the threshold (default 10%); the exit status is 1 if any did.
+Benchmarks missing from either side are listed but never fail the run.
+--merge combines result files into one, e.g. to record a new baseline.
+"""
+
+import json
+import os
+import sys
+
+
+def load_results(paths):
+    """Map benchmark name to its result entry across all files."""
+    results = {}
+    for path in paths:
+        with open(path, encoding="utf-8") as handle:
+            for entry in json.load(handle).get("benchmarks", []):
+                results[entry["name"]] = entry
+    return results
+
+
+def merge(output, paths):
+    results = load_results(paths)
+    merged = {"benchmarks": [results[name] for name in sorted(results)]}
+    with open(output, "w", encoding="utf-8") as handle:
+        json.dump(merged, handle, indent=2)
+        handle.write("\n")
+    print(f"Wrote {len(results)} benchmarks to {output}")
+    return 0
+
+
+def compare(baseline_path, paths, threshold):
+    if not os.path.exists(baseline_path):
+        print(f"No baseline at {baseline_path}; record one with 'make bench-baseline' first",
+              file=sys.stderr)
+        return 2
+    baseline = load_results([baseline_path])
+    current = load_results(paths)
+    regressions = 0
+
+    print(f"{'Benchmark':<40}{'baseline ns':>14}{'current ns':>14}{'change':>10}")
+    print("-" * 78)
+    for name in sorted(current):
+        now = current[name]["real_time"]
+        if name not in baseline:
+            print(f"{name:<40}{'-':>14}{now:>14.1f}{'new':>10}")
+            continue
+        before = baseline[name]["real_time"]
+        change = (now - before) / before * 100.0 if before > 0 else 0.0
+        flag = ""
+        if change > threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        elif change < -threshold:
+            flag = "  improved"
+        print(f"{name:<40}{before:>14.1f}{now:>14.1f}{change:>+9.1f}%{flag}")
+    for name in sorted(set(baseline) - set(current)):
+        print(f"{name:<40}{baseline[name]['real_time']:>14.1f}{'-':>14}{'not run':>10}")
+
+    print("-" * 78)
+    if regressions:
+        print(f"{regressions} benchmark(s) slower than the baseline by more than {threshold:g}%")
+        return 1
+    print(f"No regressions beyond {threshold:g}%")
+    return 0
+
+
+def main(argv):
+    args = argv[1:]
+    threshold = 10.0
+    if len(args) >= 2 and args[0] == "--threshold":
+        try:
+            threshold = float(args[1])
+        except ValueError:
+            args = []
+        else:
+            args = args[2:]
+    if len(args) >= 2 and args[0] == "--merge":
+        return merge(args[1], args[2:])
+    if len(args) < 2 or args[0].startswith("--"):
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+    return compare(args[0], args[1:], threshold)
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
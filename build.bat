@@ -22,32 +22,155 @@ echo Compiling GPSNavigator...
 g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/GPSNavigator.cpp -o obj/GPSNavigator.o
 if errorlevel 1 goto error
 
+echo Compiling BinaryIO...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/BinaryIO.cpp -o obj/BinaryIO.o
+if errorlevel 1 goto error
+
+echo Compiling MediaLibrary...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/MediaLibrary.cpp -o obj/MediaLibrary.o
+if errorlevel 1 goto error
+
+echo Compiling MappedFile...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/MappedFile.cpp -o obj/MappedFile.o
+if errorlevel 1 goto error
+
+echo Compiling PlayStatistics...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/PlayStatistics.cpp -o obj/PlayStatistics.o
+if errorlevel 1 goto error
+
+echo Compiling MetadataNormalizer...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/MetadataNormalizer.cpp -o obj/MetadataNormalizer.o
+if errorlevel 1 goto error
+
+echo Compiling Playlist...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/Playlist.cpp -o obj/Playlist.o
+if errorlevel 1 goto error
+
+echo Compiling ArtworkExtractor...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/ArtworkExtractor.cpp -o obj/ArtworkExtractor.o
+if errorlevel 1 goto error
+
+echo Compiling ArtworkCache...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/ArtworkCache.cpp -o obj/ArtworkCache.o
+if errorlevel 1 goto error
+
+echo Compiling AudioDecoder...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/AudioDecoder.cpp -o obj/AudioDecoder.o
+if errorlevel 1 goto error
+
+echo Compiling WavDecoder...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/WavDecoder.cpp -o obj/WavDecoder.o
+if errorlevel 1 goto error
+
+echo Compiling FlacDecoder...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/FlacDecoder.cpp -o obj/FlacDecoder.o
+if errorlevel 1 goto error
+
+echo Compiling SeekIndex...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/SeekIndex.cpp -o obj/SeekIndex.o
+if errorlevel 1 goto error
+
+echo Compiling AudioDSP...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/AudioDSP.cpp -o obj/AudioDSP.o
+if errorlevel 1 goto error
+
+echo Compiling PlaybackQueue...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/PlaybackQueue.cpp -o obj/PlaybackQueue.o
+if errorlevel 1 goto error
+
 echo Compiling MediaPlayer...
 g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/MediaPlayer.cpp -o obj/MediaPlayer.o
 if errorlevel 1 goto error
 
+echo Compiling PromptClipCache...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/PromptClipCache.cpp -o obj/PromptClipCache.o
+if errorlevel 1 goto error
+
+echo Compiling AudioFocusManager...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/AudioFocusManager.cpp -o obj/AudioFocusManager.o
+if errorlevel 1 goto error
+
+echo Compiling EpochReclaimer...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/EpochReclaimer.cpp -o obj/EpochReclaimer.o
+if errorlevel 1 goto error
+
+echo Compiling FileWatcher...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/FileWatcher.cpp -o obj/FileWatcher.o
+if errorlevel 1 goto error
+echo Compiling EventLoop...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/EventLoop.cpp -o obj/EventLoop.o
+if errorlevel 1 goto error
+echo Compiling EventQueue...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/EventQueue.cpp -o obj/EventQueue.o
+if errorlevel 1 goto error
+echo Compiling TaskScheduler...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/TaskScheduler.cpp -o obj/TaskScheduler.o
+if errorlevel 1 goto error
+echo Compiling NmeaParser...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/NmeaParser.cpp -o obj/NmeaParser.o
+if errorlevel 1 goto error
+echo Compiling CanDecoder...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/CanDecoder.cpp -o obj/CanDecoder.o
+if errorlevel 1 goto error
+echo Compiling VehicleDataFeed...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/VehicleDataFeed.cpp -o obj/VehicleDataFeed.o
+if errorlevel 1 goto error
+echo Compiling HeadlessDaemon...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/HeadlessDaemon.cpp -o obj/HeadlessDaemon.o
+if errorlevel 1 goto error
+
+echo Compiling MessageCatalog...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/MessageCatalog.cpp -o obj/MessageCatalog.o
+if errorlevel 1 goto error
+
+echo Compiling SettingsSchema...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/SettingsSchema.cpp -o obj/SettingsSchema.o
+if errorlevel 1 goto error
+
+echo Compiling SettingsHistory...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/SettingsHistory.cpp -o obj/SettingsHistory.o
+if errorlevel 1 goto error
+
+echo Compiling SettingsText...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/SettingsText.cpp -o obj/SettingsText.o
+if errorlevel 1 goto error
+
 echo Compiling SystemSettings...
 g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/SystemSettings.cpp -o obj/SystemSettings.o
 if errorlevel 1 goto error
 
+echo Compiling SolarSchedule...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/SolarSchedule.cpp -o obj/SolarSchedule.o
+if errorlevel 1 goto error
+
+echo Compiling DisplayScheduler...
+g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/DisplayScheduler.cpp -o obj/DisplayScheduler.o
+if errorlevel 1 goto error
+
 echo Compiling main application...
 g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude -c src/main.cpp -o obj/main.o
 if errorlevel 1 goto error
 
 REM Link main application
 echo Linking main application...
-g++ -std=c++17 -Wall -Wextra -O2 -g obj/main.o obj/NotificationManager.o obj/VehicleMonitor.o obj/GPSNavigator.o obj/MediaPlayer.o obj/SystemSettings.o -o bin/vehicle_system.exe
+g++ -std=c++17 -Wall -Wextra -O2 -g -pthread obj/main.o obj/NotificationManager.o obj/VehicleMonitor.o obj/GPSNavigator.o obj/BinaryIO.o obj/MappedFile.o obj/PlayStatistics.o obj/MetadataNormalizer.o obj/MediaLibrary.o obj/Playlist.o obj/ArtworkExtractor.o obj/ArtworkCache.o obj/AudioDecoder.o obj/WavDecoder.o obj/FlacDecoder.o obj/SeekIndex.o obj/AudioDSP.o obj/PlaybackQueue.o obj/MediaPlayer.o obj/PromptClipCache.o obj/AudioFocusManager.o obj/EpochReclaimer.o obj/FileWatcher.o obj/EventLoop.o obj/EventQueue.o obj/TaskScheduler.o obj/NmeaParser.o obj/CanDecoder.o obj/VehicleDataFeed.o obj/HeadlessDaemon.o obj/SettingsSchema.o obj/SettingsHistory.o obj/SettingsText.o obj/SystemSettings.o obj/SolarSchedule.o obj/DisplayScheduler.o obj/MessageCatalog.o -o bin/vehicle_system.exe
 if errorlevel 1 goto error
 
 REM Compile tests
 echo Compiling tests...
-g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude tests/test_integration.cpp obj/NotificationManager.o obj/VehicleMonitor.o obj/GPSNavigator.o obj/MediaPlayer.o obj/SystemSettings.o -o bin/test_integration.exe
+g++ -std=c++17 -Wall -Wextra -O2 -g -pthread -Iinclude tests/test_integration.cpp obj/NotificationManager.o obj/VehicleMonitor.o obj/GPSNavigator.o obj/BinaryIO.o obj/MappedFile.o obj/PlayStatistics.o obj/MetadataNormalizer.o obj/MediaLibrary.o obj/Playlist.o obj/ArtworkExtractor.o obj/ArtworkCache.o obj/AudioDecoder.o obj/WavDecoder.o obj/FlacDecoder.o obj/SeekIndex.o obj/AudioDSP.o obj/PlaybackQueue.o obj/MediaPlayer.o obj/PromptClipCache.o obj/AudioFocusManager.o obj/EpochReclaimer.o obj/FileWatcher.o obj/EventLoop.o obj/EventQueue.o obj/TaskScheduler.o obj/NmeaParser.o obj/CanDecoder.o obj/VehicleDataFeed.o obj/HeadlessDaemon.o obj/SettingsSchema.o obj/SettingsHistory.o obj/SettingsText.o obj/SystemSettings.o obj/SolarSchedule.o obj/DisplayScheduler.o obj/MessageCatalog.o -o bin/test_integration.exe
+if errorlevel 1 goto error
+
+g++ -std=c++17 -Wall -Wextra -O2 -g -pthread -Iinclude tests/test_vehicle_monitor.cpp obj/NotificationManager.o obj/VehicleMonitor.o obj/GPSNavigator.o obj/BinaryIO.o obj/MappedFile.o obj/PlayStatistics.o obj/MetadataNormalizer.o obj/MediaLibrary.o obj/Playlist.o obj/ArtworkExtractor.o obj/ArtworkCache.o obj/AudioDecoder.o obj/WavDecoder.o obj/FlacDecoder.o obj/SeekIndex.o obj/AudioDSP.o obj/PlaybackQueue.o obj/MediaPlayer.o obj/PromptClipCache.o obj/AudioFocusManager.o obj/EpochReclaimer.o obj/FileWatcher.o obj/EventLoop.o obj/EventQueue.o obj/TaskScheduler.o obj/NmeaParser.o obj/CanDecoder.o obj/VehicleDataFeed.o obj/HeadlessDaemon.o obj/SettingsSchema.o obj/SettingsHistory.o obj/SettingsText.o obj/SystemSettings.o obj/SolarSchedule.o obj/DisplayScheduler.o obj/MessageCatalog.o -o bin/test_vehicle_monitor.exe
+if errorlevel 1 goto error
+
+g++ -std=c++17 -Wall -Wextra -O2 -g -pthread -Iinclude tests/test_gps_navigator.cpp obj/NotificationManager.o obj/VehicleMonitor.o obj/GPSNavigator.o obj/BinaryIO.o obj/MappedFile.o obj/PlayStatistics.o obj/MetadataNormalizer.o obj/MediaLibrary.o obj/Playlist.o obj/ArtworkExtractor.o obj/ArtworkCache.o obj/AudioDecoder.o obj/WavDecoder.o obj/FlacDecoder.o obj/SeekIndex.o obj/AudioDSP.o obj/PlaybackQueue.o obj/MediaPlayer.o obj/PromptClipCache.o obj/AudioFocusManager.o obj/EpochReclaimer.o obj/FileWatcher.o obj/EventLoop.o obj/EventQueue.o obj/TaskScheduler.o obj/NmeaParser.o obj/CanDecoder.o obj/VehicleDataFeed.o obj/HeadlessDaemon.o obj/SettingsSchema.o obj/SettingsHistory.o obj/SettingsText.o obj/SystemSettings.o obj/SolarSchedule.o obj/DisplayScheduler.o obj/MessageCatalog.o -o bin/test_gps_navigator.exe
 if errorlevel 1 goto error
 
-g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude tests/test_vehicle_monitor.cpp obj/NotificationManager.o obj/VehicleMonitor.o obj/GPSNavigator.o obj/MediaPlayer.o obj/SystemSettings.o -o bin/test_vehicle_monitor.exe
+g++ -std=c++17 -Wall -Wextra -O2 -g -pthread -Iinclude tests/test_media_player.cpp obj/NotificationManager.o obj/VehicleMonitor.o obj/GPSNavigator.o obj/BinaryIO.o obj/MappedFile.o obj/PlayStatistics.o obj/MetadataNormalizer.o obj/MediaLibrary.o obj/Playlist.o obj/ArtworkExtractor.o obj/ArtworkCache.o obj/AudioDecoder.o obj/WavDecoder.o obj/FlacDecoder.o obj/SeekIndex.o obj/AudioDSP.o obj/PlaybackQueue.o obj/MediaPlayer.o obj/PromptClipCache.o obj/AudioFocusManager.o obj/EpochReclaimer.o obj/FileWatcher.o obj/EventLoop.o obj/EventQueue.o obj/TaskScheduler.o obj/NmeaParser.o obj/CanDecoder.o obj/VehicleDataFeed.o obj/HeadlessDaemon.o obj/SettingsSchema.o obj/SettingsHistory.o obj/SettingsText.o obj/SystemSettings.o obj/SolarSchedule.o obj/DisplayScheduler.o obj/MessageCatalog.o -o bin/test_media_player.exe
 if errorlevel 1 goto error
 
-g++ -std=c++17 -Wall -Wextra -O2 -g -Iinclude tests/test_gps_navigator.cpp obj/NotificationManager.o obj/VehicleMonitor.o obj/GPSNavigator.o obj/MediaPlayer.o obj/SystemSettings.o -o bin/test_gps_navigator.exe
+g++ -std=c++17 -Wall -Wextra -O2 -g -pthread -Iinclude tests/test_system_settings.cpp obj/NotificationManager.o obj/VehicleMonitor.o obj/GPSNavigator.o obj/BinaryIO.o obj/MappedFile.o obj/PlayStatistics.o obj/MetadataNormalizer.o obj/MediaLibrary.o obj/Playlist.o obj/ArtworkExtractor.o obj/ArtworkCache.o obj/AudioDecoder.o obj/WavDecoder.o obj/FlacDecoder.o obj/SeekIndex.o obj/AudioDSP.o obj/PlaybackQueue.o obj/MediaPlayer.o obj/PromptClipCache.o obj/AudioFocusManager.o obj/EpochReclaimer.o obj/FileWatcher.o obj/EventLoop.o obj/EventQueue.o obj/TaskScheduler.o obj/NmeaParser.o obj/CanDecoder.o obj/VehicleDataFeed.o obj/HeadlessDaemon.o obj/SettingsSchema.o obj/SettingsHistory.o obj/SettingsText.o obj/SystemSettings.o obj/SolarSchedule.o obj/DisplayScheduler.o obj/MessageCatalog.o -o bin/test_system_settings.exe
 if errorlevel 1 goto error
 
 echo.
@@ -60,6 +183,8 @@ echo   bin\vehicle_system.exe     - Main application
 echo   bin\test_integration.exe   - Integration tests
 echo   bin\test_vehicle_monitor.exe - Vehicle monitor tests
 echo   bin\test_gps_navigator.exe - GPS navigator tests
+echo   bin\test_media_player.exe - Media player tests
+echo   bin\test_system_settings.exe - System settings tests
 echo.
 echo To run the main application:
 echo   bin\vehicle_system.exe
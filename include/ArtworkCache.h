@@ -0,0 +1,205 @@
+/**
+ * @file ArtworkCache.h
+ * @brief Display-sized album art thumbnails in an on-disk pack with a byte-bounded LRU
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef ARTWORK_CACHE_H
+#define ARTWORK_CACHE_H
+
+#include "ArtworkExtractor.h"
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Full-size decoded picture, 8-bit RGB
+ */
+struct DecodedImage {
+    int width = 0;                  ///< Width in pixels
+    int height = 0;                 ///< Height in pixels
+    std::vector<uint8_t> rgb;       ///< width * height * 3 bytes, row major
+};
+
+/**
+ * @brief Display-ready thumbnail in the head unit's RGB565 framebuffer format
+ */
+struct Thumbnail {
+    uint16_t width = 0;             ///< Width in pixels
+    uint16_t height = 0;            ///< Height in pixels
+    std::vector<uint16_t> pixels;   ///< RGB565 pixels, row major
+
+    /**
+     * @brief Memory held by the pixel data
+     * @return Size in bytes
+     */
+    size_t byteSize() const { return pixels.size() * sizeof(uint16_t); }
+};
+
+/**
+ * @brief Album art cache keyed by audio file path
+ *
+ * Cover art is decoded and downscaled once, when a track is scanned, and
+ * appended to a thumbnail pack file. Track changes then only need a lookup:
+ * a hit in the in-memory LRU returns the shared thumbnail, a miss is one
+ * seek and read of a few tens of KB from the pack. The LRU is bounded by
+ * pixel bytes, not entry count, and evicted thumbnails stay valid for any
+ * caller still holding them.
+ *
+ * Image codecs are not linked into this module; callers provide an
+ * ImageDecoder for the formats they support (JPEG, PNG, ...).
+ */
+class ArtworkCache {
+public:
+    /**
+     * @brief Decodes an embedded picture to RGB
+     */
+    using ImageDecoder = std::function<bool(const EmbeddedArtwork& artwork, DecodedImage& image)>;
+
+    static constexpr uint32_t PACK_MAGIC = 0x54524156;          ///< "VART"
+    static constexpr uint32_t PACK_VERSION = 1;                 ///< Pack format version
+    static constexpr uint16_t DEFAULT_THUMBNAIL_SIZE = 128;     ///< Longest edge in pixels
+
+    /**
+     * @brief Constructor
+     * @param memoryBudgetBytes Maximum pixel bytes held in memory
+     * @param thumbnailEdge Longest thumbnail edge in pixels
+     */
+    explicit ArtworkCache(size_t memoryBudgetBytes, uint16_t thumbnailEdge = DEFAULT_THUMBNAIL_SIZE);
+
+    /**
+     * @brief Open (or create) the thumbnail pack and index its records
+     *
+     * A record cut short by a crash during append is discarded. Storing a
+     * path again appends a new record; once superseded records take up a
+     * quarter of the pack, it is rewritten with only the live ones.
+     * @param packPath Pack file path
+     * @return True on success
+     */
+    bool open(const std::string& packPath);
+
+    /**
+     * @brief Set the decoder used by importFromFile
+     * @param imageDecoder Decoder callback
+     */
+    void setDecoder(ImageDecoder imageDecoder);
+
+    /**
+     * @brief Extract, decode, downscale and store the artwork of an audio file
+     * @param audioPath Audio file
+     * @return True if a thumbnail was stored
+     */
+    bool importFromFile(const std::string& audioPath);
+
+    /**
+     * @brief Downscale and store an already decoded picture
+     * @param audioPath Key the thumbnail is stored under
+     * @param image Full-size picture
+     * @return True if the thumbnail was written to the pack
+     */
+    bool store(const std::string& audioPath, const DecodedImage& image);
+
+    /**
+     * @brief Check whether the pack holds a thumbnail for a file
+     * @param audioPath Audio file
+     * @return True if present
+     */
+    bool contains(const std::string& audioPath) const;
+
+    /**
+     * @brief Get the thumbnail for a file
+     * @param audioPath Audio file
+     * @return Thumbnail, nullptr if the file has no artwork
+     */
+    std::shared_ptr<const Thumbnail> get(const std::string& audioPath);
+
+    /**
+     * @brief Pixel bytes currently held in memory
+     * @return Size in bytes
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * @brief Configured memory budget
+     * @return Size in bytes
+     */
+    size_t getMemoryBudget() const;
+
+    /**
+     * @brief Number of thumbnails in the pack
+     * @return Thumbnail count
+     */
+    size_t getPackedCount() const;
+
+    /**
+     * @brief Lookups answered from memory
+     * @return Hit count
+     */
+    size_t getHits() const;
+
+    /**
+     * @brief Lookups that had to read the pack
+     * @return Miss count
+     */
+    size_t getMisses() const;
+
+    /**
+     * @brief Box-filter downscale to fit a square, converting to RGB565
+     *
+     * Aspect ratio is preserved and pictures are never upscaled.
+     * @param image Full-size picture
+     * @param maxSize Longest edge of the result
+     * @return Thumbnail (empty if the image is invalid)
+     */
+    static Thumbnail downscale(const DecodedImage& image, uint16_t maxSize);
+
+private:
+    /**
+     * @brief Location of one thumbnail in the pack
+     */
+    struct PackEntry {
+        uint64_t offset;    ///< File offset of the pixel data
+        uint16_t width;     ///< Width in pixels
+        uint16_t height;    ///< Height in pixels
+    };
+
+    /**
+     * @brief Resident thumbnail and its LRU position
+     */
+    struct Resident {
+        std::shared_ptr<const Thumbnail> thumbnail;     ///< Cached pixels
+        std::list<std::string>::iterator lruPosition;   ///< Position in lru
+    };
+
+    const size_t memoryBudget;                              ///< Maximum resident bytes
+    const uint16_t thumbnailSize;                           ///< Longest edge in pixels
+    ImageDecoder decoder;                                   ///< Embedded picture decoder
+    std::fstream pack;                                      ///< Open pack file
+    std::unordered_map<std::string, PackEntry> index;       ///< Path -> pack record
+    std::unordered_map<std::string, Resident> resident;     ///< Path -> in-memory thumbnail
+    std::list<std::string> lru;                             ///< Most recently used first
+    size_t memoryUsage;                                     ///< Resident pixel bytes
+    size_t hits;                                            ///< Lookups served from memory
+    size_t misses;                                          ///< Lookups served from the pack
+    mutable std::mutex mutex;                               ///< Guards all of the above
+
+    /**
+     * @brief Rewrite the pack with only the indexed records and swap it in
+     * @param packPath Pack file path
+     * @return True on success; on failure the old pack stays in use
+     */
+    bool compact(const std::string& packPath);
+
+    /**
+     * @brief Insert a thumbnail into the LRU, evicting the oldest to stay in budget
+     */
+    void makeResident(const std::string& audioPath, std::shared_ptr<const Thumbnail> thumbnail);
+};
+
+#endif // ARTWORK_CACHE_H
@@ -0,0 +1,69 @@
+/**
+ * @file ArtworkExtractor.h
+ * @brief Locates embedded cover art in FLAC and ID3v2-tagged audio files
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef ARTWORK_EXTRACTOR_H
+#define ARTWORK_EXTRACTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Encoded picture found inside an audio file
+ */
+struct EmbeddedArtwork {
+    std::string mimeType;           ///< e.g. "image/jpeg", "image/png"
+    uint8_t pictureType = 0;        ///< ID3/FLAC picture type (3 = front cover)
+    std::vector<uint8_t> data;      ///< Encoded image bytes
+};
+
+/**
+ * @brief Reads embedded artwork from audio file headers
+ *
+ * Only the metadata region is read (FLAC metadata blocks, or the ID3v2 tag
+ * at the start of MP3 files); audio data is never touched. When a file
+ * holds several pictures the front cover is preferred, otherwise the first
+ * picture is returned.
+ */
+class ArtworkExtractor {
+public:
+    static constexpr uint8_t FRONT_COVER = 3;                   ///< Picture type for the front cover
+    static constexpr size_t MAX_PICTURE_BYTES = 16 * 1024 * 1024;   ///< Larger pictures are ignored
+
+    /**
+     * @brief Extract embedded artwork from a FLAC or ID3v2-tagged file
+     * @param audioPath Audio file
+     * @param artwork Receives the picture
+     * @return True if a picture was found
+     */
+    static bool extract(const std::string& audioPath, EmbeddedArtwork& artwork);
+
+    /**
+     * @brief Parse a FLAC METADATA_BLOCK_PICTURE body
+     * @param block Block contents (without the 4-byte block header)
+     * @param size Block size
+     * @param artwork Receives the picture
+     * @return True if the block is well formed
+     */
+    static bool parseFlacPicture(const uint8_t* block, size_t size, EmbeddedArtwork& artwork);
+
+    /**
+     * @brief Parse an ID3v2 APIC frame body
+     * @param frame Frame contents (without the frame header)
+     * @param size Frame size
+     * @param artwork Receives the picture
+     * @return True if the frame is well formed
+     */
+    static bool parseApicFrame(const uint8_t* frame, size_t size, EmbeddedArtwork& artwork);
+
+private:
+    static bool extractFlac(std::istream& file, EmbeddedArtwork& artwork);
+    static bool extractId3(std::istream& file, EmbeddedArtwork& artwork);
+};
+
+#endif // ARTWORK_EXTRACTOR_H
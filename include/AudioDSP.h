@@ -0,0 +1,168 @@
+/**
+ * @file AudioDSP.h
+ * @brief Playback DSP chain: volume ramp, EQ, loudness gain and crossfade
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef AUDIO_DSP_H
+#define AUDIO_DSP_H
+
+#include <array>
+#include <cstddef>
+
+constexpr int AUDIO_SAMPLE_RATE = 44100;    ///< Output sample rate in Hz
+constexpr int AUDIO_CHANNELS = 2;           ///< Output channels (interleaved)
+
+/**
+ * @brief Coefficients of a normalized biquad filter (a0 == 1)
+ */
+struct BiquadCoefficients {
+    float b0;   ///< Feed-forward coefficient 0
+    float b1;   ///< Feed-forward coefficient 1
+    float b2;   ///< Feed-forward coefficient 2
+    float a1;   ///< Feedback coefficient 1
+    float a2;   ///< Feedback coefficient 2
+
+    /**
+     * @brief Pass-through filter
+     * @return Identity coefficients
+     */
+    static BiquadCoefficients identity();
+
+    /**
+     * @brief Peaking EQ filter (RBJ audio EQ cookbook)
+     * @param frequency Center frequency in Hz
+     * @param gainDb Boost/cut in dB
+     * @param q Quality factor
+     * @param sampleRate Sample rate in Hz
+     * @return Filter coefficients
+     */
+    static BiquadCoefficients peaking(float frequency, float gainDb, float q, int sampleRate);
+};
+
+/**
+ * @brief Per-stream DSP stage applied to interleaved float buffers
+ *
+ * Gain changes (volume and loudness normalization) are ramped over
+ * RAMP_FRAMES to avoid zipper noise. Gain is applied with SSE over the
+ * interleaved buffer; the EQ runs one transposed direct-form II biquad per
+ * band and channel and skips bands that are flat.
+ */
+class AudioDSP {
+public:
+    static constexpr size_t EQ_BANDS = 5;           ///< Number of EQ bands
+    static constexpr size_t RAMP_FRAMES = 512;      ///< Frames per gain ramp (~11.6 ms)
+    static constexpr float MAX_EQ_GAIN_DB = 12.0f;  ///< EQ boost/cut limit
+
+private:
+    int sampleRate;                                             ///< Sample rate in Hz
+    int channels;                                               ///< Interleaved channel count
+    float volumeGain;                                           ///< Linear gain from volume
+    float loudnessGain;                                         ///< Linear normalization gain
+    float currentGain;                                          ///< Gain at the last processed frame
+    float rampStep;                                             ///< Gain increment per frame
+    size_t rampFramesRemaining;                                 ///< Frames left in current ramp
+    std::array<float, EQ_BANDS> eqGainsDb;                      ///< Band gains in dB
+    std::array<BiquadCoefficients, EQ_BANDS> eqCoefficients;    ///< Band filters
+    std::array<std::array<float, 2 * AUDIO_CHANNELS>, EQ_BANDS> eqState;   ///< z1/z2 per channel
+
+    /**
+     * @brief Start a ramp towards volumeGain * loudnessGain
+     */
+    void retarget();
+
+    /**
+     * @brief Apply gain (ramped or constant) to a buffer
+     * @param samples Interleaved samples
+     * @param frames Number of frames
+     */
+    void applyGain(float* samples, size_t frames);
+
+    /**
+     * @brief Run the EQ bands over a buffer
+     * @param samples Interleaved samples
+     * @param frames Number of frames
+     */
+    void applyEq(float* samples, size_t frames);
+
+public:
+    /**
+     * @brief Constructor
+     * @param rate Sample rate in Hz
+     * @param channelCount Interleaved channel count (1 or 2)
+     */
+    explicit AudioDSP(int rate = AUDIO_SAMPLE_RATE, int channelCount = AUDIO_CHANNELS);
+
+    /**
+     * @brief Set volume; the change is ramped
+     * @param percent Volume level (0-100)
+     */
+    void setVolume(int percent);
+
+    /**
+     * @brief Set loudness normalization gain for the current track
+     * @param gainDb Track gain in dB (e.g. ReplayGain)
+     */
+    void setLoudnessGain(float gainDb);
+
+    /**
+     * @brief Set gain of one EQ band
+     * @param band Band index (0 = lowest)
+     * @param gainDb Boost/cut in dB, clamped to +/-MAX_EQ_GAIN_DB
+     */
+    void setEqBand(size_t band, float gainDb);
+
+    /**
+     * @brief Get gain of one EQ band
+     * @param band Band index
+     * @return Gain in dB, 0 for an invalid band
+     */
+    float getEqBand(size_t band) const;
+
+    /**
+     * @brief Get center frequency of an EQ band
+     * @param band Band index
+     * @return Frequency in Hz
+     */
+    static float eqBandFrequency(size_t band);
+
+    /**
+     * @brief Get the gain currently applied (mid-ramp value while ramping)
+     * @return Linear gain
+     */
+    float getCurrentGain() const;
+
+    /**
+     * @brief Clear filter state and jump to the target gain
+     */
+    void reset();
+
+    /**
+     * @brief Process a buffer in place: EQ, then ramped gain
+     * @param samples Interleaved samples
+     * @param frames Number of frames
+     */
+    void process(float* samples, size_t frames);
+
+    /**
+     * @brief Linear crossfade between two interleaved buffers
+     * @param outgoing Samples of the track fading out
+     * @param incoming Samples of the track fading in
+     * @param out Destination (may alias either input)
+     * @param frames Number of frames
+     * @param channelCount Interleaved channel count
+     * @param startMix Incoming weight at the first frame (0-1)
+     * @param endMix Incoming weight after the last frame (0-1)
+     */
+    static void crossfade(const float* outgoing, const float* incoming, float* out,
+                          size_t frames, int channelCount, float startMix, float endMix);
+
+    /**
+     * @brief Convert decibels to linear gain
+     * @param db Gain in dB
+     * @return Linear gain
+     */
+    static float dbToGain(float db);
+};
+
+#endif // AUDIO_DSP_H
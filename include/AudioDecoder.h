@@ -0,0 +1,84 @@
+/**
+ * @file AudioDecoder.h
+ * @brief Common interface of the audio file decoders
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef AUDIO_DECODER_H
+#define AUDIO_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/**
+ * @brief Streams interleaved float PCM out of an audio file
+ *
+ * Positions are in frames (one sample per channel). Implementations decide
+ * how seek() reaches a frame: uncompressed formats compute the byte offset
+ * directly, compressed formats start from the nearest SeekIndex point.
+ */
+class AudioDecoder {
+public:
+    virtual ~AudioDecoder() = default;
+
+    /**
+     * @brief Open a file and read its header
+     * @param path Audio file
+     * @return True if the file is in a supported format
+     */
+    virtual bool open(const std::string& path) = 0;
+
+    /**
+     * @brief Decode the next frames
+     *
+     * Called on the audio thread: read() and seek() must not allocate, so
+     * implementations size their buffers in open(). They may block on
+     * file I/O.
+     * @param out Destination (frames * getChannels() floats, interleaved, [-1, 1])
+     * @param frames Maximum frames to decode
+     * @return Frames decoded; less than requested only at end of stream or on error
+     */
+    virtual size_t read(float* out, size_t frames) = 0;
+
+    /**
+     * @brief Move the read position
+     * @param frame Target frame (clamped to the end of the stream)
+     * @return True on success
+     */
+    virtual bool seek(uint64_t frame) = 0;
+
+    /**
+     * @brief Current read position
+     * @return Frame index of the next frame read() returns
+     */
+    virtual uint64_t tell() const = 0;
+
+    /**
+     * @brief Stream length
+     * @return Total frames
+     */
+    virtual uint64_t getTotalFrames() const = 0;
+
+    /**
+     * @brief Stream sample rate
+     * @return Sample rate in Hz
+     */
+    virtual uint32_t getSampleRate() const = 0;
+
+    /**
+     * @brief Stream channel count
+     * @return Channels per frame
+     */
+    virtual uint16_t getChannels() const = 0;
+
+    /**
+     * @brief Open a file with the decoder matching its contents
+     * @param path Audio file
+     * @return Opened decoder, nullptr if the format is unsupported
+     */
+    static std::unique_ptr<AudioDecoder> create(const std::string& path);
+};
+
+#endif // AUDIO_DECODER_H
@@ -0,0 +1,89 @@
+/**
+ * @file AudioFocusManager.h
+ * @brief Mixes navigation voice prompts over media with ducking
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef AUDIO_FOCUS_MANAGER_H
+#define AUDIO_FOCUS_MANAGER_H
+
+#include "MediaPlayer.h"
+#include "PromptClipCache.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Owns the audio output mix between media and navigation prompts
+ *
+ * Prompt requests are pushed from the control thread into a lock-free
+ * single-producer/single-consumer ring; mix() runs on the audio thread,
+ * renders media, and when a prompt is pending ducks the media with a
+ * per-frame gain envelope. The prompt starts on the exact frame the duck
+ * attack completes. mix() performs no allocation, locking or I/O.
+ */
+class AudioFocusManager {
+public:
+    static constexpr float DUCK_GAIN = 0.25f;           ///< Media gain under a prompt (-12 dB)
+    static constexpr size_t ATTACK_FRAMES = 1323;       ///< Duck-in time (30 ms)
+    static constexpr size_t RELEASE_FRAMES = 13230;     ///< Duck-out time (300 ms)
+    static constexpr size_t PROMPT_QUEUE_SIZE = 8;      ///< Pending prompt capacity
+
+private:
+    std::shared_ptr<MediaPlayer> mediaPlayer;                       ///< Media source (may be null)
+    std::shared_ptr<const PromptClipCache> clipCache;               ///< Preloaded prompt clips
+    std::array<VoicePrompt, PROMPT_QUEUE_SIZE> pendingPrompts;      ///< SPSC ring storage
+    std::atomic<size_t> pendingHead;                                ///< Next slot to read (audio thread)
+    std::atomic<size_t> pendingTail;                                ///< Next slot to write (control thread)
+    PromptClip activeClip;                                          ///< Clip currently playing
+    size_t activePosition;                                          ///< Next sample of activeClip
+    std::atomic<float> duckGain;                                    ///< Current media gain (written by mix)
+    std::atomic<float> promptGain;                                  ///< Prompt playback gain (written by setPromptVolume)
+    std::atomic<bool> clipActive;                                   ///< Whether mix() is playing a clip (written by mix)
+
+public:
+    /**
+     * @brief Constructor
+     * @param player Media player rendered underneath prompts (may be null)
+     * @param cache Preloaded prompt clips
+     */
+    AudioFocusManager(std::shared_ptr<MediaPlayer> player, std::shared_ptr<const PromptClipCache> cache);
+
+    /**
+     * @brief Queue a voice prompt (control thread)
+     * @param prompt Prompt to speak
+     * @return False if the queue is full and the prompt was dropped
+     */
+    bool requestPrompt(VoicePrompt prompt);
+
+    /**
+     * @brief Set prompt volume
+     * @param percent Volume (0-100)
+     */
+    void setPromptVolume(int percent);
+
+    /**
+     * @brief Render one block of output (audio thread)
+     * @param out Interleaved AUDIO_CHANNELS destination buffer
+     * @param frames Number of frames
+     */
+    void mix(float* out, size_t frames);
+
+    /**
+     * @brief Check whether a prompt is playing or pending
+     *
+     * Derived from the queue indices, the playing clip and the duck gain,
+     * each of which has a single writing thread.
+     * @return True while media is (or is about to be) ducked
+     */
+    bool isPromptActive() const;
+
+    /**
+     * @brief Current media gain applied by ducking
+     * @return Linear gain (1.0 when not ducked) at the end of the last block
+     */
+    float getDuckGain() const;
+};
+
+#endif // AUDIO_FOCUS_MANAGER_H
@@ -0,0 +1,165 @@
+/**
+ * @file BinaryIO.h
+ * @brief Little-endian binary encoding helpers for on-disk formats
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef BINARY_IO_H
+#define BINARY_IO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Appends little-endian values to an in-memory buffer
+ */
+class BinaryWriter {
+private:
+    std::string buffer;     ///< Encoded bytes
+
+public:
+    /**
+     * @brief Reserve buffer capacity
+     * @param bytes Expected encoded size
+     */
+    void reserve(size_t bytes);
+
+    void u8(uint8_t value);         ///< Append one byte
+    void u16(uint16_t value);       ///< Append a 16-bit value
+    void u32(uint32_t value);       ///< Append a 32-bit value
+    void u64(uint64_t value);       ///< Append a 64-bit value
+    void i32(int32_t value);        ///< Append a signed 32-bit value
+    void f32(float value);          ///< Append an IEEE-754 float
+
+    /**
+     * @brief Append a length-prefixed (u32) string
+     * @param value String to append
+     */
+    void str(const std::string& value);
+
+    /**
+     * @brief Append raw bytes
+     * @param data Source bytes
+     * @param size Number of bytes
+     */
+    void bytes(const void* data, size_t size);
+
+    /**
+     * @brief Get the encoded bytes
+     * @return Buffer contents
+     */
+    const std::string& data() const;
+};
+
+/**
+ * @brief Bounds-checked little-endian reader over a byte range
+ *
+ * Reads past the end return zero values and clear good(); callers check
+ * good() once after decoding a record instead of after every field.
+ */
+class BinaryReader {
+private:
+    const unsigned char* data;  ///< Start of input
+    size_t size;                ///< Input length
+    size_t pos;                 ///< Read cursor
+    bool ok;                    ///< False after any out-of-range read
+
+    /**
+     * @brief Reserve bytes for a read
+     * @param count Bytes needed
+     * @return Pointer to the bytes, nullptr if out of range
+     */
+    const unsigned char* take(size_t count);
+
+public:
+    /**
+     * @brief Constructor
+     * @param bytes Input bytes
+     * @param length Input length
+     */
+    BinaryReader(const void* bytes, size_t length);
+
+    uint8_t u8();       ///< Read one byte
+    uint16_t u16();     ///< Read a 16-bit value
+    uint32_t u32();     ///< Read a 32-bit value
+    uint64_t u64();     ///< Read a 64-bit value
+    int32_t i32();      ///< Read a signed 32-bit value
+    float f32();        ///< Read an IEEE-754 float
+
+    /**
+     * @brief Read a length-prefixed (u32) string
+     * @return Decoded string (empty on error)
+     */
+    std::string str();
+
+    /**
+     * @brief Copy raw bytes out of the input
+     * @param out Destination
+     * @param count Number of bytes
+     * @return False if out of range
+     */
+    bool bytes(void* out, size_t count);
+
+    /**
+     * @brief Skip bytes
+     * @param count Number of bytes
+     * @return False if out of range
+     */
+    bool skip(size_t count);
+
+    /**
+     * @brief Check that no read has gone out of range
+     * @return True if all reads succeeded
+     */
+    bool good() const;
+
+    /**
+     * @brief Bytes left to read
+     * @return Remaining length
+     */
+    size_t remaining() const;
+
+    /**
+     * @brief Current read offset
+     * @return Offset from the start of input
+     */
+    size_t position() const;
+};
+
+/**
+ * @brief Read a whole file with a single read call
+ * @param path File path
+ * @param contents Receives the file contents
+ * @return False if the file could not be read
+ */
+bool readFileContents(const std::string& path, std::string& contents);
+
+/**
+ * @brief Write a whole file, replacing any existing contents
+ *
+ * The data goes to "<path>.tmp" first and is renamed over the target, so
+ * an interrupted write leaves the old file intact.
+ * @param path File path
+ * @param contents Bytes to write
+ * @param durable Also fsync the file and its directory so the new contents
+ *                survive power loss (POSIX only)
+ * @return False on I/O error
+ */
+bool writeFileContents(const std::string& path, const std::string& contents, bool durable = false);
+
+/**
+ * @brief CRC-32 (IEEE 802.3, as used by zip and PNG)
+ * @param data Input bytes
+ * @param size Input length
+ * @return Checksum
+ */
+uint32_t crc32(const void* data, size_t size);
+
+/**
+ * @brief Check whether the host stores integers little-endian
+ * @return True on little-endian hosts
+ */
+bool isLittleEndianHost();
+
+#endif // BINARY_IO_H
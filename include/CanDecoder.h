@@ -0,0 +1,67 @@
+/**
+ * @file CanDecoder.h
+ * @brief Decoder for OBD-II responses in candump CAN logs
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef CAN_DECODER_H
+#define CAN_DECODER_H
+
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief One classic CAN frame
+ */
+struct CanFrame {
+    uint32_t id;            ///< 11- or 29-bit identifier
+    uint8_t length;         ///< Data bytes used (0-8)
+    uint8_t data[8];        ///< Payload
+};
+
+/**
+ * @brief Vehicle signal carried by a decoded frame
+ */
+enum class CanSignal {
+    NONE,               ///< Frame carries nothing we track
+    ENGINE_TEMP,        ///< Coolant temperature in °C
+    SPEED,              ///< Vehicle speed in km/h
+    FUEL_LEVEL,         ///< Fuel tank level in percent
+    FUEL_RATE           ///< Engine fuel rate in L/h
+};
+
+/**
+ * @brief Reads candump text and decodes OBD-II mode 01 responses
+ *
+ * Accepted line formats, as written by candump from can-utils:
+ * @code
+ * (1700000000.123456) can0 7E8#03410D48      (candump -l)
+ * can0  7E8   [4]  03 41 0D 48               (candump)
+ * 7E8#03410D48                               (cansend syntax)
+ * @endcode
+ * Responses from the engine ECUs (0x7E8-0x7EF) are decoded for PIDs 0x05
+ * (coolant), 0x0D (speed), 0x2F (fuel level) and 0x5E (fuel rate).
+ */
+class CanDecoder {
+public:
+    static constexpr uint32_t OBD_RESPONSE_FIRST = 0x7E8;   ///< First ECU response ID
+    static constexpr uint32_t OBD_RESPONSE_LAST = 0x7EF;    ///< Last ECU response ID
+
+    /**
+     * @brief Parse one candump line
+     * @param line Text line
+     * @param frame Receives the frame
+     * @return False if the line is not a CAN frame in a known format
+     */
+    static bool parseCandump(std::string_view line, CanFrame& frame);
+
+    /**
+     * @brief Decode the vehicle signal in a frame
+     * @param frame Frame
+     * @param value Receives the value in the signal's unit
+     * @return Signal, or NONE if the frame is not a tracked OBD-II response
+     */
+    static CanSignal decode(const CanFrame& frame, double& value);
+};
+
+#endif // CAN_DECODER_H
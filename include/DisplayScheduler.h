@@ -0,0 +1,59 @@
+/**
+ * @file DisplayScheduler.h
+ * @brief Drives the AUTO display theme from GPS position and the clock
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef DISPLAY_SCHEDULER_H
+#define DISPLAY_SCHEDULER_H
+
+#include <cstdint>
+#include <memory>
+#include "GPSNavigator.h"
+#include "SolarSchedule.h"
+#include "SystemSettings.h"
+
+/**
+ * @brief Switches night mode and ramps brightness with the sun
+ *
+ * Only acts while the display theme is AUTO. Each tick reads the current
+ * GPS position, asks SolarSchedule how light it is and, if night mode or
+ * brightness should differ from the published settings, applies both in
+ * one settings transaction. Ticks that change nothing cost a cached
+ * sunrise/sunset comparison and a snapshot read.
+ */
+class DisplayScheduler {
+public:
+    static constexpr int DAY_BRIGHTNESS = 75;       ///< Brightness in full daylight
+    static constexpr int NIGHT_BRIGHTNESS = 30;     ///< Brightness at night
+
+private:
+    std::shared_ptr<SystemSettings> settings;       ///< Settings to drive
+    std::shared_ptr<GPSNavigator> navigator;        ///< Position source
+    SolarSchedule solar;                            ///< Cached sunrise and sunset
+
+public:
+    /**
+     * @brief Constructor
+     * @param systemSettings Settings to drive
+     * @param gps Position source
+     */
+    DisplayScheduler(std::shared_ptr<SystemSettings> systemSettings, std::shared_ptr<GPSNavigator> gps);
+
+    /**
+     * @brief Update night mode and brightness for the current moment
+     *
+     * Does nothing without a GPS fix or when the theme is not AUTO.
+     * @param now Seconds since the Unix epoch
+     * @return True if settings changed
+     */
+    bool tick(int64_t now);
+
+    /**
+     * @brief Access the solar cache
+     * @return Schedule used by tick()
+     */
+    const SolarSchedule& getSolarSchedule() const;
+};
+
+#endif // DISPLAY_SCHEDULER_H
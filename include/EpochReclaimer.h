@@ -0,0 +1,148 @@
+/**
+ * @file EpochReclaimer.h
+ * @brief Epoch-based reclamation for objects published through atomic pointers
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef EPOCH_RECLAIMER_H
+#define EPOCH_RECLAIMER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <vector>
+
+/**
+ * @brief Defers deletion of unpublished objects until no reader can hold them
+ *
+ * Readers pin the current epoch for the duration of a Guard; each reader
+ * thread owns a cache-line-sized slot, so pinning is a plain store to
+ * memory no other thread writes and never waits for a writer. A writer
+ * swaps in a new object, then retires the old one: retire() advances the
+ * epoch and the object is deleted once every pinned slot has moved past it.
+ *
+ * Reader threads beyond MAX_READER_THREADS still work, through a slower
+ * mutex-protected path.
+ */
+class EpochReclaimer {
+public:
+    static constexpr size_t MAX_READER_THREADS = 64;   ///< Threads with a lock-free slot
+
+    /**
+     * @brief Keeps the epoch pinned; objects loaded while it lives stay valid
+     */
+    class Guard {
+    private:
+        EpochReclaimer* owner;      ///< Reclaimer to unpin (nullptr once moved from)
+
+    public:
+        explicit Guard(EpochReclaimer* reclaimer);
+        Guard(Guard&& other) noexcept;
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+        ~Guard();
+    };
+
+    /**
+     * @brief Process-wide reclaimer shared by all published objects
+     * @return Reclaimer instance
+     */
+    static EpochReclaimer& instance();
+
+    EpochReclaimer(const EpochReclaimer&) = delete;
+    EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+
+    /**
+     * @brief Pin the current epoch on this thread (nestable)
+     * @return Guard that unpins when destroyed
+     */
+    Guard pin();
+
+    /**
+     * @brief Delete an object once no reader can still hold it
+     *
+     * Call after the object has been unlinked from every atomic pointer.
+     * @param object Object to delete
+     */
+    template <typename T>
+    void retire(const T* object) {
+        retire(const_cast<T*>(object), [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    /**
+     * @brief Delete an object through a callback once no reader can hold it
+     * @param object Object to delete
+     * @param destroy Deleter
+     */
+    void retire(void* object, void (*destroy)(void*));
+
+    /**
+     * @brief Delete every retired object that no reader can hold
+     */
+    void reclaim();
+
+    /**
+     * @brief Retired objects not deleted yet
+     * @return Pending count
+     */
+    size_t getPendingCount() const;
+
+private:
+    static constexpr uint64_t IDLE = UINT64_MAX;       ///< Slot value of an unpinned thread
+
+    /**
+     * @brief One reader thread's pinned epoch, on its own cache line
+     */
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> pinned{IDLE};            ///< Epoch pinned by the owning thread
+        std::atomic<bool> owned{false};                ///< Claimed by a thread
+    };
+
+    /**
+     * @brief Object waiting for readers to move on
+     */
+    struct Retired {
+        void* object;                                  ///< Object to delete
+        void (*destroy)(void*);                        ///< Deleter
+        uint64_t epoch;                                ///< First epoch in which no reader can see it
+    };
+
+    std::atomic<uint64_t> epoch;                       ///< Global epoch
+    std::array<Slot, MAX_READER_THREADS> slots;        ///< Per-thread reader slots
+    mutable std::mutex overflowMutex;                  ///< Guards overflowPins
+    std::multiset<uint64_t> overflowPins;              ///< Epochs pinned by threads without a slot
+    mutable std::mutex retireMutex;                    ///< Guards retired
+    std::vector<Retired> retired;                      ///< Objects awaiting deletion
+
+    EpochReclaimer();
+    ~EpochReclaimer();
+
+    /**
+     * @brief Pin on the calling thread (outermost Guard only)
+     */
+    void enter();
+
+    /**
+     * @brief Unpin on the calling thread (outermost Guard only)
+     */
+    void leave();
+
+    /**
+     * @brief Oldest epoch any reader has pinned
+     * @return Epoch, IDLE if no reader is pinned
+     */
+    uint64_t oldestPinned() const;
+
+    /**
+     * @brief Delete retired objects older than every pin; retireMutex must be held
+     */
+    void collectLocked();
+
+    friend struct EpochThreadState;
+};
+
+#endif // EPOCH_RECLAIMER_H
@@ -0,0 +1,210 @@
+/**
+ * @file EventBus.h
+ * @brief Typed publish/subscribe bus over a fixed set of event types
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "EpochReclaimer.h"
+#include "EventQueue.h"
+
+/**
+ * @brief Delivers events of the listed types from publishers to subscribers
+ *
+ * The event types are fixed at compile time: each has its own flat vector
+ * of handlers, found through the type rather than a lookup, and publishing
+ * or subscribing to an unlisted type does not compile. Handler vectors are
+ * copy-on-write snapshots published through an atomic pointer, so
+ * publish() takes no lock and may run on any thread; replaced vectors are
+ * freed through EpochReclaimer once no publisher can still be iterating
+ * them.
+ *
+ * A handler subscribed without a queue runs on the publishing thread
+ * before publish() returns. One subscribed with an EventQueue gets a copy
+ * of the event posted to that queue and runs when its owner drains it.
+ * Handlers may publish, subscribe and unsubscribe. An unsubscribed
+ * handler is not called for later publications, and events still waiting
+ * in its queue are dropped.
+ */
+template <typename... Events>
+class EventBus {
+public:
+    using SubscriptionId = uint32_t;                                ///< Handle returned by subscribe()
+
+    template <typename Event>
+    using Handler = std::function<void(const Event&)>;              ///< Subscriber callback
+
+    /**
+     * @brief Whether a type is one of the bus's events
+     * @return True for listed types
+     */
+    template <typename Event>
+    static constexpr bool carries() {
+        return (std::is_same_v<Event, Events> || ...);
+    }
+
+private:
+    /**
+     * @brief One subscription; shared with tasks queued for it
+     */
+    template <typename Event>
+    struct Subscriber {
+        Handler<Event> handler;             ///< Callback
+        std::atomic<bool> active{true};     ///< Cleared by unsubscribe()
+
+        explicit Subscriber(Handler<Event> callback) : handler(std::move(callback)) {}
+    };
+
+    /**
+     * @brief Entry of a handler vector
+     */
+    template <typename Event>
+    struct Entry {
+        SubscriptionId id;                                  ///< Handle for unsubscribe()
+        EventQueue* queue;                                  ///< Delivery queue, or null for direct calls
+        std::shared_ptr<Subscriber<Event>> subscriber;      ///< Handler and its active flag
+    };
+
+    template <typename Event>
+    using HandlerList = std::vector<Entry<Event>>;
+
+    /**
+     * @brief Handlers of one event type
+     */
+    template <typename Event>
+    struct Channel {
+        std::atomic<const HandlerList<Event>*> handlers{nullptr};  ///< Current snapshot (null when empty)
+    };
+
+    std::tuple<Channel<Events>...> channels;    ///< One channel per event type
+    std::mutex writeMutex;                      ///< Serializes subscribe() and unsubscribe()
+    SubscriptionId nextId = 1;                  ///< Next handle to hand out
+
+    template <typename Event>
+    Channel<Event>& channel() {
+        return std::get<Channel<Event>>(channels);
+    }
+
+    template <typename Event>
+    const Channel<Event>& channel() const {
+        return std::get<Channel<Event>>(channels);
+    }
+
+    // Replace a channel's snapshot; writeMutex must be held
+    template <typename Event>
+    static void publishList(Channel<Event>& target, const HandlerList<Event>* list) {
+        const HandlerList<Event>* previous = target.handlers.exchange(list, std::memory_order_acq_rel);
+        if (previous != nullptr) EpochReclaimer::instance().retire(previous);
+    }
+
+    // Remove a subscription from one channel if it is there; writeMutex must be held
+    template <typename Event>
+    bool removeFrom(SubscriptionId id) {
+        Channel<Event>& target = channel<Event>();
+        const HandlerList<Event>* current = target.handlers.load(std::memory_order_acquire);
+        if (current == nullptr) return false;
+        for (size_t i = 0; i < current->size(); ++i) {
+            if ((*current)[i].id != id) continue;
+            (*current)[i].subscriber->active.store(false, std::memory_order_release);
+            HandlerList<Event>* remaining = nullptr;
+            if (current->size() > 1) {
+                remaining = new HandlerList<Event>(*current);
+                remaining->erase(remaining->begin() + static_cast<std::ptrdiff_t>(i));
+            }
+            publishList(target, remaining);
+            return true;
+        }
+        return false;
+    }
+
+public:
+    EventBus() = default;
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    ~EventBus() {
+        // No publisher may still be running; snapshots are freed directly
+        (delete std::get<Channel<Events>>(channels).handlers.load(std::memory_order_acquire), ...);
+    }
+
+    /**
+     * @brief Register a handler for one event type
+     * @param handler Callback
+     * @param queue Queue to deliver through, or nullptr to run on the publishing thread
+     * @return Handle for unsubscribe()
+     */
+    template <typename Event>
+    SubscriptionId subscribe(Handler<Event> handler, EventQueue* queue = nullptr) {
+        static_assert(carries<Event>(), "event type is not registered with this bus");
+        auto subscriber = std::make_shared<Subscriber<Event>>(std::move(handler));
+
+        std::lock_guard<std::mutex> lock(writeMutex);
+        Channel<Event>& target = channel<Event>();
+        const HandlerList<Event>* current = target.handlers.load(std::memory_order_acquire);
+        auto* updated = current != nullptr ? new HandlerList<Event>(*current) : new HandlerList<Event>();
+        const SubscriptionId id = nextId++;
+        updated->push_back(Entry<Event>{id, queue, std::move(subscriber)});
+        publishList(target, updated);
+        return id;
+    }
+
+    /**
+     * @brief Remove a handler
+     * @param id Handle from subscribe()
+     * @return True if the handler was registered
+     */
+    bool unsubscribe(SubscriptionId id) {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        return (removeFrom<Events>(id) || ...);
+    }
+
+    /**
+     * @brief Deliver an event to every handler of its type
+     * @param event Event (copied for queued handlers only)
+     */
+    template <typename Event>
+    void publish(const Event& event) const {
+        static_assert(carries<Event>(), "event type is not registered with this bus");
+        const Channel<Event>& source = channel<Event>();
+        // Nobody listening: skip pinning entirely
+        if (source.handlers.load(std::memory_order_relaxed) == nullptr) return;
+
+        const EpochReclaimer::Guard guard = EpochReclaimer::instance().pin();
+        const HandlerList<Event>* list = source.handlers.load(std::memory_order_acquire);
+        if (list == nullptr) return;
+        for (const Entry<Event>& entry : *list) {
+            if (!entry.subscriber->active.load(std::memory_order_acquire)) continue;
+            if (entry.queue == nullptr) {
+                entry.subscriber->handler(event);
+            } else {
+                entry.queue->post([subscriber = entry.subscriber, event]() {
+                    if (subscriber->active.load(std::memory_order_acquire)) subscriber->handler(event);
+                });
+            }
+        }
+    }
+
+    /**
+     * @brief Number of handlers of one event type
+     * @return Subscriber count
+     */
+    template <typename Event>
+    size_t subscriberCount() const {
+        static_assert(carries<Event>(), "event type is not registered with this bus");
+        const EpochReclaimer::Guard guard = EpochReclaimer::instance().pin();
+        const HandlerList<Event>* list = channel<Event>().handlers.load(std::memory_order_acquire);
+        return list != nullptr ? list->size() : 0;
+    }
+};
+
+#endif // EVENT_BUS_H
@@ -0,0 +1,162 @@
+/**
+ * @file EventLoop.h
+ * @brief Single-threaded event loop for timers, file descriptors and posted tasks
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Dispatches timers, readable descriptors and posted tasks on one thread
+ *
+ * On Linux every source is a descriptor in one epoll set: periodic timers
+ * are timerfds and post()/stop() write to an eventfd, so the loop sleeps
+ * in a single epoll_wait until something is due and a slow source never
+ * delays the others by more than its own handler. Elsewhere timers and
+ * posted tasks are served from a condition variable wait and descriptor
+ * sources are unavailable. Regular files, which epoll cannot watch, count
+ * as always readable: they are read once per iteration between waits
+ * that do not sleep, so a recorded log is consumed at full speed while
+ * timers and other descriptors are still served.
+ *
+ * Sources are added and removed on the loop thread (or before run());
+ * handlers may remove any source, including their own. post() and stop()
+ * may be called from any thread.
+ */
+class EventLoop {
+public:
+    using SourceId = uint32_t;                                  ///< Handle of a timer or reader
+    using Callback = std::function<void()>;                     ///< Timer, reader or task handler
+    using LineCallback = std::function<void(std::string_view)>;     ///< Receives one line without '\n'
+
+    static constexpr size_t MAX_LINE_BYTES = 4096;              ///< Longer lines are cut at this size
+
+private:
+    /**
+     * @brief One timer or descriptor registration
+     */
+    struct Source {
+        int fd;                                         ///< Descriptor watched (-1 for fallback timers)
+        bool ownsFd;                                    ///< Close fd on removal (timerfds)
+        bool timer;                                     ///< Periodic timer rather than reader
+        bool alwaysReady;                               ///< Regular file outside the epoll set
+        std::chrono::milliseconds interval;             ///< Timer period
+        std::chrono::steady_clock::time_point due;      ///< Next expiry (fallback timers)
+        Callback callback;                              ///< Handler
+    };
+
+    std::unordered_map<SourceId, std::shared_ptr<Source>> sources;  ///< Active sources by handle
+    SourceId nextSourceId;                      ///< Next handle
+    size_t alwaysReadyCount;                    ///< Sources with alwaysReady set
+    int epollFd;                                ///< epoll set (-1 if unused)
+    int wakeFd;                                 ///< eventfd for post() and stop() (-1 if unused)
+    std::atomic<bool> stopping;                 ///< Set by stop(); cleared by run()
+    std::mutex taskMutex;                       ///< Guards tasks
+    std::condition_variable taskSignal;         ///< Wakes the fallback wait
+    std::vector<Callback> tasks;                ///< Posted tasks not yet run
+    std::vector<char> readBuffer;               ///< Input chunk shared by line readers
+
+    /**
+     * @brief Run and clear the posted tasks
+     * @return Number of tasks run
+     */
+    size_t runTasks();
+
+    /**
+     * @brief Dispatch one ready source
+     * @param id Source handle
+     * @return True if a handler ran
+     */
+    bool dispatch(SourceId id);
+
+public:
+    EventLoop();
+    ~EventLoop();
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    /**
+     * @brief Call a handler every interval, first after one interval
+     *
+     * Expiries missed while a handler ran are coalesced into one call.
+     * @param interval Period (at least 1 ms)
+     * @param callback Handler
+     * @return Handle, or 0 if the timer cannot be created
+     */
+    SourceId addTimer(std::chrono::milliseconds interval, Callback callback);
+
+    /**
+     * @brief Call a handler whenever a descriptor is readable or hung up
+     *
+     * The handler must consume input (or remove the source), otherwise it
+     * is called again immediately. The descriptor stays owned by the caller.
+     * @param fd Descriptor
+     * @param callback Handler
+     * @return Handle, or 0 if descriptors cannot be watched on this platform
+     */
+    SourceId addReader(int fd, Callback callback);
+
+    /**
+     * @brief Read a descriptor as text lines
+     *
+     * Each readiness notification performs one read(), so the loop never
+     * blocks on the descriptor. Complete lines go to onLine (a trailing
+     * '\r' is dropped) as views valid only during the call; end of input
+     * or a read error removes the source and calls onClosed.
+     * @param fd Descriptor
+     * @param onLine Handler for each line
+     * @param onClosed Handler for end of input (may be empty)
+     * @return Handle, or 0 if descriptors cannot be watched on this platform
+     */
+    SourceId addLineReader(int fd, LineCallback onLine, Callback onClosed);
+
+    /**
+     * @brief Stop watching a timer or descriptor
+     * @param id Handle from addTimer or addReader
+     * @return True if the source existed
+     */
+    bool removeSource(SourceId id);
+
+    /**
+     * @brief Run a task on the loop thread; safe from any thread
+     * @param task Task
+     */
+    void post(Callback task);
+
+    /**
+     * @brief Wait for sources and dispatch those that are ready
+     * @param timeout Longest wait; negative waits until something happens
+     * @return Number of handlers and tasks run
+     */
+    size_t runOnce(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Dispatch until stop() is called
+     */
+    void run();
+
+    /**
+     * @brief Make run() return after the current handler; safe from any thread
+     */
+    void stop();
+
+    /**
+     * @brief Check whether descriptor sources are supported
+     * @return True on Linux
+     */
+    static bool supportsDescriptors();
+};
+
+#endif // EVENT_LOOP_H
@@ -0,0 +1,67 @@
+/**
+ * @file EventQueue.h
+ * @brief Task queue through which one thread receives events published elsewhere
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Collects tasks from any thread and runs them on the thread that drains it
+ *
+ * Each consumer thread owns one queue; EventBus subscribers registered with
+ * a queue have their events delivered here instead of on the publishing
+ * thread. The wakeup callback runs only when the queue goes from empty to
+ * non-empty, so a burst of events costs its consumer one wakeup (an
+ * EventLoop post, for instance) rather than one per event.
+ */
+class EventQueue {
+public:
+    using Task = std::function<void()>;        ///< Queued delivery
+
+private:
+    mutable std::mutex mutex;                  ///< Guards pending and wakeup
+    std::vector<Task> pending;                 ///< Tasks not drained yet
+    std::vector<Task> running;                 ///< Batch being drained (keeps its capacity)
+    std::function<void()> wakeup;              ///< Called when the queue becomes non-empty
+
+public:
+    EventQueue() = default;
+    EventQueue(const EventQueue&) = delete;
+    EventQueue& operator=(const EventQueue&) = delete;
+
+    /**
+     * @brief Set the callback that tells the consumer to drain
+     *
+     * It runs on the posting thread, outside the queue's lock.
+     * @param callback Wakeup callback, or nullptr for a consumer that polls
+     */
+    void setWakeup(std::function<void()> callback);
+
+    /**
+     * @brief Queue a task; safe from any thread
+     * @param task Task to run on the consumer thread
+     */
+    void post(Task task);
+
+    /**
+     * @brief Run every queued task on the calling thread
+     *
+     * Tasks posted while draining wait for the next drain.
+     * @return Number of tasks run
+     */
+    size_t drain();
+
+    /**
+     * @brief Tasks waiting to be drained
+     * @return Pending count
+     */
+    size_t size() const;
+};
+
+#endif // EVENT_QUEUE_H
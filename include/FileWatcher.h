@@ -0,0 +1,81 @@
+/**
+ * @file FileWatcher.h
+ * @brief Background watch for changes to one file
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef FILE_WATCHER_H
+#define FILE_WATCHER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Calls back on a background thread whenever a file is rewritten
+ *
+ * Uses inotify on Linux. The file's directory is watched rather than the
+ * file itself, so a file replaced by rename (as writeFileContents does) is
+ * still seen, and the callback fires only once the writer has closed or
+ * renamed the file, never on a partial write. Elsewhere the modification
+ * time is polled every POLL_INTERVAL_MS.
+ */
+class FileWatcher {
+public:
+    static constexpr int POLL_INTERVAL_MS = 500;    ///< Fallback polling period
+
+private:
+    std::string directory;                  ///< Directory being watched
+    std::string fileName;                   ///< File name within directory
+    std::function<void()> onChange;         ///< Callback, run on the watcher thread
+    std::thread worker;                     ///< Watcher thread
+    std::atomic<bool> running;              ///< Cleared to stop the thread
+    int notifyFd;                           ///< inotify descriptor (-1 if unused)
+    int wakeFd[2];                          ///< Pipe that interrupts the inotify wait
+    std::mutex stopMutex;                   ///< Guards the polling fallback's wait
+    std::condition_variable stopSignal;     ///< Wakes the polling fallback on stop
+
+    /**
+     * @brief Wait for inotify events until stopped
+     */
+    void watchNotify();
+
+    /**
+     * @brief Poll the modification time until stopped
+     */
+    void watchPolling();
+
+public:
+    FileWatcher();
+    ~FileWatcher();
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    /**
+     * @brief Start watching a file, replacing any current watch
+     *
+     * The file need not exist yet; creating it counts as a change.
+     * @param path File to watch
+     * @param callback Called on the watcher thread after each change
+     * @return False if the directory cannot be watched
+     */
+    bool start(const std::string& path, std::function<void()> callback);
+
+    /**
+     * @brief Stop watching and join the watcher thread
+     *
+     * Must not be called from the callback.
+     */
+    void stop();
+
+    /**
+     * @brief Check whether a watch is active
+     * @return True between start() and stop()
+     */
+    bool isWatching() const;
+};
+
+#endif // FILE_WATCHER_H
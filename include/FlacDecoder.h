@@ -0,0 +1,151 @@
+/**
+ * @file FlacDecoder.h
+ * @brief Streaming FLAC decoder with parallel whole-file decoding
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef FLAC_DECODER_H
+#define FLAC_DECODER_H
+
+#include "AudioDecoder.h"
+#include "SeekIndex.h"
+#include <fstream>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief STREAMINFO fields the decoder needs
+ */
+struct FlacStreamInfo {
+    uint32_t minBlockSize = 0;      ///< Smallest block in samples
+    uint32_t maxBlockSize = 0;      ///< Largest block in samples
+    uint32_t maxFrameSize = 0;      ///< Largest frame in bytes (0 if unknown)
+    uint32_t sampleRate = 0;        ///< Sample rate in Hz
+    uint16_t channels = 0;          ///< Channel count (1-8)
+    uint16_t bitsPerSample = 0;     ///< Bits per sample (4-24 supported)
+    uint64_t totalSamples = 0;      ///< Frames in the stream (0 if unknown)
+};
+
+/**
+ * @brief One decoded FLAC frame
+ */
+struct FlacFrame {
+    uint64_t firstSample = 0;       ///< Stream position of the first frame
+    uint32_t blockSize = 0;         ///< Frames in this block
+    std::vector<int32_t> samples;   ///< blockSize * channels samples, interleaved
+    std::vector<int32_t> planar;    ///< Decoding scratch, one channel after another
+};
+
+/**
+ * @brief Decodes FLAC (CONSTANT, VERBATIM, FIXED and LPC subframes, all
+ * stereo decorrelation modes, CRC-checked frames)
+ *
+ * Playback decodes one frame at a time from a small read buffer, so the
+ * latency of read() is at most one frame. FLAC frames are independent, so
+ * whole-file work (decodeAll for transcoding, buildSeekIndex) splits the
+ * file into byte ranges and decodes them in parallel on the shared
+ * TaskScheduler; each range resynchronizes on its first CRC-valid frame.
+ *
+ * Seeks start from the nearest SeekIndex point. The index is seeded from the
+ * file's SEEKTABLE, grows with every frame played, and can be filled
+ * completely with buildSeekIndex().
+ *
+ * open() sizes the read buffer, the frame buffers and the seek index from
+ * STREAMINFO, so read() and seek() never allocate. They still read the
+ * file and can block on it.
+ */
+class FlacDecoder : public AudioDecoder {
+private:
+    std::ifstream file;                 ///< Open audio file
+    std::string filePath;               ///< Path, reopened by whole-file operations
+    FlacStreamInfo info;                ///< Stream parameters
+    uint64_t audioOffset;               ///< File offset of the first frame
+    uint64_t fileSize;                  ///< File size in bytes
+    std::vector<uint8_t> input;         ///< Read buffer, sized once by open()
+    size_t inputPos;                    ///< Next unread byte in input
+    size_t inputEnd;                    ///< End of the buffered bytes in input
+    uint64_t inputOffset;               ///< File offset of input[0]
+    FlacFrame frame;                    ///< Frame being served by read()
+    size_t frameCursor;                 ///< Next frame index within 'frame'
+    uint64_t position;                  ///< Next stream frame read() returns
+    float sampleScale;                  ///< Integer to [-1, 1] factor
+    SeekIndex seekIndex;                ///< Known frame positions
+
+    /**
+     * @brief Make sure at least 'bytes' bytes are buffered past inputPos
+     * @return False at end of file
+     */
+    bool fill(size_t bytes);
+
+    /**
+     * @brief Drop the buffer and continue reading at a file offset
+     */
+    void restartAt(uint64_t offset);
+
+    /**
+     * @brief Decode the frame at the read position into 'frame'
+     * @return False at end of stream
+     */
+    bool decodeNextFrame();
+
+    /**
+     * @brief Decode every frame in the file in parallel
+     * @param threads Byte ranges to decode concurrently (0 = scheduler concurrency)
+     * @param onFrame Called once per frame, possibly from a scheduler worker
+     * @return False if the file could not be read
+     */
+    bool forEachFrameParallel(unsigned threads, const std::function<void(const FlacFrame&, uint64_t)>& onFrame);
+
+public:
+    /**
+     * @brief Default constructor (no file open)
+     */
+    FlacDecoder();
+
+    bool open(const std::string& path) override;
+    size_t read(float* out, size_t frames) override;
+    bool seek(uint64_t frame) override;
+    uint64_t tell() const override;
+    uint64_t getTotalFrames() const override;
+    uint32_t getSampleRate() const override;
+    uint16_t getChannels() const override;
+
+    /**
+     * @brief Stream parameters from STREAMINFO
+     * @return Stream info
+     */
+    const FlacStreamInfo& getStreamInfo() const;
+
+    /**
+     * @brief Decode the whole file on several threads (transcoding, analysis)
+     * @param out Receives getTotalFrames() * getChannels() interleaved samples
+     * @param threads Byte ranges to decode concurrently (0 = scheduler concurrency)
+     * @return True if every frame decoded
+     */
+    bool decodeAll(std::vector<float>& out, unsigned threads = 0);
+
+    /**
+     * @brief Index every frame of the file on several threads
+     * @param threads Byte ranges to decode concurrently (0 = scheduler concurrency)
+     * @return Number of seek points
+     */
+    size_t buildSeekIndex(unsigned threads = 0);
+
+    /**
+     * @brief Number of known seek points
+     * @return Point count
+     */
+    size_t getSeekPointCount() const;
+
+    /**
+     * @brief Decode one frame from memory
+     * @param data Bytes starting at a frame sync code
+     * @param size Bytes available
+     * @param info Stream parameters
+     * @param out Receives the decoded frame; reusing one avoids allocating
+     * @return Bytes consumed, 0 if there is no valid frame at data
+     */
+    static size_t decodeFrame(const uint8_t* data, size_t size, const FlacStreamInfo& info, FlacFrame& out);
+};
+
+#endif // FLAC_DECODER_H
@@ -8,10 +8,12 @@
 #define GPS_NAVIGATOR_H
 
 #include "NotificationManager.h"
+#include "VehicleEvents.h"
 #include <memory>
 #include <string>
 #include <vector>
 #include <cmath>
+#include <functional>
 
 /**
  * @brief Structure representing GPS coordinates
@@ -64,6 +66,18 @@ enum class NavigationStatus {
     GPS_LOST        ///< GPS signal lost
 };
 
+/**
+ * @brief Enumeration for spoken navigation prompts
+ */
+enum class VoicePrompt {
+    NAVIGATION_STARTED,     ///< Route guidance has started
+    DESTINATION_REACHED,    ///< Arrived at destination
+    GPS_SIGNAL_LOST,        ///< GPS fix lost
+    GPS_SIGNAL_RESTORED     ///< GPS fix regained
+};
+
+constexpr size_t VOICE_PROMPT_COUNT = 4;    ///< Number of VoicePrompt values
+
 /**
  * @brief GPS navigation and location tracking system
  * 
@@ -82,11 +96,14 @@ private:
     int satelliteCount;                                    ///< Number of visible satellites
     double accuracy;                                       ///< GPS accuracy in meters
     std::shared_ptr<NotificationManager> notificationManager;   ///< Notification system
+    std::function<void(VoicePrompt)> voicePromptHandler;   ///< Receives spoken prompts
+    VehicleEventBus* eventBus;                              ///< Receives speed and position events (not owned, may be null)
     
     // Constants
     static constexpr double EARTH_RADIUS_KM = 6371.0;     ///< Earth radius in kilometers
     static constexpr double MIN_GPS_ACCURACY = 10.0;      ///< Minimum acceptable GPS accuracy
     static constexpr int MIN_SATELLITES = 4;              ///< Minimum satellites for good fix
+    static constexpr double SIMULATED_CRUISE_SPEED = 60.0;  ///< Speed the simulation settles at
     
     /**
      * @brief Check GPS signal quality and update status
@@ -94,12 +111,10 @@ private:
     void checkGPSSignal();
     
     /**
-     * @brief Calculate bearing between two coordinates
-     * @param from Starting coordinate
-     * @param to Ending coordinate
-     * @return Bearing in degrees (0-360)
+     * @brief Forward a voice prompt to the registered handler, if any
+     * @param prompt Prompt to speak
      */
-    double calculateBearing(const GPSCoordinate& from, const GPSCoordinate& to) const;
+    void announce(VoicePrompt prompt);
     
 public:
     /**
@@ -150,6 +165,14 @@ public:
      */
     double calculateDistance(const GPSCoordinate& coord1, const GPSCoordinate& coord2) const;
     
+    /**
+     * @brief Calculate bearing between two coordinates
+     * @param from Starting coordinate
+     * @param to Ending coordinate
+     * @return Bearing in degrees (0-360)
+     */
+    double calculateBearing(const GPSCoordinate& from, const GPSCoordinate& to) const;
+    
     /**
      * @brief Get distance to destination
      * @return Distance in kilometers, -1 if no destination set
@@ -229,6 +252,21 @@ public:
      */
     double getGPSAccuracy() const;
     
+    /**
+     * @brief Register a handler for spoken navigation prompts
+     * 
+     * The handler is called synchronously on navigation events; it should only
+     * queue the prompt (e.g. AudioFocusManager::requestPrompt).
+     * @param handler Prompt handler, or an empty function to disable prompts
+     */
+    void setVoicePromptHandler(std::function<void(VoicePrompt)> handler);
+    
+    /**
+     * @brief Publish speed and position updates on a bus
+     * @param bus Bus that outlives the navigator, or nullptr to stop publishing
+     */
+    void setEventBus(VehicleEventBus* bus);
+    
     /**
      * @brief Display current GPS status
      */
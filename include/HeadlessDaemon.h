@@ -0,0 +1,187 @@
+/**
+ * @file HeadlessDaemon.h
+ * @brief Headless runtime feeding recorded or live sensor streams through the subsystems
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef HEADLESS_DAEMON_H
+#define HEADLESS_DAEMON_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "DisplayScheduler.h"
+#include "EventLoop.h"
+#include "NotificationManager.h"
+#include "VehicleDataFeed.h"
+
+/**
+ * @brief One input stream of the daemon
+ */
+struct DaemonInput {
+    FeedFormat format;      ///< Format of the lines
+    std::string source;     ///< File or FIFO path, "-" for stdin, or "tcp:[address:]port"
+};
+
+/**
+ * @brief Command-line configuration of the daemon
+ */
+struct DaemonOptions {
+    std::vector<DaemonInput> inputs;            ///< Streams to read
+    std::string alertSink;                      ///< Alert output path, "-" for stdout, empty for none
+    std::string stateSink;                      ///< State record output path, "-" for stdout, empty for none
+    std::chrono::milliseconds stateInterval;    ///< Time between state records
+
+    DaemonOptions();
+};
+
+/**
+ * @brief Runs the vehicle subsystems without console rendering
+ *
+ * Every input is a line source on one EventLoop: regular files are read
+ * at full speed (a recorded log replays as fast as it can be parsed),
+ * FIFOs and stdin as data arrives, and TCP listeners accept any number of
+ * senders. Alerts are written as "<unix ms>\t<LEVEL>\t<message>" lines,
+ * state records as "<unix ms>\tSTATE\t<key>=<value>..." lines; both sinks
+ * are block-buffered and flushed every second.
+ *
+ * SIGUSR1 writes the throughput counters to stderr; SIGINT and SIGTERM
+ * stop the daemon, which also stops once every file input has ended.
+ * The final counters are written at exit.
+ */
+class HeadlessDaemon {
+public:
+    static constexpr size_t HISTORY_LIMIT = 1000;  ///< Notifications kept in memory
+
+private:
+    DaemonOptions options;                                  ///< Configuration
+    std::shared_ptr<NotificationManager> notificationManager;   ///< Alert source
+    std::shared_ptr<VehicleMonitor> vehicleMonitor;         ///< Vehicle state for records
+    std::shared_ptr<GPSNavigator> gpsNavigator;             ///< GPS state for records
+    std::shared_ptr<DisplayScheduler> displayScheduler;     ///< Ticked once a minute (may be null)
+    VehicleDataFeed feed;                                   ///< Parses and applies input lines
+    EventLoop loop;                                         ///< Drives inputs, timers and signals
+    std::FILE* alertOutput;                                 ///< Alert sink (null if none)
+    std::FILE* stateOutput;                                 ///< State sink (null if none)
+    std::vector<int> descriptors;                           ///< Input, listener and signal fds to close
+    size_t openInputs;                                      ///< Inputs that have not ended
+    std::atomic<uint64_t> alertCount;                       ///< Alerts written (sink may run on other threads)
+    uint64_t stateCount;                                    ///< State records written
+    uint64_t connectionCount;                               ///< TCP senders accepted
+    std::chrono::steady_clock::time_point startTime;        ///< When run() started
+
+    /**
+     * @brief Open one input and register it with the loop
+     * @param input Input
+     * @return False if it cannot be opened
+     */
+    bool openInput(const DaemonInput& input);
+
+    /**
+     * @brief Start a TCP listener whose connections deliver lines
+     * @param format Format of the lines
+     * @param endpoint "[address:]port" (address defaults to 127.0.0.1)
+     * @return False if the socket cannot be bound
+     */
+    bool listenTcp(FeedFormat format, const std::string& endpoint);
+
+    /**
+     * @brief Read lines from a descriptor until it ends
+     * @param format Format of the lines
+     * @param fd Descriptor (closed when it ends)
+     * @param countsAsInput Whether its end counts towards stopping the daemon
+     * @return False if the loop cannot watch it
+     */
+    bool addLineSource(FeedFormat format, int fd, bool countsAsInput);
+
+    /**
+     * @brief Start delivering SIGUSR1, SIGINT and SIGTERM to the loop
+     */
+    void watchSignals();
+
+    /**
+     * @brief Write one state record
+     */
+    void writeState();
+
+    /**
+     * @brief Open a sink
+     * @param target Path, or "-" for stdout
+     * @return Stream, or null if it cannot be opened
+     */
+    static std::FILE* openSink(const std::string& target);
+
+    /**
+     * @brief Flush and close a sink (stdout stays open)
+     * @param sink Stream, may be null
+     */
+    static void closeSink(std::FILE* sink);
+
+public:
+    /**
+     * @brief Constructor
+     * @param daemonOptions Configuration
+     * @param notifications Notification manager; its console output is turned off
+     * @param vehicle Vehicle monitor
+     * @param gps GPS navigator
+     * @param scheduler Display scheduler to tick, or null
+     */
+    HeadlessDaemon(DaemonOptions daemonOptions, std::shared_ptr<NotificationManager> notifications,
+                   std::shared_ptr<VehicleMonitor> vehicle, std::shared_ptr<GPSNavigator> gps,
+                   std::shared_ptr<DisplayScheduler> scheduler);
+    ~HeadlessDaemon();
+    HeadlessDaemon(const HeadlessDaemon&) = delete;
+    HeadlessDaemon& operator=(const HeadlessDaemon&) = delete;
+
+    /**
+     * @brief Read the daemon's command line
+     * @param argc Argument count
+     * @param argv Arguments; must include --headless
+     * @param parsed Receives the options
+     * @param error Receives the problem if parsing fails
+     * @return False on an unknown option, a missing value or no inputs
+     */
+    static bool parseArguments(int argc, const char* const* argv, DaemonOptions& parsed, std::string& error);
+
+    /**
+     * @brief Command-line help
+     * @return Usage text
+     */
+    static const char* usage();
+
+    /**
+     * @brief Block the daemon's signals in the calling thread and its future threads
+     *
+     * Call before any thread starts, so only the loop receives them.
+     */
+    static void blockSignals();
+
+    /**
+     * @brief Process the inputs until they end or a stop signal arrives
+     * @return Process exit code: 0, or 1 if an input or sink could not be opened
+     */
+    int run();
+
+    /**
+     * @brief Ask run() to return; safe from any thread
+     */
+    void stop();
+
+    /**
+     * @brief One-line summary of the throughput counters
+     * @return Uptime, lines, rates and rejects per format, alerts and records
+     */
+    std::string counterReport() const;
+
+    /**
+     * @brief Access the input counters
+     * @return Feed
+     */
+    const VehicleDataFeed& getFeed() const;
+};
+
+#endif // HEADLESS_DAEMON_H
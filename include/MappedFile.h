@@ -0,0 +1,68 @@
+/**
+ * @file MappedFile.h
+ * @brief Read-only memory mapping of a whole file
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Maps a file read-only so its pages load on first access
+ *
+ * Uses mmap on POSIX systems and a file mapping on Windows. Mapped pages
+ * are clean, so the kernel can drop them under memory pressure and they
+ * do not count against the process heap. Where neither is available the
+ * file is read into memory instead.
+ */
+class MappedFile {
+private:
+    const uint8_t* bytes;       ///< Start of the mapping (nullptr when closed)
+    size_t length;              ///< Mapped length
+    void* mappingHandle;        ///< Windows mapping object (unused elsewhere)
+    std::string fallback;       ///< File contents when mapping is unavailable
+
+public:
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Map a file, replacing any current mapping
+     *
+     * The mapping stays valid if the file is later replaced by rename.
+     * @param path File path
+     * @return True on success
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Release the mapping
+     */
+    void close();
+
+    /**
+     * @brief Check whether a file is mapped
+     * @return True if open
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Mapped bytes
+     * @return Start of the file contents
+     */
+    const uint8_t* data() const;
+
+    /**
+     * @brief Mapped length
+     * @return File size in bytes
+     */
+    size_t size() const;
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,238 @@
+/**
+ * @file MediaLibrary.h
+ * @brief Track storage shared by playlists, with a binary cache file
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef MEDIA_LIBRARY_H
+#define MEDIA_LIBRARY_H
+
+#include "PlayStatistics.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Stable identifier of a track in the media library
+ */
+using TrackId = uint32_t;
+
+constexpr TrackId INVALID_TRACK_ID = std::numeric_limits<TrackId>::max();   ///< No track
+
+/**
+ * @brief Structure representing a media track
+ */
+struct Track {
+    std::string title;      ///< Track title
+    std::string artist;     ///< Artist name
+    std::string album;      ///< Album name
+    int duration;           ///< Duration in seconds
+    float replayGainDb = 0.0f;  ///< Loudness normalization gain in dB
+    std::string filePath;   ///< Audio file location (empty for virtual tracks)
+
+    /**
+     * @brief Constructor for Track
+     * @param t Title
+     * @param ar Artist
+     * @param al Album
+     * @param dur Duration in seconds
+     */
+    Track(const std::string& t, const std::string& ar, const std::string& al, int dur);
+};
+
+/**
+ * @brief Owns every known Track; everything else refers to tracks by TrackId
+ *
+ * A TrackId is the track's index in the library and never changes once
+ * assigned, so playlists can be stored as plain ID arrays.
+ *
+ * In paged mode (openPaged) the tracks of the cache file stay in the
+ * memory-mapped file. Only per-track IDs, offsets, sort keys, index keys
+ * and play statistics are resident; full Track records are decoded on
+ * demand into a fixed-size LRU, so memory does not grow with browsing.
+ * Tracks added afterwards are held in memory as usual.
+ */
+class MediaLibrary {
+private:
+    using PageList = std::list<std::pair<TrackId, Track>>;
+
+    std::vector<Track> tracks;                              ///< Resident tracks (TrackId - getPagedCount())
+    std::unordered_map<uint64_t, TrackId> pathIndex;        ///< Hash of filePath -> TrackId
+    std::unordered_map<uint64_t, TrackId> recordingIndex;   ///< MetadataNormalizer::duplicateKey -> first TrackId
+    std::vector<uint64_t> sortKeys;                         ///< MetadataNormalizer::sortKey of each title
+    mutable std::vector<TrackId> titleOrder;                ///< TrackIds by title (rebuilt when stale)
+    PlayStatistics statistics;                              ///< Play counts and recency
+
+    std::unique_ptr<MappedFile> pagedFile;                  ///< Mapped cache file (paged mode only)
+    std::vector<uint32_t> recordOffsets;                    ///< File offset of each paged track record
+    uint32_t pagedVersion;                                  ///< Cache version of the mapped file
+    size_t pageCapacity;                                    ///< Paged tracks kept decoded
+    mutable PageList pageLru;                               ///< Decoded paged tracks, most recent first
+    mutable std::unordered_map<TrackId, PageList::iterator> pageIndex;  ///< TrackId -> pageLru entry
+
+    /**
+     * @brief Decode a paged track record straight from the mapping
+     * @param id Paged track ID
+     * @return Normalized track
+     */
+    Track readPagedTrack(TrackId id) const;
+
+    /**
+     * @brief Get a paged track through the LRU
+     * @param id Paged track ID
+     * @return Pointer into the LRU
+     */
+    const Track* pageIn(TrackId id) const;
+
+    /**
+     * @brief Title of a track without decoding the whole record
+     * @param id Track ID
+     * @return View into the mapping or the resident track
+     */
+    std::string_view titleOf(TrackId id) const;
+
+    /**
+     * @brief Append a normalized track and index it
+     * @param track Normalized track
+     * @param key Its duplicate key
+     * @return ID assigned to the track
+     */
+    TrackId appendTrack(Track&& track, uint64_t key);
+
+    /**
+     * @brief Find an existing track for the same file or the same recording
+     * @param track Normalized track
+     * @param key Its duplicate key
+     * @return Existing track ID, INVALID_TRACK_ID if the track is new
+     */
+    TrackId findDuplicate(const Track& track, uint64_t key) const;
+
+public:
+    static constexpr uint32_t CACHE_MAGIC = 0x42494C56;     ///< "VLIB"
+    static constexpr uint32_t CACHE_VERSION = 2;            ///< Cache format version (v2 adds play statistics)
+    static constexpr size_t MIN_PAGE_CAPACITY = 8;          ///< Smallest LRU accepted by openPaged
+
+    MediaLibrary();
+
+    /**
+     * @brief Add a track; its tags are normalized but duplicates are kept
+     * @param track Track to add
+     * @return ID assigned to the track
+     */
+    TrackId addTrack(const Track& track);
+
+    /**
+     * @brief Add the results of a media scan, skipping duplicates
+     *
+     * Tags are normalized and hashed in parallel. A scanned track is a
+     * duplicate if its file is already in the library, or if a track
+     * with the same title, artist (ignoring case) and duration exists;
+     * this includes earlier entries of the same batch.
+     * @param scanned Scanned tracks
+     * @param threads Most slices normalized concurrently (0 = scheduler concurrency)
+     * @return Track ID of each scanned entry, in order; duplicates map to the existing track
+     */
+    std::vector<TrackId> addScannedTracks(std::vector<Track> scanned, unsigned threads = 0);
+
+    /**
+     * @brief Look up a track
+     *
+     * In paged mode a paged track's pointer stays valid until the library
+     * changes or MIN_PAGE_CAPACITY - 1 other paged tracks have been looked
+     * up; copy the track to keep it longer.
+     * @param id Track ID
+     * @return Pointer to the track, nullptr if the ID is unknown
+     */
+    const Track* getTrack(TrackId id) const;
+
+    /**
+     * @brief Track IDs ordered by title, ignoring ASCII case
+     * @param first Position of the first ID to return
+     * @param count Maximum number of IDs
+     * @return IDs at positions [first, first + count) of the title order
+     */
+    std::vector<TrackId> browseByTitle(size_t first, size_t count) const;
+
+    /**
+     * @brief Find a track by its file path
+     * @param path File path
+     * @return Track ID, INVALID_TRACK_ID if not found
+     */
+    TrackId findByPath(const std::string& path) const;
+
+    /**
+     * @brief Count one play of a track
+     * @param id Track played
+     */
+    void recordPlay(TrackId id);
+
+    /**
+     * @brief Get play counts and recency
+     * @return Statistics
+     */
+    const PlayStatistics& getStatistics() const;
+
+    /**
+     * @brief Number of tracks
+     * @return Track count
+     */
+    size_t size() const;
+
+    /**
+     * @brief Remove all tracks (invalidates every TrackId)
+     */
+    void clear();
+
+    /**
+     * @brief Save the library cache file
+     * @param path Destination file
+     * @return True on success
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Load the library cache file, replacing current contents
+     *
+     * Version 1 files load with empty statistics.
+     * @param path Source file
+     * @return True on success; the library is unchanged on failure
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief Map the library cache file and page tracks in on demand
+     *
+     * The file is scanned once to index its records. Saving over the
+     * mapped file is safe because saves replace the file by rename.
+     * @param path Source file
+     * @param cachedTracks Decoded tracks kept in the LRU (at least MIN_PAGE_CAPACITY)
+     * @return True on success; the library is unchanged on failure
+     */
+    bool openPaged(const std::string& path, size_t cachedTracks);
+
+    /**
+     * @brief Check whether tracks are paged from a mapped file
+     * @return True in paged mode
+     */
+    bool isPaged() const;
+
+    /**
+     * @brief Number of tracks served from the mapped file
+     * @return Paged track count (0 when fully resident)
+     */
+    size_t getPagedCount() const;
+
+    /**
+     * @brief Number of paged tracks currently decoded
+     * @return LRU size
+     */
+    size_t getCachedTrackCount() const;
+};
+
+#endif // MEDIA_LIBRARY_H
@@ -9,8 +9,18 @@
 
 #include <string>
 #include <vector>
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <atomic>
+#include <mutex>
 #include "NotificationManager.h"
+#include "MediaLibrary.h"
+#include "Playlist.h"
+#include "PlaybackQueue.h"
+#include "AudioDSP.h"
+#include "ArtworkCache.h"
+#include "AudioDecoder.h"
 
 /**
  * @brief Enumeration for media player states
@@ -21,25 +31,6 @@ enum class PlayerState {
     PAUSED      ///< Player is paused
 };
 
-/**
- * @brief Structure representing a media track
- */
-struct Track {
-    std::string title;      ///< Track title
-    std::string artist;     ///< Artist name
-    std::string album;      ///< Album name
-    int duration;           ///< Duration in seconds
-    
-    /**
-     * @brief Constructor for Track
-     * @param t Title
-     * @param ar Artist
-     * @param al Album
-     * @param dur Duration in seconds
-     */
-    Track(const std::string& t, const std::string& ar, const std::string& al, int dur);
-};
-
 /**
  * @brief Media player for infotainment system
  * 
@@ -47,14 +38,89 @@ struct Track {
  */
 class MediaPlayer {
 private:
-    std::vector<Track> playlist;                            ///< Current playlist
-    int currentTrackIndex;                                  ///< Index of current track
-    PlayerState state;                                      ///< Current player state
+    MediaLibrary library;                                   ///< All known tracks
+    size_t libraryCacheLimit;                               ///< Paged-library LRU size (0 = fully resident)
+    Playlist playlist;                                      ///< Current playlist (library IDs)
+    size_t currentTrackIndex;                               ///< Index of current track
+    PlaybackQueue queue;                                    ///< Shuffle/repeat/play-next ordering
+    std::atomic<PlayerState> state;                         ///< Current player state (read by the audio thread)
     int volume;                                             ///< Volume level (0-100)
-    int currentPosition;                                    ///< Current position in track (seconds)
+    TrackId audioTrack;                                     ///< Track the decoder and clock belong to
+    std::unique_ptr<AudioDecoder> decoder;                  ///< Source of the current track (nullptr for virtual tracks)
+    std::mutex decoderMutex;                                ///< Held while the decoder is swapped or read
+    std::vector<float> decodeBuffer;                        ///< Decoder output before channel mapping (MAX_DECODE_FRAMES)
+    std::unique_ptr<AudioDecoder> fadingDecoder;            ///< Previous track's source, kept until the next track change
+    size_t fadeFramesRemaining;                             ///< Crossfade frames still to render (guarded by decoderMutex)
+    std::vector<float> fadeBuffer;                          ///< Outgoing track's audio during a crossfade (MAX_DECODE_FRAMES)
+    std::atomic<uint64_t> positionFrames;                   ///< Frames of the current track played so far
+    std::atomic<uint64_t> trackFrames;                      ///< Length of the current track in frames
+    std::atomic<uint64_t> pendingSeek;                      ///< Seek target for the audio thread, NO_SEEK if none
+    std::atomic<bool> trackEnded;                           ///< Set by the audio thread near the end of the current track
+    AudioDSP dsp;                                           ///< Volume/EQ/loudness stage (audio thread only)
+    std::atomic<int> dspVolume;                             ///< Volume for the audio thread to apply
+    std::atomic<float> dspLoudnessDb;                       ///< Track gain for the audio thread to apply
+    std::array<std::atomic<float>, AudioDSP::EQ_BANDS> dspEqDb; ///< EQ band gains for the audio thread to apply
+    std::atomic<uint32_t> dspChanges;                       ///< Bits of the dsp* values not applied yet
+    std::shared_ptr<ArtworkCache> artworkCache;             ///< Album art thumbnails (optional)
     std::shared_ptr<NotificationManager> notificationManager;   ///< Notification system
     
+    /**
+     * @brief Apply per-track settings (loudness gain) after a track change
+     */
+    void applyTrackGain();
+    
+    /**
+     * @brief Hand a changed DSP parameter to the audio thread
+     * @param bit Bit of the parameter in dspChanges
+     */
+    void publishDspChange(uint32_t bit);
+    
+    /**
+     * @brief Apply parameters published since the last block to dsp (audio thread)
+     */
+    void applyDspChanges();
+    
+    /**
+     * @brief Open the current track's audio source and reset the playback clock
+     */
+    void loadTrackAudio();
+    
+    /**
+     * @brief Decode frames into an interleaved AUDIO_CHANNELS buffer (audio thread)
+     * @param source Decoder to read from
+     * @param out Destination buffer
+     * @param frames Frames wanted
+     * @return Frames decoded (fewer at the end of the stream)
+     */
+    size_t decodeFrames(AudioDecoder& source, float* out, size_t frames);
+    
+    /**
+     * @brief Fade the previous track out under the current one (audio thread)
+     * @param buffer Current track's audio, replaced by the mix
+     * @param frames Number of frames
+     */
+    void mixOutgoingTrack(float* buffer, size_t frames);
+    
+    /**
+     * @brief Resolve a playlist position to its library track
+     * @param position Zero-based playlist position
+     * @return Track, nullptr if out of range
+     */
+    const Track* trackAt(size_t position) const;
+    
+    /**
+     * @brief Rebuild play order after the playlist was edited or replaced
+     * 
+     * Clears shuffle history and the play-next queue, whose indices refer
+     * to the old order. Playback continues if the current track is unchanged.
+     */
+    void playlistChanged();
+    
 public:
+    static constexpr uint64_t NO_SEEK = UINT64_MAX;         ///< pendingSeek value when no seek is queued
+    static constexpr size_t MAX_DECODE_FRAMES = 4096;       ///< Frames decoded per read; larger blocks take several
+    static constexpr size_t CROSSFADE_FRAMES = AUDIO_SAMPLE_RATE / 2;   ///< Overlap when the track changes while playing or ends
+    
     /**
      * @brief Constructor with notification manager
      * @param notifManager Shared pointer to notification manager
@@ -62,10 +128,124 @@ public:
     explicit MediaPlayer(std::shared_ptr<NotificationManager> notifManager);
     
     /**
-     * @brief Add a track to the playlist
+     * @brief Add a track to the library and append it to the playlist
      * @param track Track to add
+     * @return Library ID of the new track
+     */
+    TrackId addTrack(const Track& track);
+    
+    /**
+     * @brief Add media scan results to the library and append new tracks to the playlist
+     *
+     * Duplicates (same file, or same title, artist and duration) are skipped.
+     * @param scanned Scanned tracks
+     * @return Number of tracks added
+     */
+    size_t addScannedTracks(std::vector<Track> scanned);
+    
+    /**
+     * @brief Insert a library track into the playlist
+     * @param position Insert position (playlist size appends)
+     * @param id Library track ID
+     * @return True on success
+     */
+    bool insertTrack(size_t position, TrackId id);
+    
+    /**
+     * @brief Move a playlist entry
+     * @param from Current position
+     * @param to Destination position
+     * @return True on success
+     */
+    bool moveTrack(size_t from, size_t to);
+    
+    /**
+     * @brief Remove a playlist entry (the track stays in the library)
+     * @param position Entry position
+     * @return True on success
+     */
+    bool removeTrack(size_t position);
+    
+    /**
+     * @brief Get number of playlist entries
+     * @return Playlist size
+     */
+    size_t getPlaylistSize() const;
+    
+    /**
+     * @brief Get the media library
+     * @return Library reference
+     */
+    const MediaLibrary& getLibrary() const;
+    
+    /**
+     * @brief Save the media library cache
+     * @param path Destination file
+     * @return True on success
+     */
+    bool saveLibrary(const std::string& path);
+    
+    /**
+     * @brief Load the media library cache; clears the playlist
+     *
+     * With a library cache limit set, the file is mapped and tracks are
+     * paged in on demand instead of being loaded.
+     * @param path Source file
+     * @return True on success
+     */
+    bool loadLibrary(const std::string& path);
+    
+    /**
+     * @brief Bound the memory used for library track metadata (low-RAM units)
+     * @param cachedTracks Decoded tracks to keep for the next loadLibrary (0 = load everything)
+     */
+    void setLibraryCacheLimit(size_t cachedTracks);
+    
+    /**
+     * @brief Save the playlist in the compact binary format
+     * @param path Destination file
+     * @return True on success
+     */
+    bool savePlaylist(const std::string& path);
+    
+    /**
+     * @brief Load a binary playlist saved against the current library
+     * @param path Source file
+     * @return True on success
+     */
+    bool loadPlaylist(const std::string& path);
+    
+    /**
+     * @brief Export the playlist as M3U8
+     * @param path Destination file
+     * @return True on success
+     */
+    bool exportPlaylist(const std::string& path);
+    
+    /**
+     * @brief Import an M3U8 playlist, resolving entries in the library
+     * @param path Source file
+     * @return True if at least one entry was imported
+     */
+    bool importPlaylist(const std::string& path);
+    
+    /**
+     * @brief Attach the album art cache
+     * @param cache Artwork cache, nullptr to disable artwork
+     */
+    void setArtworkCache(std::shared_ptr<ArtworkCache> cache);
+    
+    /**
+     * @brief Import artwork for library tracks that are not in the cache yet
+     * @return Number of thumbnails added
+     */
+    size_t scanArtwork();
+    
+    /**
+     * @brief Get the thumbnail for the current track
+     * @return Thumbnail, nullptr if there is none
      */
-    void addTrack(const Track& track);
+    std::shared_ptr<const Thumbnail> getCurrentArtwork() const;
     
     /**
      * @brief Start playing current track
@@ -92,6 +272,68 @@ public:
      */
     void previousTrack();
     
+    /**
+     * @brief Enable or disable shuffle
+     * @param enabled True to shuffle the playlist
+     */
+    void setShuffle(bool enabled);
+    
+    /**
+     * @brief Check if shuffle is enabled
+     * @return True if shuffle is active
+     */
+    bool isShuffleEnabled() const;
+    
+    /**
+     * @brief Set repeat mode
+     * @param mode Repeat mode to apply
+     */
+    void setRepeatMode(RepeatMode mode);
+    
+    /**
+     * @brief Get repeat mode
+     * @return Current repeat mode
+     */
+    RepeatMode getRepeatMode() const;
+    
+    /**
+     * @brief Play a playlist entry right after the current track
+     * @param index Zero-based playlist index
+     */
+    void playNext(size_t index);
+    
+    /**
+     * @brief Append a playlist entry to the play-next queue
+     * @param index Zero-based playlist index
+     */
+    void addToQueue(size_t index);
+    
+    /**
+     * @brief Advance when the current track finishes on its own
+     * 
+     * Honors the repeat mode; stops playback at the end of the playlist
+     * when repeat is off.
+     */
+    void trackFinished();
+    
+    /**
+     * @brief Advance if the audio thread has reached the end of the current track
+     * 
+     * The audio callback only flags the end; call this periodically from
+     * the control thread (e.g. an event loop timer) so trackFinished() runs
+     * there. Tracks with audio are flagged CROSSFADE_FRAMES before their
+     * end, so the next track fades in over the tail; the last track of the
+     * playlist plays out in full.
+     * @return True if the end of the track was handled
+     */
+    bool pollTrackEnd();
+    
+    /**
+     * @brief Get index of the current track
+     * @return Zero-based playlist index
+     */
+    size_t getCurrentTrackIndex() const;
+    
     /**
      * @brief Set volume level
      * @param vol Volume level (0-100)
@@ -104,6 +346,65 @@ public:
      */
     int getVolume() const;
     
+    /**
+     * @brief Set gain of one equalizer band
+     * @param band Band index (0 = lowest, see AudioDSP::EQ_BANDS)
+     * @param gainDb Boost/cut in dB
+     */
+    void setEqualizerBand(size_t band, float gainDb);
+    
+    /**
+     * @brief Render the next block of output audio
+     * 
+     * Called from the audio output callback. Fills an interleaved
+     * AUDIO_CHANNELS buffer and runs it through the DSP chain; renders
+     * silence while stopped or paused. Volume, EQ and track gain changes
+     * made since the previous block take effect at the start of this one;
+     * nearing the end of the track is flagged for pollTrackEnd(). After a
+     * track change during playback the previous track is crossfaded out
+     * over CROSSFADE_FRAMES.
+     *
+     * Not hard real-time safe: nothing is allocated here and no lock is
+     * waited on, but the decoders read the track file on this thread, so
+     * a slow read can block it. Give the output device enough buffering
+     * to ride out a storage stall.
+     * @param buffer Destination buffer (frames * AUDIO_CHANNELS floats)
+     * @param frames Number of frames to render
+     */
+    void renderAudio(float* buffer, size_t frames);
+    
+    /**
+     * @brief Seek within the current track
+     * 
+     * Safe to call while the audio thread renders: the new position is
+     * published immediately and the decoder is repositioned at the start of
+     * the next rendered block.
+     * @param seconds Target position (clamped to the track length)
+     * @return False if there is no current track
+     */
+    bool seek(double seconds);
+    
+    /**
+     * @brief Playback position of the current track
+     * 
+     * Derived from the frames the audio callback has consumed; lock-free,
+     * so the UI can poll it at any rate.
+     * @return Position in seconds
+     */
+    double getPosition() const;
+    
+    /**
+     * @brief Playback position of the current track in frames
+     * @return Frames played
+     */
+    uint64_t getPositionFrames() const;
+    
+    /**
+     * @brief Length of the current track
+     * @return Length in seconds (from the decoder, or the track metadata)
+     */
+    double getTrackLength() const;
+    
     /**
      * @brief Get current player state
      * @return Current state
@@ -120,6 +421,12 @@ public:
      */
     void displayPlaylist() const;
     
+    /**
+     * @brief Display most played and recently played tracks
+     * @param count Entries per list
+     */
+    void displayStatistics(size_t count = 5) const;
+    
     /**
      * @brief Get current track if available
      * @return Pointer to current track, nullptr if no track
@@ -0,0 +1,174 @@
+/**
+ * @file MessageCatalog.h
+ * @brief Localized user-facing messages looked up by integer ID
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef MESSAGE_CATALOG_H
+#define MESSAGE_CATALOG_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "MappedFile.h"
+
+/**
+ * @brief Every user-facing message; the value indexes the catalog tables
+ *
+ * Append new IDs before MESSAGE_COUNT and give them an English text and
+ * a name in MessageCatalog.cpp; the order is part of the catalog file.
+ */
+enum class MessageId : uint16_t {
+    GPS_INVALID_COORDINATES,    ///< Invalid GPS fix received
+    GPS_DESTINATION_REACHED,    ///< Arrived at destination
+    GPS_INVALID_DESTINATION,    ///< Destination rejected
+    GPS_DESTINATION_SET,        ///< {0} name, {1} coordinates
+    GPS_NO_DESTINATION,         ///< Navigation started without destination
+    GPS_SIGNAL_UNAVAILABLE,     ///< Navigation started without fix
+    GPS_NAVIGATION_STARTED,     ///< {0} distance km, {1} ETA minutes
+    GPS_NAVIGATION_STOPPED,     ///< Navigation stopped
+    GPS_INVALID_WAYPOINT,       ///< Waypoint rejected
+    GPS_WAYPOINT_ADDED,         ///< {0} waypoint name
+    GPS_SIGNAL_LOST,            ///< Fix lost
+    GPS_SIGNAL_RESTORED,        ///< Fix regained
+    ENGINE_OVERHEATING,         ///< {0} temperature, {1} limit
+    ENGINE_TEMPERATURE_HIGH,    ///< {0} temperature
+    FUEL_CRITICAL,              ///< {0} fuel percent
+    FUEL_LOW,                   ///< {0} fuel percent
+    SPEED_LIMIT_EXCEEDED,       ///< {0} speed, {1} limit
+    BRAKES_WORN,                ///< {0} wear percent
+    SYSTEM_CHECK_OK,            ///< System check passed
+    ALERT_CRITICAL_BANNER,      ///< {0} message
+    ALERT_WARNING_BANNER,       ///< {0} message
+    NOTIFICATIONS_EMPTY,        ///< Notification center is empty
+    NOTIFICATION_CENTER_TITLE,  ///< Notification center heading
+    NOTIFICATIONS_CLEARED,      ///< Notification center cleared
+    NOTIFICATION_SOUNDS_ON,     ///< Sounds enabled
+    NOTIFICATION_SOUNDS_OFF,    ///< Sounds disabled
+    MESSAGE_COUNT               ///< Number of messages (not a message)
+};
+
+/**
+ * @brief Process-wide table of user-facing text in every language
+ *
+ * Translations are compiled from the plain-text sources in a locale
+ * directory into one binary catalog (per-language offset tables followed
+ * by NUL-terminated UTF-8 strings), which is memory-mapped at startup.
+ * Loading resolves every (language, message) pair to a string pointer,
+ * falling back to the built-in English text, so text() is one atomic load
+ * and one array index with no hashing. setLanguage() swaps the active
+ * table pointer, so components pick up the new language on their next
+ * message without being restarted.
+ */
+class MessageCatalog {
+public:
+    static constexpr uint32_t CATALOG_MAGIC = 0x47534D56;       ///< "VMSG"
+    static constexpr uint32_t CATALOG_VERSION = 1;              ///< Catalog file format version
+    static constexpr size_t LANGUAGE_COUNT = 5;                 ///< Same order as the Language enum
+    static constexpr size_t MESSAGE_COUNT = static_cast<size_t>(MessageId::MESSAGE_COUNT);  ///< Messages per language
+
+private:
+    std::unique_ptr<MappedFile> mapping;                        ///< Loaded catalog file (nullptr if none)
+    std::vector<const char*> tables;                            ///< LANGUAGE_COUNT x MESSAGE_COUNT text pointers
+    std::atomic<const char* const*> active;                     ///< Row of tables for the current language
+    std::atomic<size_t> language;                               ///< Index of the current language
+
+    MessageCatalog();
+
+public:
+    /**
+     * @brief Catalog shared by all components
+     * @return Catalog instance
+     */
+    static MessageCatalog& instance();
+
+    MessageCatalog(const MessageCatalog&) = delete;
+    MessageCatalog& operator=(const MessageCatalog&) = delete;
+
+    /**
+     * @brief Map a compiled catalog file
+     *
+     * Call at startup, before other threads look up messages: the file
+     * being replaced invalidates text pointers handed out earlier. A
+     * missing or damaged file leaves every language on English.
+     * @param path Catalog file
+     * @return True if the file was valid
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief Switch the language used by text() and format()
+     * @param index Language index (Language enum value)
+     */
+    void setLanguage(size_t index);
+
+    /**
+     * @brief Current language
+     * @return Language index
+     */
+    size_t getLanguage() const;
+
+    /**
+     * @brief Text of a message in the current language
+     * @param id Message
+     * @return NUL-terminated UTF-8 text, valid until the next load()
+     */
+    const char* text(MessageId id) const;
+
+    /**
+     * @brief Text with {0}, {1}, ... replaced by arguments
+     * @param id Message
+     * @param args Replacement values
+     * @return Formatted text
+     */
+    std::string format(MessageId id, std::initializer_list<std::string_view> args) const;
+
+    /**
+     * @brief Built-in English text of a message
+     * @param id Message
+     * @return English text
+     */
+    static const char* englishText(MessageId id);
+
+    /**
+     * @brief Stable name of a message as used in locale sources
+     * @param id Message
+     * @return Name such as "GPS_SIGNAL_LOST"
+     */
+    static const char* messageName(MessageId id);
+
+    /**
+     * @brief Locale source file code for a language
+     * @param index Language index
+     * @return Code such as "es"
+     */
+    static const char* languageCode(size_t index);
+
+    /**
+     * @brief Build a catalog file from locale sources
+     *
+     * Reads <localeDir>/<code>.txt for every language except English,
+     * one "NAME=text" line per message ('#' starts a comment). English
+     * comes from the built-in table; messages missing from a source fall
+     * back to English at load time.
+     * @param localeDir Directory of locale sources
+     * @param path Catalog file to write
+     * @return False if a source names an unknown message or the file cannot be written
+     */
+    static bool compile(const std::string& localeDir, const std::string& path);
+};
+
+/**
+ * @brief Format a number with a fixed number of decimals for messages
+ * @param value Number
+ * @param decimals Digits after the decimal point
+ * @return Text such as "12.5"
+ */
+std::string formatFixed(double value, int decimals);
+
+#endif // MESSAGE_CATALOG_H
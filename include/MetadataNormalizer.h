@@ -0,0 +1,85 @@
+/**
+ * @file MetadataNormalizer.h
+ * @brief Cleans up scanned track tags and derives duplicate-detection keys
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef METADATA_NORMALIZER_H
+#define METADATA_NORMALIZER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Track;
+
+/**
+ * @brief Normalizes tag text so the same recording compares equal
+ *
+ * Display text keeps its case but is trimmed, has runs of whitespace
+ * collapsed, and spells every "featuring" variant ("feat.", "Feat",
+ * "featuring", "ft" ...) as "ft.". Comparisons additionally fold case.
+ * Case folding covers ASCII only; other UTF-8 bytes compare verbatim.
+ */
+class MetadataNormalizer {
+public:
+    /**
+     * @brief Normalize one tag value for display
+     * @param text Raw tag text
+     * @return Trimmed, whitespace-collapsed text with canonical "ft."
+     */
+    static std::string normalizeText(const std::string& text);
+
+    /**
+     * @brief Normalize title, artist and album of a track in place
+     * @param track Track to clean up
+     */
+    static void normalize(Track& track);
+
+    /**
+     * @brief Hash of the case-folded title, artist and duration
+     *
+     * Expects a normalized track. Equal keys mean "probably the same
+     * recording"; confirm with sameRecording().
+     * @param track Normalized track
+     * @return 64-bit key
+     */
+    static uint64_t duplicateKey(const Track& track);
+
+    /**
+     * @brief Compare two normalized tracks ignoring ASCII case
+     * @param a First track
+     * @param b Second track
+     * @return True if title, artist and duration match
+     */
+    static bool sameRecording(const Track& a, const Track& b);
+
+    /**
+     * @brief Case-folded 8-byte prefix of a text, ordered like the text
+     *
+     * Comparing keys as integers matches comparing the first eight folded
+     * bytes; equal keys need compareFolded() to break the tie.
+     * @param text Text to key
+     * @return Big-endian packed prefix
+     */
+    static uint64_t sortKey(std::string_view text);
+
+    /**
+     * @brief Three-way comparison ignoring ASCII case
+     * @param a First text
+     * @param b Second text
+     * @return Negative, zero or positive like strcmp
+     */
+    static int compareFolded(std::string_view a, std::string_view b);
+
+    /**
+     * @brief Normalize a batch of tracks and compute their keys in parallel
+     * @param tracks Tracks to normalize in place
+     * @param threads Most slices processed concurrently (0 = scheduler concurrency)
+     * @return duplicateKey() of each track, in order
+     */
+    static std::vector<uint64_t> normalizeAll(std::vector<Track>& tracks, unsigned threads = 0);
+};
+
+#endif // METADATA_NORMALIZER_H
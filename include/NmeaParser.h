@@ -0,0 +1,61 @@
+/**
+ * @file NmeaParser.h
+ * @brief Parser for NMEA 0183 position sentences from GPS receivers
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef NMEA_PARSER_H
+#define NMEA_PARSER_H
+
+#include <string_view>
+
+/**
+ * @brief Fields read from one NMEA sentence
+ *
+ * Each group is only meaningful when its flag is set: RMC sentences carry
+ * position, speed and course, GGA sentences position, altitude and fix
+ * quality.
+ */
+struct NmeaFix {
+    bool hasPosition;       ///< latitude/longitude are valid
+    double latitude;        ///< Degrees, south negative
+    double longitude;       ///< Degrees, west negative
+    bool hasAltitude;       ///< altitude is valid
+    double altitude;        ///< Meters above mean sea level
+    bool hasMotion;         ///< speedKmh/course are valid
+    double speedKmh;        ///< Speed over ground in km/h
+    double course;          ///< Course over ground in degrees (0 if not reported)
+    bool hasQuality;        ///< satellites/accuracy are valid
+    int satellites;         ///< Satellites used in the fix
+    double accuracy;        ///< Estimated horizontal accuracy in meters
+};
+
+/**
+ * @brief Decodes $--RMC and $--GGA sentences from any talker (GP, GN, GL...)
+ *
+ * The parser works in place on the sentence text and never allocates.
+ * Sentences must carry a valid "*hh" checksum; RMC sentences with a void
+ * status and GGA sentences without a fix are accepted but yield no position.
+ */
+class NmeaParser {
+public:
+    static constexpr double KNOTS_TO_KMH = 1.852;      ///< Speed conversion
+    static constexpr double METERS_PER_HDOP = 5.0;     ///< Typical receiver error at HDOP 1
+
+    /**
+     * @brief Parse one sentence
+     * @param sentence Text from '$' to the checksum; trailing blanks are ignored
+     * @param fix Receives the fields (reset first)
+     * @return False if the sentence is malformed, fails its checksum or is not RMC/GGA
+     */
+    static bool parse(std::string_view sentence, NmeaFix& fix);
+
+    /**
+     * @brief Verify the "*hh" checksum of a sentence
+     * @param sentence Text from '$' to the checksum
+     * @return True if present and matching
+     */
+    static bool checksumValid(std::string_view sentence);
+};
+
+#endif // NMEA_PARSER_H
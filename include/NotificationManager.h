@@ -8,8 +8,11 @@
 #define NOTIFICATION_MANAGER_H
 
 #include <string>
-#include <vector>
+#include <mutex>
+#include <deque>
 #include <chrono>
+#include <cstddef>
+#include <functional>
 #include <iostream>
 
 /**
@@ -45,8 +48,12 @@ struct Notification {
  */
 class NotificationManager {
 private:
-    std::vector<Notification> notifications;    ///< Storage for all notifications
+    std::deque<Notification> notifications;     ///< Stored notifications, oldest first
     bool soundEnabled;                          ///< Whether alert sounds are enabled
+    bool consoleOutput;                         ///< Whether alerts and status lines are printed
+    size_t historyLimit;                        ///< Notifications kept (0 = unlimited)
+    std::function<void(const Notification&)> sink;  ///< Receives every new notification
+    mutable std::mutex mutex;                   ///< Guards all of the above; background reloads post too
     
 public:
     /**
@@ -84,12 +91,39 @@ public:
      */
     int getNotificationCount() const;
     
+    /**
+     * @brief Get the text of the most recent notification
+     * @return Message text, or an empty string if there are none
+     */
+    std::string getLatestMessage() const;
+    
     /**
      * @brief Enable or disable notification sounds
      * @param enabled True to enable sounds, false to disable
      */
     void setSoundEnabled(bool enabled);
     
+    /**
+     * @brief Enable or disable console printing (headless mode turns it off)
+     * @param enabled True to print alerts and status lines
+     */
+    void setConsoleOutput(bool enabled);
+    
+    /**
+     * @brief Bound the stored history, dropping the oldest notifications
+     * @param limit Notifications kept (0 = unlimited)
+     */
+    void setHistoryLimit(size_t limit);
+    
+    /**
+     * @brief Forward every new notification, e.g. to an output file
+     *
+     * The sink runs under the manager's lock, in the order notifications
+     * arrive, and must not call back into the manager.
+     * @param callback Receiver (empty to remove)
+     */
+    void setSink(std::function<void(const Notification&)> callback);
+    
     /**
      * @brief Check if there are any critical alerts
      * @return True if critical alerts exist, false otherwise
@@ -0,0 +1,114 @@
+/**
+ * @file PlayStatistics.h
+ * @brief Per-track play counts and recency, kept ordered for top-K views
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef PLAY_STATISTICS_H
+#define PLAY_STATISTICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using TrackId = uint32_t;
+
+/**
+ * @brief Play counters with "most played" and "recently played" indexes
+ *
+ * Both indexes are updated in O(1) per play, so the views cost O(K) and
+ * never scan the library:
+ * - byCount holds every TrackId sorted by play count, descending, with
+ *   equal counts contiguous. A play swaps the track to the front of its
+ *   count group, then moves the group boundary past it.
+ * - recency is an intrusive doubly-linked list over TrackIds; a play
+ *   unlinks the track and pushes it to the head.
+ */
+class PlayStatistics {
+private:
+    std::vector<uint32_t> playCounts;                   ///< Plays per TrackId
+    std::vector<TrackId> byCount;                       ///< TrackIds, most played first
+    std::vector<size_t> countPosition;                  ///< TrackId -> index in byCount
+    std::unordered_map<uint32_t, size_t> groupStart;    ///< Play count -> first index of that group
+    std::vector<TrackId> recentPrev;                    ///< Recency list links toward the head
+    std::vector<TrackId> recentNext;                    ///< Recency list links toward the tail
+    TrackId recentHead;                                 ///< Most recently played track
+    size_t recentSize;                                  ///< Tracks in the recency list
+
+    /**
+     * @brief Unlink a track from the recency list if it is in it
+     */
+    void unlinkRecent(TrackId id);
+
+    /**
+     * @brief Link a track at the head of the recency list
+     */
+    void pushRecent(TrackId id);
+
+public:
+    /**
+     * @brief Constructor (no tracks)
+     */
+    PlayStatistics();
+
+    /**
+     * @brief Grow to cover newly added tracks (with zero plays)
+     * @param trackCount New library size
+     */
+    void resize(size_t trackCount);
+
+    /**
+     * @brief Count one play of a track and make it the most recent
+     * @param id Track played
+     */
+    void recordPlay(TrackId id);
+
+    /**
+     * @brief Get a track's play count
+     * @param id Track ID
+     * @return Number of plays (0 for unknown IDs)
+     */
+    uint32_t getPlayCount(TrackId id) const;
+
+    /**
+     * @brief Most played tracks
+     * @param k Maximum number of results
+     * @return Up to k played tracks, highest count first
+     */
+    std::vector<TrackId> mostPlayed(size_t k) const;
+
+    /**
+     * @brief Recently played tracks
+     * @param k Maximum number of results
+     * @return Up to k tracks, most recent first
+     */
+    std::vector<TrackId> recentlyPlayed(size_t k) const;
+
+    /**
+     * @brief Number of tracks played at least once
+     * @return Track count
+     */
+    size_t getPlayedCount() const;
+
+    /**
+     * @brief Play counts of every track, indexed by TrackId
+     * @return Counter array
+     */
+    const std::vector<uint32_t>& getPlayCounts() const;
+
+    /**
+     * @brief Replace all statistics, e.g. after loading the library cache
+     * @param counts Play count per TrackId
+     * @param recentFirst Played tracks, most recent first
+     * @return False if recentFirst refers to an unknown or repeated track
+     */
+    bool restore(const std::vector<uint32_t>& counts, const std::vector<TrackId>& recentFirst);
+
+    /**
+     * @brief Forget all tracks
+     */
+    void clear();
+};
+
+#endif // PLAY_STATISTICS_H
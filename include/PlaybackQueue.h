@@ -0,0 +1,184 @@
+/**
+ * @file PlaybackQueue.h
+ * @brief Shuffle, repeat and play-next ordering for the media player
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef PLAYBACK_QUEUE_H
+#define PLAYBACK_QUEUE_H
+
+#include <cstddef>
+#include <deque>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Enumeration for repeat modes
+ */
+enum class RepeatMode {
+    OFF,        ///< Stop after the last track
+    ONE,        ///< Repeat the current track when it ends
+    ALL         ///< Wrap around to the start of the playlist
+};
+
+/**
+ * @brief Decides which playlist index plays next
+ *
+ * Keeps a bounded play history (a deque, so previous/next are O(1) at either
+ * end), a play-next queue and a lazily generated shuffle permutation. The
+ * shuffle uses a sparse Fisher-Yates: only displaced positions are stored, and
+ * draws are produced in small chunks, so enabling shuffle on a large library
+ * never touches the whole index range.
+ */
+class PlaybackQueue {
+private:
+    size_t trackCount;                                  ///< Number of tracks in the playlist
+    bool shuffleEnabled;                                ///< Whether shuffle is active
+    RepeatMode repeatMode;                              ///< Current repeat mode
+    std::deque<size_t> history;                         ///< Played indices, oldest first
+    size_t historyCursor;                               ///< Position of current track in history
+    std::deque<size_t> upNext;                          ///< User play-next queue
+    std::unordered_map<size_t, size_t> shuffleSwaps;    ///< Sparse Fisher-Yates permutation
+    size_t shufflePosition;                             ///< Next permutation slot to draw
+    std::vector<size_t> shuffleChunk;                   ///< Pre-drawn upcoming shuffle indices
+    size_t shuffleChunkPos;                             ///< Read position in shuffleChunk
+    std::mt19937 rng;                                   ///< Random generator for shuffle
+
+    static constexpr size_t MAX_HISTORY = 1024;         ///< History entries kept
+    static constexpr size_t SHUFFLE_CHUNK = 32;         ///< Shuffle draws generated at once
+
+    /**
+     * @brief Value at a permutation slot of the sparse Fisher-Yates
+     * @param slot Permutation slot
+     * @return Track index stored at that slot
+     */
+    size_t permutationAt(size_t slot) const;
+
+    /**
+     * @brief Start a new shuffle cycle, optionally pinning a track to slot 0
+     * @param first Track to treat as already played in this cycle
+     */
+    void restartShuffle(size_t first);
+
+    /**
+     * @brief Draw the next chunk of the shuffle permutation
+     * @return False if the current cycle is exhausted
+     */
+    bool refillShuffleChunk();
+
+    /**
+     * @brief Pick the track after the current one, ignoring history
+     * @param wrap Whether to wrap at the end of the playlist/cycle
+     * @param index Receives the chosen track index
+     * @return False if playback should end
+     */
+    bool drawNext(bool wrap, size_t& index);
+
+    /**
+     * @brief Append a track to history and make it current
+     * @param index Track index
+     */
+    void pushHistory(size_t index);
+
+public:
+    /**
+     * @brief Constructor
+     * @param seed Seed for the shuffle generator
+     */
+    explicit PlaybackQueue(unsigned int seed = std::random_device{}());
+
+    /**
+     * @brief Reset for a new playlist
+     * @param count Number of tracks
+     * @param startIndex Track that is current after the reset
+     */
+    void reset(size_t count, size_t startIndex = 0);
+
+    /**
+     * @brief Update the track count after tracks were appended
+     * @param count New number of tracks
+     */
+    void setTrackCount(size_t count);
+
+    /**
+     * @brief Enable or disable shuffle
+     * @param enabled True to shuffle
+     */
+    void setShuffle(bool enabled);
+
+    /**
+     * @brief Check if shuffle is enabled
+     * @return True if shuffle is active
+     */
+    bool isShuffleEnabled() const;
+
+    /**
+     * @brief Set the repeat mode
+     * @param mode Repeat mode
+     */
+    void setRepeatMode(RepeatMode mode);
+
+    /**
+     * @brief Get the repeat mode
+     * @return Current repeat mode
+     */
+    RepeatMode getRepeatMode() const;
+
+    /**
+     * @brief Play a track immediately after the current one
+     * @param index Track index
+     * @return False if the index is out of range
+     */
+    bool playNext(size_t index);
+
+    /**
+     * @brief Append a track to the end of the play-next queue
+     * @param index Track index
+     * @return False if the index is out of range
+     */
+    bool enqueue(size_t index);
+
+    /**
+     * @brief Number of tracks waiting in the play-next queue
+     * @return Queue length
+     */
+    size_t getQueueLength() const;
+
+    /**
+     * @brief Advance to the next track
+     * @param automatic True when the current track ended on its own; repeat
+     *                  modes only apply then, manual skips always wrap
+     * @param index Receives the new current track index
+     * @return False if playback should stop (end of playlist, repeat off)
+     */
+    bool next(bool automatic, size_t& index);
+
+    /**
+     * @brief Check whether a track would follow when the current one ends
+     * @return True if next(true, ...) would succeed
+     */
+    bool hasNext() const;
+
+    /**
+     * @brief Step back to the previous track
+     * @param index Receives the new current track index
+     * @return False if there is no track to go back to
+     */
+    bool previous(size_t& index);
+
+    /**
+     * @brief Get the current track index
+     * @return Current index (0 if the playlist is empty)
+     */
+    size_t current() const;
+
+    /**
+     * @brief Convert repeat mode to string
+     * @param mode Mode to convert
+     * @return String representation
+     */
+    static const char* repeatModeToString(RepeatMode mode);
+};
+
+#endif // PLAYBACK_QUEUE_H
@@ -0,0 +1,145 @@
+/**
+ * @file Playlist.h
+ * @brief Ordered list of library track IDs with binary and M3U8 persistence
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef PLAYLIST_H
+#define PLAYLIST_H
+
+#include "MediaLibrary.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief A named, ordered list of TrackIds
+ *
+ * Entries are 4-byte IDs into a MediaLibrary rather than Track copies, so
+ * insert/move/remove shift plain integers (a memmove) and a 10k-entry
+ * playlist is 40 KB. The binary file stores the ID array verbatim and loads
+ * with a single read and copy.
+ */
+class Playlist {
+private:
+    std::string name;               ///< Playlist name
+    std::vector<TrackId> entries;   ///< Track IDs in play order
+
+public:
+    static constexpr uint32_t FILE_MAGIC = 0x534C5056;     ///< "VPLS"
+    static constexpr uint32_t FILE_VERSION = 1;            ///< Binary format version
+
+    /**
+     * @brief Constructor
+     * @param playlistName Playlist name
+     */
+    explicit Playlist(const std::string& playlistName = "Playlist");
+
+    /**
+     * @brief Get playlist name
+     * @return Name
+     */
+    const std::string& getName() const;
+
+    /**
+     * @brief Set playlist name
+     * @param playlistName New name
+     */
+    void setName(const std::string& playlistName);
+
+    /**
+     * @brief Number of entries
+     * @return Entry count
+     */
+    size_t size() const;
+
+    /**
+     * @brief Check if the playlist is empty
+     * @return True if there are no entries
+     */
+    bool empty() const;
+
+    /**
+     * @brief Track ID at a position
+     * @param position Zero-based position
+     * @return Track ID, INVALID_TRACK_ID if out of range
+     */
+    TrackId at(size_t position) const;
+
+    /**
+     * @brief All entries in order
+     * @return Entry array
+     */
+    const std::vector<TrackId>& getEntries() const;
+
+    /**
+     * @brief Append an entry
+     * @param id Track ID
+     */
+    void append(TrackId id);
+
+    /**
+     * @brief Insert entries before a position
+     * @param position Insert position (size() appends)
+     * @param ids Track IDs to insert
+     * @return False if position is out of range
+     */
+    bool insert(size_t position, const std::vector<TrackId>& ids);
+
+    /**
+     * @brief Remove a range of entries
+     * @param position First entry to remove
+     * @param count Number of entries
+     * @return False if the range is out of bounds
+     */
+    bool remove(size_t position, size_t count = 1);
+
+    /**
+     * @brief Move an entry, shifting the entries in between
+     * @param from Current position
+     * @param to Destination position
+     * @return False if either position is out of range
+     */
+    bool move(size_t from, size_t to);
+
+    /**
+     * @brief Remove all entries
+     */
+    void clear();
+
+    /**
+     * @brief Save in the compact binary format
+     * @param path Destination file
+     * @return True on success
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Load from the compact binary format
+     * @param path Source file
+     * @param library Library the IDs must resolve in
+     * @return True on success; the playlist is unchanged on failure
+     */
+    bool load(const std::string& path, const MediaLibrary& library);
+
+    /**
+     * @brief Export as an extended M3U (UTF-8) playlist
+     * @param path Destination file
+     * @param library Library providing track metadata
+     * @return True on success
+     */
+    bool exportM3U8(const std::string& path, const MediaLibrary& library) const;
+
+    /**
+     * @brief Import an M3U/M3U8 playlist
+     *
+     * Entries are resolved by file path; "library://<id>" entries written by
+     * exportM3U8 for tracks without a file resolve directly. Unknown entries
+     * are skipped. The playlist is left unchanged when no entry resolves.
+     * @param path Source file
+     * @param library Library to resolve entries in
+     * @return Number of entries imported
+     */
+    size_t importM3U8(const std::string& path, const MediaLibrary& library);
+};
+
+#endif // PLAYLIST_H
@@ -0,0 +1,96 @@
+/**
+ * @file PromptClipCache.h
+ * @brief Preloaded PCM clips for navigation voice prompts
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef PROMPT_CLIP_CACHE_H
+#define PROMPT_CLIP_CACHE_H
+
+#include "GPSNavigator.h"
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief View of one cached prompt clip (mono, AUDIO_SAMPLE_RATE)
+ */
+struct PromptClip {
+    const float* samples;   ///< Mono samples, nullptr if the clip is missing
+    size_t frames;          ///< Number of samples
+};
+
+/**
+ * @brief Holds every voice prompt as decoded float PCM in memory
+ *
+ * All clips are loaded once at startup into a single contiguous pool so the
+ * first prompt of a drive plays without touching the disk, and lookups from
+ * the audio callback are a plain array index.
+ */
+class PromptClipCache {
+private:
+    std::vector<float> pool;                                        ///< All clip samples back to back
+    std::array<size_t, VOICE_PROMPT_COUNT> offsets;                 ///< Clip start in pool
+    std::array<size_t, VOICE_PROMPT_COUNT> lengths;                 ///< Clip length in samples
+
+    /**
+     * @brief Read a PCM WAV file as mono float samples
+     * @param path File path
+     * @param samples Receives the samples
+     * @return True on success
+     */
+    static bool readWav(const std::string& path, std::vector<float>& samples);
+
+    /**
+     * @brief Generate a short two-tone chime for a prompt
+     * @param prompt Prompt to synthesize
+     * @param samples Receives the samples
+     */
+    static void synthesizeChime(VoicePrompt prompt, std::vector<float>& samples);
+
+    /**
+     * @brief Append a clip to the pool
+     * @param prompt Prompt slot
+     * @param samples Clip samples
+     */
+    void store(VoicePrompt prompt, const std::vector<float>& samples);
+
+public:
+    /**
+     * @brief Default constructor (empty cache)
+     */
+    PromptClipCache();
+
+    /**
+     * @brief Preload all prompts
+     *
+     * Loads "<directory>/<prompt>.wav" for each prompt (PCM WAV at
+     * AUDIO_SAMPLE_RATE); prompts without a usable file get a synthesized chime.
+     * @param directory Directory holding prompt WAV files (may be empty)
+     * @return Number of prompts loaded from disk
+     */
+    size_t preload(const std::string& directory);
+
+    /**
+     * @brief Get a cached clip
+     * @param prompt Prompt to look up
+     * @return Clip view; samples is nullptr if not loaded
+     */
+    PromptClip get(VoicePrompt prompt) const;
+
+    /**
+     * @brief Total memory used by cached samples
+     * @return Size in bytes
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * @brief File name (without directory) used for a prompt
+     * @param prompt Prompt
+     * @return File name, e.g. "arrived.wav"
+     */
+    static std::string promptFileName(VoicePrompt prompt);
+};
+
+#endif // PROMPT_CLIP_CACHE_H
@@ -0,0 +1,85 @@
+/**
+ * @file SeekIndex.h
+ * @brief Frame-to-byte-offset table for seeking in compressed audio
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef SEEK_INDEX_H
+#define SEEK_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief One entry of a seek index
+ */
+struct SeekPoint {
+    uint64_t frame;         ///< First frame of the compressed block
+    uint64_t byteOffset;    ///< File offset of that block
+};
+
+/**
+ * @brief Sorted seek points, built once while a compressed file is scanned
+ *
+ * A seek jumps to the last point at or before the target and decodes
+ * forward from there, so the cost is bounded by the point spacing instead
+ * of the position in the file.
+ */
+class SeekIndex {
+private:
+    std::vector<SeekPoint> points;  ///< Points in increasing frame order
+    uint64_t spacing;               ///< Minimum frames between points
+
+public:
+    static constexpr uint64_t DEFAULT_SPACING_FRAMES = 44100;  ///< One point per second at 44.1 kHz
+
+    /**
+     * @brief Constructor
+     * @param spacingFrames Minimum distance between points
+     */
+    explicit SeekIndex(uint64_t spacingFrames = DEFAULT_SPACING_FRAMES);
+
+    /**
+     * @brief Offer a block boundary while scanning
+     *
+     * Kept only if it is at least the spacing past the previous point (the
+     * first block is always kept).
+     * @param frame First frame of the block
+     * @param byteOffset File offset of the block
+     * @return True if the point was added
+     */
+    bool add(uint64_t frame, uint64_t byteOffset);
+
+    /**
+     * @brief Find where to start decoding for a target frame
+     * @param frame Target frame
+     * @return Last point at or before frame, nullptr if the index is empty
+     */
+    const SeekPoint* find(uint64_t frame) const;
+
+    /**
+     * @brief Number of points
+     * @return Point count
+     */
+    size_t size() const;
+
+    /**
+     * @brief Allocate room for points up front
+     * @param count Points to make room for
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Points that fit without allocating
+     * @return Allocated point count
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Remove all points (the allocation is kept)
+     */
+    void clear();
+};
+
+#endif // SEEK_INDEX_H
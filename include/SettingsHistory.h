@@ -0,0 +1,122 @@
+/**
+ * @file SettingsHistory.h
+ * @brief Bounded audit log of settings changes with undo and redo
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef SETTINGS_HISTORY_H
+#define SETTINGS_HISTORY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "SettingsSchema.h"
+
+/**
+ * @brief One recorded change of one setting
+ */
+struct SettingsAuditEntry {
+    int64_t timestamp;      ///< Milliseconds since the Unix epoch
+    uint32_t transaction;   ///< Entries of one transaction share this number
+    SettingKey key;         ///< Setting changed
+    uint8_t oldValue;       ///< Schema value before the change
+    uint8_t newValue;       ///< Schema value after the change
+};
+
+/**
+ * @brief Fixed-size ring of settings changes with an undo cursor
+ *
+ * Each transaction adds one entry per changed key. Entries before the
+ * cursor can be undone, entries after it redone; recording a new
+ * transaction discards the redo entries. When the ring is full the oldest
+ * transaction is dropped whole, so memory use never grows and an undo
+ * never restores half a transaction. Undo and redo touch at most one
+ * entry per setting, and skip entries whose setting no longer holds the
+ * value they expect, e.g. after an unrecorded automatic change; a
+ * transaction with nothing left to apply is passed over.
+ */
+class SettingsHistory {
+public:
+    static constexpr size_t CAPACITY = 256;     ///< Entries kept
+
+private:
+    std::array<SettingsAuditEntry, CAPACITY> entries;  ///< Ring storage
+    size_t head;                ///< Index of the oldest entry
+    size_t count;               ///< Entries stored, including redo entries
+    size_t cursor;              ///< Entries that can be undone
+    uint32_t nextTransaction;   ///< Number for the next recorded transaction
+
+    SettingsAuditEntry& slot(size_t index);
+    const SettingsAuditEntry& slot(size_t index) const;
+
+    /**
+     * @brief Drop the oldest transaction to make room
+     */
+    void evictOldest();
+
+public:
+    SettingsHistory();
+
+    /**
+     * @brief Record one committed transaction
+     * @param changed Keys that changed
+     * @param previous Settings before the transaction
+     * @param current Settings after the transaction
+     * @param timestamp Milliseconds since the Unix epoch
+     */
+    void record(SettingKeySet changed, const SettingsSnapshot& previous, const SettingsSnapshot& current,
+                int64_t timestamp);
+
+    /**
+     * @brief Restore the values from before the latest undoable transaction
+     * @param target Settings to edit
+     * @return False if no entry could be undone
+     */
+    bool undo(SettingsSnapshot& target);
+
+    /**
+     * @brief Reapply the transaction undone last
+     * @param target Settings to edit
+     * @return False if no entry could be redone
+     */
+    bool redo(SettingsSnapshot& target);
+
+    bool canUndo() const;       ///< True if entries are left to undo
+    bool canRedo() const;       ///< True if entries are left to redo
+
+    /**
+     * @brief Number of stored entries, oldest first, including redo entries
+     * @return Entry count
+     */
+    size_t size() const;
+
+    /**
+     * @brief Access a stored entry
+     * @param index 0 for the oldest entry
+     * @return Entry
+     */
+    const SettingsAuditEntry& at(size_t index) const;
+
+    /**
+     * @brief Undoable entries, oldest first, as saved with the settings
+     * @return Copy of the entries before the cursor
+     */
+    std::vector<SettingsAuditEntry> undoableEntries() const;
+
+    /**
+     * @brief Replace the history, e.g. after loading the settings file
+     *
+     * Entries must fit the schema and the ring; all of them become undoable.
+     * @param loaded Entries, oldest first
+     * @return False (history unchanged) if any entry is invalid
+     */
+    bool restore(const std::vector<SettingsAuditEntry>& loaded);
+
+    /**
+     * @brief Forget every entry
+     */
+    void clear();
+};
+
+#endif // SETTINGS_HISTORY_H
@@ -0,0 +1,268 @@
+/**
+ * @file SettingsSchema.h
+ * @brief Compile-time table describing every system setting
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef SETTINGS_SCHEMA_H
+#define SETTINGS_SCHEMA_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Enumeration for display themes
+ */
+enum class DisplayTheme {
+    LIGHT,      ///< Light theme
+    DARK,       ///< Dark theme
+    AUTO        ///< Automatic theme based on time
+};
+
+/**
+ * @brief Enumeration for language options
+ */
+enum class Language {
+    ENGLISH,    ///< English
+    SPANISH,    ///< Spanish
+    FRENCH,     ///< French
+    GERMAN,     ///< German
+    JAPANESE    ///< Japanese
+};
+
+/**
+ * @brief Immutable copy of every setting, published as a unit
+ */
+struct SettingsSnapshot {
+    int systemVolume;               ///< Master system volume (0-100)
+    int displayBrightness;          ///< Display brightness (0-100)
+    DisplayTheme theme;             ///< Display theme
+    Language language;              ///< System language
+    bool nightModeEnabled;          ///< Night mode status
+    bool voiceGuidanceEnabled;      ///< Voice guidance for navigation
+    bool notificationSoundsEnabled; ///< Notification sound status
+    std::string timeFormat;         ///< Time format (12h/24h)
+    std::string temperatureUnit;    ///< Temperature unit (C/F)
+};
+
+/**
+ * @brief Identifies one setting; also its row in SETTINGS_SCHEMA
+ */
+enum class SettingKey {
+    SYSTEM_VOLUME,          ///< systemVolume
+    DISPLAY_BRIGHTNESS,     ///< displayBrightness
+    THEME,                  ///< theme
+    LANGUAGE,               ///< language
+    NIGHT_MODE,             ///< nightModeEnabled
+    VOICE_GUIDANCE,         ///< voiceGuidanceEnabled
+    NOTIFICATION_SOUNDS,    ///< notificationSoundsEnabled
+    TIME_FORMAT,            ///< timeFormat
+    TEMPERATURE_UNIT        ///< temperatureUnit
+};
+
+/**
+ * @brief Set of SettingKey values, one bit per key
+ */
+using SettingKeySet = uint32_t;
+
+/**
+ * @brief Bit for one key in a SettingKeySet
+ * @param key Setting key
+ * @return Mask with only that key's bit set
+ */
+constexpr SettingKeySet settingBit(SettingKey key) {
+    return SettingKeySet(1) << static_cast<unsigned>(key);
+}
+
+/**
+ * @brief How a setting's value is interpreted
+ */
+enum class SettingType {
+    INTEGER,    ///< Number in [minValue, maxValue]; out-of-range input is clamped
+    BOOLEAN,    ///< 0 or 1
+    CHOICE      ///< Index into choices; anything else is rejected
+};
+
+/**
+ * @brief Menu section a setting is listed under
+ */
+enum class SettingGroup {
+    AUDIO,      ///< Audio Settings
+    DISPLAY,    ///< Display Settings
+    SYSTEM      ///< System Settings
+};
+
+/**
+ * @brief One row of the schema
+ *
+ * Every value is handled as an int: the raw number for INTEGER, 0/1 for
+ * BOOLEAN and the choice index for CHOICE. get and set convert between
+ * that and the typed SettingsSnapshot field; get returns -1 for a field
+ * that holds no valid choice.
+ */
+struct SettingSpec {
+    SettingKey key;                                 ///< Key the row describes (equals its index)
+    const char* id;                                 ///< Stable identifier for files ("system_volume")
+    const char* label;                              ///< Name shown to the user
+    SettingGroup group;                             ///< Menu section
+    SettingType type;                               ///< Value interpretation
+    int minValue;                                   ///< Smallest valid value
+    int maxValue;                                   ///< Largest valid value (fits in one byte)
+    int defaultValue;                               ///< Factory default
+    const char* const* choices;                     ///< Display names for BOOLEAN/CHOICE values
+    const char* prefix;                             ///< Printed before the value
+    const char* suffix;                             ///< Printed after the value
+    bool announce;                                  ///< Post an INFO notification when set
+    int (*get)(const SettingsSnapshot&);            ///< Read the field as an int
+    void (*set)(SettingsSnapshot&, int);            ///< Write the field from an int
+};
+
+inline constexpr const char* ON_OFF_NAMES[] = {"OFF", "ON"};
+inline constexpr const char* THEME_NAMES[] = {"Light", "Dark", "Auto"};
+inline constexpr const char* LANGUAGE_NAMES[] = {"English", "Español", "Français", "Deutsch", "日本語"};
+inline constexpr const char* TIME_FORMAT_NAMES[] = {"12h", "24h"};
+inline constexpr const char* TEMPERATURE_UNIT_NAMES[] = {"C", "F"};
+
+/**
+ * @brief Index of a string among choices
+ * @return Index, or -1 if absent
+ */
+template <size_t N>
+int choiceIndex(const char* const (&choices)[N], const std::string& value) {
+    for (size_t i = 0; i < N; ++i) {
+        if (value == choices[i]) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+/**
+ * @brief Every setting, in SettingKey order
+ *
+ * Validation, defaults, change detection, the settings file and the
+ * settings screen are all driven from this table.
+ */
+inline constexpr std::array<SettingSpec, 9> SETTINGS_SCHEMA = {{
+    {SettingKey::SYSTEM_VOLUME, "system_volume", "System Volume", SettingGroup::AUDIO,
+     SettingType::INTEGER, 0, 100, 50, nullptr, "", "%", false,
+     [](const SettingsSnapshot& s) { return s.systemVolume; },
+     [](SettingsSnapshot& s, int v) { s.systemVolume = v; }},
+    {SettingKey::DISPLAY_BRIGHTNESS, "display_brightness", "Brightness", SettingGroup::DISPLAY,
+     SettingType::INTEGER, 0, 100, 75, nullptr, "", "%", false,
+     [](const SettingsSnapshot& s) { return s.displayBrightness; },
+     [](SettingsSnapshot& s, int v) { s.displayBrightness = v; }},
+    {SettingKey::THEME, "theme", "Theme", SettingGroup::DISPLAY,
+     SettingType::CHOICE, 0, 2, static_cast<int>(DisplayTheme::AUTO), THEME_NAMES, "", "", true,
+     [](const SettingsSnapshot& s) { return static_cast<int>(s.theme); },
+     [](SettingsSnapshot& s, int v) { s.theme = static_cast<DisplayTheme>(v); }},
+    {SettingKey::LANGUAGE, "language", "Language", SettingGroup::SYSTEM,
+     SettingType::CHOICE, 0, 4, static_cast<int>(Language::ENGLISH), LANGUAGE_NAMES, "", "", true,
+     [](const SettingsSnapshot& s) { return static_cast<int>(s.language); },
+     [](SettingsSnapshot& s, int v) { s.language = static_cast<Language>(v); }},
+    {SettingKey::NIGHT_MODE, "night_mode", "Night Mode", SettingGroup::DISPLAY,
+     SettingType::BOOLEAN, 0, 1, 0, ON_OFF_NAMES, "", "", false,
+     [](const SettingsSnapshot& s) { return s.nightModeEnabled ? 1 : 0; },
+     [](SettingsSnapshot& s, int v) { s.nightModeEnabled = v != 0; }},
+    {SettingKey::VOICE_GUIDANCE, "voice_guidance", "Voice Guidance", SettingGroup::AUDIO,
+     SettingType::BOOLEAN, 0, 1, 1, ON_OFF_NAMES, "", "", false,
+     [](const SettingsSnapshot& s) { return s.voiceGuidanceEnabled ? 1 : 0; },
+     [](SettingsSnapshot& s, int v) { s.voiceGuidanceEnabled = v != 0; }},
+    {SettingKey::NOTIFICATION_SOUNDS, "notification_sounds", "Notification Sounds", SettingGroup::AUDIO,
+     SettingType::BOOLEAN, 0, 1, 1, ON_OFF_NAMES, "", "", false,
+     [](const SettingsSnapshot& s) { return s.notificationSoundsEnabled ? 1 : 0; },
+     [](SettingsSnapshot& s, int v) { s.notificationSoundsEnabled = v != 0; }},
+    {SettingKey::TIME_FORMAT, "time_format", "Time Format", SettingGroup::SYSTEM,
+     SettingType::CHOICE, 0, 1, 0, TIME_FORMAT_NAMES, "", "", false,
+     [](const SettingsSnapshot& s) { return choiceIndex(TIME_FORMAT_NAMES, s.timeFormat); },
+     [](SettingsSnapshot& s, int v) { s.timeFormat = TIME_FORMAT_NAMES[v]; }},
+    {SettingKey::TEMPERATURE_UNIT, "temperature_unit", "Temperature Unit", SettingGroup::SYSTEM,
+     SettingType::CHOICE, 0, 1, 0, TEMPERATURE_UNIT_NAMES, "°", "", false,
+     [](const SettingsSnapshot& s) { return choiceIndex(TEMPERATURE_UNIT_NAMES, s.temperatureUnit); },
+     [](SettingsSnapshot& s, int v) { s.temperatureUnit = TEMPERATURE_UNIT_NAMES[v]; }},
+}};
+
+inline constexpr size_t SETTING_COUNT = SETTINGS_SCHEMA.size();    ///< Number of settings
+
+/**
+ * @brief Schema row for a key
+ * @param key Setting key
+ * @return Row describing it
+ */
+constexpr const SettingSpec& settingSpec(SettingKey key) {
+    return SETTINGS_SCHEMA[static_cast<size_t>(key)];
+}
+
+/**
+ * @brief Identifiers as string_views, so lookups compare lengths before bytes
+ */
+inline constexpr std::array<std::string_view, SETTING_COUNT> SETTING_IDS = [] {
+    std::array<std::string_view, SETTING_COUNT> ids{};
+    for (size_t i = 0; i < SETTING_COUNT; ++i) ids[i] = SETTINGS_SCHEMA[i].id;
+    return ids;
+}();
+
+/**
+ * @brief Find a row by its stable identifier
+ * @param id Identifier such as "system_volume"
+ * @return Row, or nullptr if unknown
+ */
+constexpr const SettingSpec* findSetting(std::string_view id) {
+    for (size_t i = 0; i < SETTING_COUNT; ++i) {
+        if (id == SETTING_IDS[i]) return &SETTINGS_SCHEMA[i];
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Check that rows are in key order with sane ranges
+ * @return True if the table is well formed
+ */
+constexpr bool isSchemaConsistent() {
+    for (size_t i = 0; i < SETTINGS_SCHEMA.size(); ++i) {
+        const SettingSpec& spec = SETTINGS_SCHEMA[i];
+        if (static_cast<size_t>(spec.key) != i || spec.minValue < 0 || spec.maxValue > 255 ||
+            spec.defaultValue < spec.minValue || spec.defaultValue > spec.maxValue ||
+            (spec.type != SettingType::INTEGER && spec.choices == nullptr)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(isSchemaConsistent(), "SETTINGS_SCHEMA rows must follow SettingKey order with valid ranges");
+static_assert(SETTING_COUNT <= 16, "The settings file stores override masks in 16 bits");
+static_assert(findSetting("temperature_unit") == &settingSpec(SettingKey::TEMPERATURE_UNIT),
+              "Identifiers must resolve to their rows");
+
+/**
+ * @brief Build a snapshot holding every default value
+ * @return Default settings
+ */
+SettingsSnapshot defaultSettings();
+
+/**
+ * @brief Check that every value is in range
+ * @param settings Settings to check
+ * @return True if every field holds a valid value
+ */
+bool isValidSettings(const SettingsSnapshot& settings);
+
+/**
+ * @brief Keys whose values differ between two snapshots
+ * @param a First snapshot
+ * @param b Second snapshot
+ * @return Set of differing keys
+ */
+SettingKeySet diffSettings(const SettingsSnapshot& a, const SettingsSnapshot& b);
+
+/**
+ * @brief Format a value the way the settings screen shows it
+ * @param spec Setting
+ * @param value Value as an int
+ * @return Text such as "75%", "ON" or "°C"
+ */
+std::string formatSetting(const SettingSpec& spec, int value);
+
+#endif // SETTINGS_SCHEMA_H
@@ -0,0 +1,124 @@
+/**
+ * @file SettingsText.h
+ * @brief Tokenizer for the human-editable settings file
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef SETTINGS_TEXT_H
+#define SETTINGS_TEXT_H
+
+#include <cstddef>
+#include <string_view>
+#include "SettingsSchema.h"
+
+/**
+ * @brief Where and why a settings text was rejected
+ */
+struct SettingsTextError {
+    size_t line;            ///< 1-based line number (0 if no error)
+    size_t column;          ///< 1-based byte column
+    const char* message;    ///< Static description
+};
+
+/**
+ * @brief Kind of line returned by SettingsTextParser
+ */
+enum class SettingsTextItemKind {
+    SECTION,    ///< "[name]"
+    VALUE       ///< "key = value"
+};
+
+/**
+ * @brief One meaningful line of a settings text
+ *
+ * The views point into the parsed text and stay valid as long as it does.
+ */
+struct SettingsTextItem {
+    SettingsTextItemKind kind;  ///< Section header or key/value pair
+    std::string_view name;      ///< Section name or key, trimmed
+    std::string_view value;     ///< Value, trimmed (empty for sections)
+    size_t line;                ///< 1-based line number
+    size_t column;              ///< Column of the name
+    size_t valueColumn;         ///< Column of the value
+};
+
+/**
+ * @brief Pull parser for INI-style settings text
+ *
+ * Format, one item per line:
+ * @code
+ * # comment (also ';')
+ * active_profile = Alice
+ * [Alice]
+ * system_volume = 80
+ * theme = Dark
+ * @endcode
+ * Leading and trailing blanks are ignored; CRLF line endings and a UTF-8
+ * byte order mark are accepted. The parser works on string_views into
+ * the caller's text and never allocates.
+ */
+class SettingsTextParser {
+private:
+    std::string_view text;      ///< Text being parsed
+    size_t position;            ///< Offset of the next unread line
+    size_t line;                ///< Number of the last line read
+    SettingsTextError error;    ///< First error (line 0 if none)
+
+public:
+    /**
+     * @brief Constructor
+     * @param input Text to parse; must outlive the parser and its items
+     */
+    explicit SettingsTextParser(std::string_view input);
+
+    /**
+     * @brief Read the next section or key/value line
+     * @param item Receives the line
+     * @return False at the end of the text or after an error
+     */
+    bool next(SettingsTextItem& item);
+
+    /**
+     * @brief Record an error found while interpreting an item
+     *
+     * Only the first error is kept; next() returns false afterwards.
+     * @param atLine Line number
+     * @param atColumn Column
+     * @param message Static description
+     */
+    void fail(size_t atLine, size_t atColumn, const char* message);
+
+    /**
+     * @brief Check whether parsing stopped on an error
+     * @return True if an error was recorded
+     */
+    bool failed() const;
+
+    /**
+     * @brief Access the first error
+     * @return Error (line 0 if none)
+     */
+    const SettingsTextError& getError() const;
+};
+
+/**
+ * @brief Convert the text form of a value to the schema int
+ *
+ * INTEGER settings take a decimal number in range. BOOLEAN and CHOICE
+ * settings take a choice name (ASCII case-insensitive) or its index.
+ * @param spec Setting
+ * @param text Value text
+ * @param value Receives the value
+ * @return False if the text is not a valid value
+ */
+bool parseSettingValue(const SettingSpec& spec, std::string_view text, int& value);
+
+/**
+ * @brief Text form of a value, as parseSettingValue accepts it
+ * @param spec Setting
+ * @param value Value as an int
+ * @return Number for INTEGER settings, choice name otherwise
+ */
+std::string_view settingValueText(const SettingSpec& spec, int value);
+
+#endif // SETTINGS_TEXT_H
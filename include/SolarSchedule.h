@@ -0,0 +1,93 @@
+/**
+ * @file SolarSchedule.h
+ * @brief Sunrise and sunset times with a per-day, per-location cache
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef SOLAR_SCHEDULE_H
+#define SOLAR_SCHEDULE_H
+
+#include <cstdint>
+
+/**
+ * @brief Sunrise and sunset for one solar day
+ */
+struct SunTimes {
+    int64_t sunrise;    ///< Sunrise, seconds since the Unix epoch (UTC)
+    int64_t sunset;     ///< Sunset, seconds since the Unix epoch (UTC)
+    bool polarDay;      ///< Sun never sets (sunrise/sunset unused)
+    bool polarNight;    ///< Sun never rises (sunrise/sunset unused)
+};
+
+/**
+ * @brief Daylight level from position and time
+ *
+ * Sunrise and sunset come from the NOAA solar position approximation
+ * (about a minute of error at mid latitudes). They depend only on the day
+ * and, weakly, on position, so they are computed once per solar day and
+ * location cell of CELL_DEGREES and reused: while the vehicle stays in the
+ * cell, daylightLevel() is two floors, a comparison and a little
+ * arithmetic, with no trigonometry.
+ */
+class SolarSchedule {
+public:
+    static constexpr double CELL_DEGREES = 0.25;            ///< Cache cell size (about 28 km)
+    static constexpr int64_t TWILIGHT_RAMP_SECONDS = 1800;  ///< Length of the dawn and dusk ramps
+
+private:
+    int64_t cachedDay;          ///< Solar day of the cached times
+    int32_t cachedLatCell;      ///< Latitude cell of the cached times
+    int32_t cachedLonCell;      ///< Longitude cell of the cached times
+    SunTimes cached;            ///< Times for the cached day and cell
+    bool hasCache;              ///< False until the first lookup
+    uint64_t computeCount;      ///< Cache misses so far
+
+public:
+    SolarSchedule();
+
+    /**
+     * @brief Compute sunrise and sunset without caching
+     * @param latitude Latitude in degrees
+     * @param longitude Longitude in degrees (east positive)
+     * @param day Solar day: days since the epoch at the given longitude
+     * @return Times for that day
+     */
+    static SunTimes compute(double latitude, double longitude, int64_t day);
+
+    /**
+     * @brief Solar day containing a moment at a longitude
+     * @param longitude Longitude in degrees
+     * @param now Seconds since the Unix epoch
+     * @return Days since the epoch in local solar time
+     */
+    static int64_t solarDay(double longitude, int64_t now);
+
+    /**
+     * @brief Sunrise and sunset for the day and cell containing a moment
+     * @param latitude Latitude in degrees
+     * @param longitude Longitude in degrees
+     * @param now Seconds since the Unix epoch
+     * @return Cached or freshly computed times
+     */
+    const SunTimes& sunTimes(double latitude, double longitude, int64_t now);
+
+    /**
+     * @brief How light it is outside
+     *
+     * Ramps linearly over TWILIGHT_RAMP_SECONDS centered on sunrise and
+     * sunset.
+     * @param latitude Latitude in degrees
+     * @param longitude Longitude in degrees
+     * @param now Seconds since the Unix epoch
+     * @return 0 at night, 1 in daylight, in between at dawn and dusk
+     */
+    double daylightLevel(double latitude, double longitude, int64_t now);
+
+    /**
+     * @brief Number of times sunrise and sunset were recomputed
+     * @return Cache miss count
+     */
+    uint64_t getComputeCount() const;
+};
+
+#endif // SOLAR_SCHEDULE_H
@@ -7,28 +7,63 @@
 #ifndef SYSTEM_SETTINGS_H
 #define SYSTEM_SETTINGS_H
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "EpochReclaimer.h"
+#include "FileWatcher.h"
+#include "SettingsHistory.h"
+#include "SettingsSchema.h"
+#include "SettingsText.h"
 #include "NotificationManager.h"
 
 /**
- * @brief Enumeration for display themes
+ * @brief One committed transaction, delivered to observers as a single event
  */
-enum class DisplayTheme {
-    LIGHT,      ///< Light theme
-    DARK,       ///< Dark theme
-    AUTO        ///< Automatic theme based on time
+struct SettingsChange {
+    SettingKeySet changed;              ///< Keys whose value differs
+    const SettingsSnapshot& previous;   ///< Settings before the transaction
+    const SettingsSnapshot& current;    ///< Settings after the transaction
+
+    /**
+     * @brief Check whether a key changed
+     * @param key Setting key
+     * @return True if the transaction changed it
+     */
+    bool contains(SettingKey key) const { return (changed & settingBit(key)) != 0; }
 };
 
 /**
- * @brief Enumeration for language options
+ * @brief Callback for committed settings changes
  */
-enum class Language {
-    ENGLISH,    ///< English
-    SPANISH,    ///< Spanish
-    FRENCH,     ///< French
-    GERMAN,     ///< German
-    JAPANESE    ///< Japanese
+using SettingsObserver = std::function<void(const SettingsChange&)>;
+
+/**
+ * @brief Read access to one settings snapshot
+ *
+ * The snapshot cannot change or be freed while the view lives, so several
+ * fields read through one view are always consistent with each other.
+ * Keep views short-lived: a view held forever stops old snapshots from
+ * being reclaimed.
+ */
+class SettingsView {
+private:
+    EpochReclaimer::Guard guard;        ///< Keeps the snapshot alive
+    const SettingsSnapshot* snapshot;   ///< Snapshot being read
+
+public:
+    SettingsView(EpochReclaimer::Guard&& pinned, const SettingsSnapshot* current)
+        : guard(std::move(pinned)), snapshot(current) {}
+
+    const SettingsSnapshot* operator->() const { return snapshot; }
+    const SettingsSnapshot& operator*() const { return *snapshot; }
 };
 
 /**
@@ -36,27 +71,277 @@ enum class Language {
  * 
  * Manages user-configurable settings including display preferences, audio settings,
  * and system behavior options.
+ *
+ * Every write is a transaction: the writer copies the published
+ * SettingsSnapshot, edits the copy under a mutex and publishes it through
+ * an atomic pointer. Getters and getSnapshot() never take the mutex: they
+ * pin the reclaimer epoch and load the pointer, so display and alert code
+ * on any thread can read settings without contending with writers.
+ * Replaced snapshots are freed by EpochReclaimer once no reader can still
+ * see them.
+ *
+ * Components react to changes by subscribing to the keys they care about
+ * instead of being called from the setters. A transaction that changes
+ * several keys is published once and reaches each interested observer as
+ * one SettingsChange.
+ *
+ * Settings belong to named driver profiles. Profiles share snapshots until
+ * one of them is edited (copy-on-write), so switching profiles publishes an
+ * existing snapshot with a single pointer swap and notifies only the
+ * observers of keys that differ between the two profiles.
+ *
+ * Transactions made through update() and the setters are recorded in a
+ * bounded SettingsHistory of the active profile and can be undone and
+ * redone; each profile keeps its own history, so undo never replays one
+ * driver's values into another's profile. Pushed and imported settings
+ * are recorded as transactions of their own. Profile switches, loaded
+ * files and applyAutomatic() changes are not recorded; undo skips settings
+ * such changes have overwritten since.
  */
 class SystemSettings {
+public:
+    using SubscriptionId = uint32_t;                        ///< Handle returned by subscribe()
+    
 private:
-    int systemVolume;                                       ///< Master system volume (0-100)
-    int displayBrightness;                                  ///< Display brightness (0-100)
-    DisplayTheme theme;                                     ///< Current display theme
-    Language language;                                      ///< System language
-    bool nightModeEnabled;                                  ///< Night mode status
-    bool voiceGuidanceEnabled;                              ///< Voice guidance for navigation
-    bool notificationSoundsEnabled;                         ///< Notification sound status
-    std::string timeFormat;                                 ///< Time format (12h/24h)
-    std::string temperatureUnit;                            ///< Temperature unit (C/F)
+    /**
+     * @brief Registered observer and the keys it listens to
+     */
+    struct Subscription {
+        SubscriptionId id;          ///< Handle for unsubscribe()
+        SettingKeySet keys;         ///< Keys of interest
+        SettingsObserver observer;  ///< Callback
+    };
+    
+    using ProfileMap = std::unordered_map<std::string, std::shared_ptr<const SettingsSnapshot>>;
+    
     std::shared_ptr<NotificationManager> notificationManager;   ///< Notification system
+    std::atomic<const SettingsSnapshot*> published;         ///< Snapshot readers see
+    mutable std::recursive_mutex writeMutex;                ///< Serializes writers (observers may write)
+    std::shared_ptr<const SettingsSnapshot> active;         ///< Owner of the published snapshot
+    ProfileMap profiles;                                    ///< Settings of every driver profile
+    std::string activeProfile;                              ///< Name of the published profile
+    std::vector<Subscription> subscriptions;                ///< Observers; guarded by writeMutex
+    SubscriptionId nextSubscriptionId;                      ///< Next handle; guarded by writeMutex
+    std::unique_ptr<FileWatcher> watcher;                   ///< Hot-reload watch (nullptr when off)
+    SettingsHistory history;                                ///< Recorded edits of the active profile; guarded by writeMutex
+    std::unordered_map<std::string, SettingsHistory> inactiveHistories;   ///< Histories of the other profiles
+    bool persistHistory;                                    ///< Save the history with the settings
+    
+    /**
+     * @brief Publish a snapshot and notify observers of the keys it changes
+     *
+     * writeMutex must be held; the caller records the snapshot in its profile.
+     * @param next Snapshot to publish
+     * @return Keys changed
+     */
+    SettingKeySet install(std::shared_ptr<const SettingsSnapshot> next);
+    
+    /**
+     * @brief Run an edit as one transaction
+     * @param edit Callback that modifies the draft settings
+     * @param record True to add the transaction to the history
+     * @return Keys changed
+     */
+    SettingKeySet commit(const std::function<void(SettingsSnapshot&)>& edit, bool record);
+    
+    /**
+     * @brief Decode and validate a settings file without touching any setting
+     * @param contents File contents
+     * @param loaded Receives the profiles
+     * @param loadedActive Receives the active profile name
+     * @param loadedHistory Receives the saved history (empty if none)
+     * @return False if the file is damaged
+     */
+    static bool parseSettings(const std::string& contents, ProfileMap& loaded, std::string& loadedActive,
+                              SettingsHistory& loadedHistory);
+    
+    /**
+     * @brief Decode and validate settings text without touching any setting
+     * @param text Text in the SettingsTextParser format
+     * @param loaded Receives the profiles
+     * @param loadedActive Receives the active profile name
+     * @param error Receives the position of the first problem
+     * @return False if the text is invalid
+     */
+    static bool parseSettingsText(std::string_view text, ProfileMap& loaded, std::string& loadedActive,
+                                  SettingsTextError& error);
+    
+    /**
+     * @brief Put the active profile's history aside and take up another's
+     *
+     * writeMutex must be held; call before activeProfile changes.
+     * @param name Profile about to become active
+     */
+    void selectHistory(const std::string& name);
+    
+    /**
+     * @brief Replace all profiles and publish the active one
+     *
+     * Changes to a profile that stays active are recorded in its history.
+     * @param loaded New profiles
+     * @param loadedActive Profile to activate (must be in loaded)
+     */
+    void applyProfiles(ProfileMap&& loaded, const std::string& loadedActive);
+    
+    /**
+     * @brief Restore default values without printing or notifying
+     */
+    void applyDefaults();
     
 public:
+    static constexpr uint32_t SETTINGS_MAGIC = 0x54455356;     ///< "VSET"
+    static constexpr uint32_t SETTINGS_VERSION = 3;            ///< Settings file format version
+    static constexpr size_t MAX_PROFILE_NAME = 64;             ///< Longest profile name in bytes
+    static const char* const DEFAULT_PROFILE;                  ///< Profile every installation starts with
+    
     /**
      * @brief Constructor with notification manager
      * @param notifManager Shared pointer to notification manager
      */
     explicit SystemSettings(std::shared_ptr<NotificationManager> notifManager);
     
+    /**
+     * @brief Destructor; stops any watch and retires the last snapshot
+     */
+    ~SystemSettings();
+    
+    SystemSettings(const SystemSettings&) = delete;
+    SystemSettings& operator=(const SystemSettings&) = delete;
+    
+    /**
+     * @brief Get a consistent view of all settings without locking
+     * @return View of the current snapshot
+     */
+    SettingsView getSnapshot() const;
+    
+    /**
+     * @brief Apply several changes as one transaction
+     *
+     * The edit runs on a private copy of the current settings under the
+     * writer lock; nothing is visible until it returns. Volume and
+     * brightness are clamped. If the result is valid it is published as one
+     * snapshot and observers of any changed key receive one SettingsChange.
+     * Observers run on the writing thread after publication and may start
+     * transactions of their own.
+     * @param edit Callback that modifies the draft settings
+     * @return Keys changed (0 if nothing changed or the draft was invalid)
+     */
+    SettingKeySet update(const std::function<void(SettingsSnapshot&)>& edit);
+    
+    /**
+     * @brief Apply a change made by the system rather than the driver
+     *
+     * Same as update(), but the transaction is not recorded, so automatic
+     * adjustments (e.g. the AUTO theme's brightness ramp) neither become
+     * the next undo nor push the driver's edits out of the history. An
+     * undo leaves the settings changed here alone.
+     * @param edit Callback that modifies the draft settings
+     * @return Keys changed (0 if nothing changed or the draft was invalid)
+     */
+    SettingKeySet applyAutomatic(const std::function<void(SettingsSnapshot&)>& edit);
+    
+    /**
+     * @brief Undo the active profile's latest recorded transaction
+     *
+     * Restores the values the transaction replaced in the active profile,
+     * as a new transaction that observers receive like any other.
+     * @return False if there is nothing to undo
+     */
+    bool undo();
+    
+    /**
+     * @brief Reapply the transaction undone last
+     * @return False if there is nothing to redo
+     */
+    bool redo();
+    
+    /**
+     * @brief Copy the active profile's recorded changes, oldest first
+     *
+     * Includes undone entries that can still be redone.
+     * @return Audit entries
+     */
+    std::vector<SettingsAuditEntry> getAuditLog() const;
+    
+    /**
+     * @brief Choose whether saveSettings stores the undo history
+     * @param enabled True to save undoable entries with the settings
+     */
+    void setHistoryPersistence(bool enabled);
+    
+    /**
+     * @brief Register an observer for changes to any of the given keys
+     * @param keys Keys of interest
+     * @param observer Callback receiving each matching transaction once
+     * @return Handle for unsubscribe()
+     */
+    SubscriptionId subscribe(std::initializer_list<SettingKey> keys, SettingsObserver observer);
+    
+    /**
+     * @brief Remove an observer
+     * @param id Handle from subscribe()
+     * @return True if the observer was registered
+     */
+    bool unsubscribe(SubscriptionId id);
+    
+    /**
+     * @brief Create a profile holding a copy of the current settings
+     *
+     * The copy shares the current snapshot until either profile changes.
+     * @param name Profile name (1 to MAX_PROFILE_NAME bytes)
+     * @return False if the name is invalid or taken
+     */
+    bool createProfile(const std::string& name);
+    
+    /**
+     * @brief Make a profile the active one
+     *
+     * Publishes the profile's snapshot with one pointer swap; observers are
+     * called only for keys whose values differ from the previous profile.
+     * undo() and redo() then work on the new profile's history.
+     * @param name Profile to activate
+     * @return False if no such profile exists
+     */
+    bool switchProfile(const std::string& name);
+    
+    /**
+     * @brief Delete an inactive profile
+     * @param name Profile to delete
+     * @return False if the profile is unknown or active
+     */
+    bool deleteProfile(const std::string& name);
+    
+    /**
+     * @brief Get the name of the active profile
+     * @return Active profile name
+     */
+    std::string getActiveProfile() const;
+    
+    /**
+     * @brief Get all profile names
+     * @return Names in alphabetical order
+     */
+    std::vector<std::string> getProfileNames() const;
+    
+    /**
+     * @brief Set any setting through its schema row
+     *
+     * INTEGER values are clamped to the row's range; BOOLEAN and CHOICE
+     * values outside it are rejected with a warning. The new value is
+     * printed, and announced if the row asks for it.
+     * @param key Setting to change
+     * @param value Value as an int (see SettingSpec)
+     * @return False if the value was rejected
+     */
+    bool setValue(SettingKey key, int value);
+    
+    /**
+     * @brief Get any setting as an int
+     * @param key Setting to read
+     * @return Value as an int (see SettingSpec)
+     */
+    int getValue(SettingKey key) const;
+    
     /**
      * @brief Set system volume
      * @param volume Volume level (0-100)
@@ -107,6 +392,8 @@ public:
     
     /**
      * @brief Enable or disable night mode
+     *
+     * Enabling night mode lowers brightness to 30% in the same transaction.
      * @param enabled True to enable night mode
      */
     void setNightMode(bool enabled);
@@ -171,19 +458,105 @@ public:
     void displaySettings() const;
     
     /**
-     * @brief Reset all settings to defaults
+     * @brief Reset the active profile to defaults
+     *
+     * Recorded like any other transaction, so undo() brings the values back.
      */
     void resetToDefaults();
     
     /**
-     * @brief Save settings to file (simulated)
+     * @brief Save every profile to a compact binary file
+     *
+     * Each profile stores only the values that differ from the defaults.
+     * With history persistence on, the active profile's undoable history
+     * follows them; other profiles' histories last for the session only.
+     * The file is written to a temporary name, fsynced and renamed over
+     * the old one, so a power cut leaves either the old or the new
+     * settings, never a mix.
+     * @param path Settings file
+     * @return True on success
+     */
+    bool saveSettings(const std::string& path);
+    
+    /**
+     * @brief Load settings from a file written by saveSettings
+     *
+     * The file is read in one call and checked (magic, version, length,
+     * CRC-32, value ranges) before any setting changes. Version 1 files
+     * load as the default profile; a saved history replaces the current one. A damaged file restores a single
+     * default profile; a missing file leaves settings unchanged.
+     * @param path Settings file
+     * @return True if the saved settings were applied
+     */
+    bool loadSettings(const std::string& path);
+    
+    /**
+     * @brief Write every profile as editable text
+     *
+     * Each profile lists all settings, with choices by name. Importing the
+     * text restores exactly the state saveSettings would store.
+     * @param text Receives the text
+     * @return False if a profile name cannot be written as text (line
+     *         breaks, or leading/trailing blanks in the active profile)
+     */
+    bool exportSettingsText(std::string& text) const;
+    
+    /**
+     * @brief Write every profile to a text file for editing or provisioning
+     * @param path Text file
+     * @return True on success
+     */
+    bool exportSettings(const std::string& path) const;
+    
+    /**
+     * @brief Replace all profiles with those in settings text
+     *
+     * The whole text is checked before anything changes; the active
+     * profile is then published like a reloaded settings file. Keys left
+     * out of a profile take their defaults. The undo history is kept and
+     * the import is recorded in it as one transaction.
+     * @param text Text in the SettingsTextParser format
+     * @param error Receives the line and column of the first problem
+     * @return True if the text was applied
+     */
+    bool importSettingsText(std::string_view text, SettingsTextError& error);
+    
+    /**
+     * @brief Import a settings text file, warning with the error position
+     * @param path Text file
+     * @return True if the file was applied
+     */
+    bool importSettings(const std::string& path);
+    
+    /**
+     * @brief Apply a settings file pushed while running
+     *
+     * The file is parsed and validated before the writer lock is taken;
+     * the new active profile is then published with one pointer swap, so
+     * readers see the old settings or the new ones, never a mix, and
+     * observers hear only about keys that changed. The changes are
+     * recorded as one undoable transaction. A damaged or missing file is
+     * rejected and the current settings stay in place.
+     * @param path Settings file
+     * @return True if the file was applied
+     */
+    bool reloadSettings(const std::string& path);
+    
+    /**
+     * @brief Reload the settings file whenever it is replaced
+     *
+     * Reloads run on a background thread, as do the observers they trigger.
+     * Saving through saveSettings also triggers a reload, which changes
+     * nothing because the file matches the current settings.
+     * @param path Settings file
+     * @return False if the file cannot be watched
      */
-    void saveSettings();
+    bool watchSettings(const std::string& path);
     
     /**
-     * @brief Load settings from file (simulated)
+     * @brief Stop reloading the settings file
      */
-    void loadSettings();
+    void stopWatching();
     
     /**
      * @brief Convert theme enum to string
@@ -0,0 +1,171 @@
+/**
+ * @file TaskScheduler.h
+ * @brief Work-stealing thread pool shared by all subsystems
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "WorkStealingDeque.h"
+
+/**
+ * @brief Scheduling priority of a task
+ */
+enum class TaskPriority {
+    HIGH,       ///< Latency-sensitive work (e.g. a route the driver is waiting for)
+    NORMAL,     ///< Default
+    LOW         ///< Background work (scans, indexing)
+};
+
+constexpr size_t TASK_PRIORITY_COUNT = 3;  ///< Number of TaskPriority values
+
+/**
+ * @brief Runs tasks on a fixed set of worker threads with work stealing
+ *
+ * Each worker owns one Chase-Lev deque per priority. Tasks submitted from
+ * a worker go to its own deque; tasks submitted from other threads go to
+ * a shared injection queue. A worker looking for work takes, for each
+ * priority from HIGH to LOW, the newest task of its own deque, then the
+ * oldest injected task, then the oldest task of another worker's deque,
+ * so a HIGH task is started before any queued NORMAL or LOW one. Idle
+ * workers spin briefly and then sleep until a task is submitted.
+ *
+ * parallelFor() splits a range in halves, keeping one and queueing the
+ * other, until pieces are no larger than the grain; the calling thread
+ * works on the range too and runs other queued tasks while it waits, so
+ * nested parallel loops cannot deadlock the pool.
+ *
+ * Tasks must not throw and should not block on I/O; long-lived blocking
+ * loops (such as FileWatcher) keep their own thread.
+ */
+class TaskScheduler {
+public:
+    using Task = std::function<void()>;                             ///< Unit of work
+    using RangeBody = std::function<void(size_t, size_t)>;          ///< Processes [begin, end)
+
+private:
+    /**
+     * @brief Worker thread and its deques
+     */
+    struct Worker {
+        std::array<WorkStealingDeque<Task>, TASK_PRIORITY_COUNT> deques;   ///< Own tasks by priority
+        std::thread thread;                                                 ///< Thread running workerLoop
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;               ///< Workers, by index
+    std::mutex injectMutex;                                     ///< Guards injected
+    std::array<std::deque<Task*>, TASK_PRIORITY_COUNT> injected;    ///< Tasks from non-worker threads
+    std::atomic<size_t> injectedCount;                          ///< Tasks in injected (read without the lock)
+    std::atomic<size_t> queuedCount;                            ///< Tasks queued and not yet taken
+    std::atomic<size_t> unfinishedCount;                        ///< Tasks submitted and not yet finished
+    std::mutex sleepMutex;                                      ///< Guards sleeping workers' wait
+    std::condition_variable wakeSignal;                         ///< Wakes sleeping workers
+    std::atomic<size_t> sleepingCount;                          ///< Workers waiting on wakeSignal
+    std::atomic<bool> stopping;                                 ///< Set by the destructor
+
+    /**
+     * @brief Index of the calling thread among this scheduler's workers
+     * @return Index, or -1 for other threads
+     */
+    int currentWorker() const;
+
+    /**
+     * @brief Queue a task on the caller's deque or the injection queue
+     */
+    void enqueue(Task* task, TaskPriority priority);
+
+    /**
+     * @brief Take the best available task
+     * @param self Caller's worker index, or -1
+     * @return Task, or null if none was found
+     */
+    Task* findTask(int self);
+
+    /**
+     * @brief Run a task taken by findTask and free it
+     */
+    void execute(Task* task);
+
+    /**
+     * @brief Body of worker thread 'index'
+     */
+    void workerLoop(int index);
+
+    /**
+     * @brief Process [begin, end), queueing halves larger than the grain
+     */
+    void splitRange(size_t begin, size_t end, size_t grain, const RangeBody& body, TaskPriority priority,
+                    std::atomic<size_t>& pending);
+
+public:
+    /**
+     * @brief Process-wide scheduler with one worker per core besides the caller
+     * @return Scheduler instance
+     */
+    static TaskScheduler& instance();
+
+    /**
+     * @brief Start a scheduler
+     * @param workerCount Worker threads; 0 runs every task on the submitting thread
+     */
+    explicit TaskScheduler(unsigned workerCount);
+
+    /**
+     * @brief Finish every queued task, then stop the workers
+     */
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /**
+     * @brief Run a task on a worker
+     * @param task Task
+     * @param priority Scheduling priority
+     */
+    void submit(Task task, TaskPriority priority = TaskPriority::NORMAL);
+
+    /**
+     * @brief Process [begin, end) in parallel and return when all of it is done
+     * @param begin First index
+     * @param end One past the last index
+     * @param grain Largest piece handed to body in one call (0 counts as 1)
+     * @param body Called with disjoint sub-ranges, possibly concurrently
+     * @param priority Priority of the queued pieces
+     */
+    void parallelFor(size_t begin, size_t end, size_t grain, const RangeBody& body,
+                     TaskPriority priority = TaskPriority::NORMAL);
+
+    /**
+     * @brief Help run tasks until every submitted task has finished
+     *
+     * Call from outside the scheduler's tasks; a task waiting for itself
+     * would never return.
+     */
+    void waitIdle();
+
+    /**
+     * @brief Number of worker threads
+     * @return Worker count
+     */
+    unsigned getWorkerCount() const;
+
+    /**
+     * @brief Threads that work on a parallelFor: the workers plus the caller
+     * @return Worker count + 1
+     */
+    unsigned getConcurrency() const;
+};
+
+#endif // TASK_SCHEDULER_H
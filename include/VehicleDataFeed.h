@@ -0,0 +1,88 @@
+/**
+ * @file VehicleDataFeed.h
+ * @brief Routes NMEA, CAN and telemetry text lines to the vehicle subsystems
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef VEHICLE_DATA_FEED_H
+#define VEHICLE_DATA_FEED_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include "GPSNavigator.h"
+#include "VehicleMonitor.h"
+
+/**
+ * @brief Text formats accepted by VehicleDataFeed
+ */
+enum class FeedFormat {
+    TELEMETRY,  ///< "<sensor> <value>" lines, e.g. "speed 72.5"
+    NMEA,       ///< NMEA 0183 sentences from a GPS receiver
+    CAN,        ///< candump logs of OBD-II responses
+    COUNT       ///< Number of formats
+};
+
+/**
+ * @brief Per-format input counters
+ */
+struct FeedCounters {
+    uint64_t lines;     ///< Non-empty lines received
+    uint64_t bytes;     ///< Bytes in those lines
+    uint64_t rejected;  ///< Lines that could not be parsed
+};
+
+/**
+ * @brief Applies sensor input lines to VehicleMonitor and GPSNavigator
+ *
+ * Telemetry lines name a sensor and a value: engine_temp, fuel, speed,
+ * brake_wear, heading, or "position <lat> <lon>". NMEA RMC/GGA sentences
+ * update the GPS; OBD-II coolant, speed, fuel level and fuel rate
+ * responses update the vehicle monitor. Lines are parsed in place; the
+ * feed keeps counters per format for throughput reporting.
+ */
+class VehicleDataFeed {
+private:
+    std::shared_ptr<VehicleMonitor> vehicle;    ///< Receives engine, fuel, speed and brake data
+    std::shared_ptr<GPSNavigator> gps;          ///< Receives position, motion and fix quality
+    std::array<FeedCounters, static_cast<size_t>(FeedFormat::COUNT)> counters;  ///< By format
+
+    bool applyTelemetry(std::string_view line);
+    bool applyNmea(std::string_view line);
+    bool applyCan(std::string_view line);
+
+public:
+    /**
+     * @brief Constructor
+     * @param vehicleMonitor Vehicle monitor to update
+     * @param gpsNavigator GPS navigator to update
+     */
+    VehicleDataFeed(std::shared_ptr<VehicleMonitor> vehicleMonitor, std::shared_ptr<GPSNavigator> gpsNavigator);
+
+    /**
+     * @brief Apply one input line
+     *
+     * Blank lines and '#' comments are ignored and not counted.
+     * @param format Format of the line
+     * @param line Line without its terminator
+     * @return False if the line was rejected
+     */
+    bool apply(FeedFormat format, std::string_view line);
+
+    /**
+     * @brief Access the counters of one format
+     * @param format Format
+     * @return Counters since construction
+     */
+    const FeedCounters& getCounters(FeedFormat format) const;
+
+    /**
+     * @brief Lower-case name of a format, as used on the command line
+     * @param format Format
+     * @return "telemetry", "nmea" or "can"
+     */
+    static const char* formatName(FeedFormat format);
+};
+
+#endif // VEHICLE_DATA_FEED_H
@@ -0,0 +1,53 @@
+/**
+ * @file VehicleEvents.h
+ * @brief Events exchanged between vehicle subsystems and the bus carrying them
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef VEHICLE_EVENTS_H
+#define VEHICLE_EVENTS_H
+
+#include "EventBus.h"
+#include "SettingsSchema.h"
+
+/**
+ * @brief Ground speed measured by the GPS receiver
+ */
+struct SpeedChangedEvent {
+    double speedKmh;    ///< Speed in km/h
+};
+
+/**
+ * @brief New valid GPS position
+ */
+struct PositionChangedEvent {
+    double latitude;    ///< Latitude in decimal degrees
+    double longitude;   ///< Longitude in decimal degrees
+    double altitude;    ///< Altitude in meters
+};
+
+/**
+ * @brief Settings transaction that changed at least one value
+ *
+ * Unlike SettingsChange it holds copies of both snapshots, so it can be
+ * queued for another thread.
+ */
+struct SettingsChangedEvent {
+    SettingKeySet changed;          ///< Keys whose value differs
+    SettingsSnapshot previous;      ///< Settings before the transaction
+    SettingsSnapshot current;       ///< Settings after the transaction
+
+    /**
+     * @brief Check whether a key changed
+     * @param key Setting key
+     * @return True if the transaction changed it
+     */
+    bool contains(SettingKey key) const { return (changed & settingBit(key)) != 0; }
+};
+
+/**
+ * @brief Bus connecting the vehicle subsystems
+ */
+using VehicleEventBus = EventBus<SpeedChangedEvent, PositionChangedEvent, SettingsChangedEvent>;
+
+#endif // VEHICLE_EVENTS_H
@@ -25,6 +25,7 @@ private:
     double fuelConsumptionRate;         ///< Fuel consumption in L/100km
     double currentSpeed;                ///< Current speed in km/h
     double brakeWearLevel;              ///< Brake wear as percentage (100 = new, 0 = worn out)
+    bool speedSimulated;                ///< Whether simulateRealTimeUpdate also moves the speed
     
     // Threshold values
     static constexpr double MAX_ENGINE_TEMP = 105.0;        ///< Maximum safe engine temperature
@@ -32,28 +33,61 @@ private:
     static constexpr double CRITICAL_FUEL_THRESHOLD = 5.0;  ///< Critical fuel alert threshold
     static constexpr double MAX_SPEED_LIMIT = 120.0;        ///< Speed limit for alerts
     static constexpr double MIN_BRAKE_THRESHOLD = 20.0;     ///< Minimum brake wear threshold
+    static constexpr double SIMULATED_ENGINE_TEMP = 90.0;   ///< Temperature the simulation settles at
+    static constexpr double SIMULATED_CRUISE_SPEED = 60.0;  ///< Speed the simulation settles at
+    
+    /**
+     * @brief Severity of a sensor's condition
+     */
+    enum class SensorAlert {
+        NONE,       ///< Within normal range
+        WARNING,    ///< Warning threshold crossed
+        CRITICAL    ///< Critical threshold crossed
+    };
+    
+    SensorAlert engineAlert;            ///< Engine temperature condition last seen
+    SensorAlert fuelAlert;              ///< Fuel level condition last seen
+    SensorAlert speedAlert;             ///< Speed condition last seen
+    SensorAlert brakeAlert;             ///< Brake wear condition last seen
     
     std::shared_ptr<NotificationManager> notificationManager;   ///< Notification system reference
     
+    /**
+     * @brief Remember a sensor's condition and decide whether to alert
+     *
+     * Readings arrive every second; alerting only when the condition
+     * changes keeps a sensor that stays out of range from repeating the
+     * same alert.
+     * @param last Condition seen before; updated to current
+     * @param current Condition now
+     * @param force Alert even if the condition is unchanged
+     * @return True if an alert should be raised
+     */
+    static bool shouldAlert(SensorAlert& last, SensorAlert current, bool force);
+    
     /**
      * @brief Check engine temperature and trigger alerts if necessary
+     * @param force Alert even if the condition was already reported
      */
-    void checkEngineTemperature();
+    void checkEngineTemperature(bool force = false);
     
     /**
      * @brief Check fuel levels and trigger alerts if necessary
+     * @param force Alert even if the condition was already reported
      */
-    void checkFuelLevel();
+    void checkFuelLevel(bool force = false);
     
     /**
      * @brief Check current speed and trigger alerts if necessary
+     * @param force Alert even if the condition was already reported
      */
-    void checkSpeed();
+    void checkSpeed(bool force = false);
     
     /**
      * @brief Check brake system health and trigger alerts if necessary
+     * @param force Alert even if the condition was already reported
      */
-    void checkBrakeSystem();
+    void checkBrakeSystem(bool force = false);
     
 public:
     /**
@@ -136,9 +170,20 @@ public:
     
     /**
      * @brief Simulate real-time data updates (for demonstration)
+     *
+     * One call stands for about a second of driving.
      */
     void simulateRealTimeUpdate();
     
+    /**
+     * @brief Choose whether the simulation owns the speed reading
+     *
+     * Turn off when another source sets the speed (e.g. GPS ground speed
+     * over the event bus), so each reading has one model behind it.
+     * @param enabled True to simulate speed (default)
+     */
+    void setSpeedSimulation(bool enabled);
+    
     /**
      * @brief Calculate estimated range based on current fuel and consumption
      * @return Estimated range in kilometers
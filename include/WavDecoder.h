@@ -0,0 +1,51 @@
+/**
+ * @file WavDecoder.h
+ * @brief RIFF/WAVE PCM decoder with constant-time seeking
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef WAV_DECODER_H
+#define WAV_DECODER_H
+
+#include "AudioDecoder.h"
+#include <fstream>
+#include <vector>
+
+/**
+ * @brief Decodes 8/16/24/32-bit integer and 32-bit float WAV files
+ *
+ * Every frame has the same size, so seek() is a single file seek to
+ * dataOffset + frame * blockAlign. read() converts through a buffer of
+ * READ_CHUNK_FRAMES frames allocated by open().
+ */
+class WavDecoder : public AudioDecoder {
+private:
+    std::ifstream file;                 ///< Open audio file
+    uint64_t dataOffset;                ///< File offset of the first frame
+    uint64_t totalFrames;               ///< Frames in the data chunk
+    uint64_t position;                  ///< Next frame to read
+    uint32_t sampleRate;                ///< Sample rate in Hz
+    uint16_t channels;                  ///< Channels per frame
+    uint16_t bitsPerSample;             ///< Container bits per sample
+    uint16_t blockAlign;                ///< Bytes per frame
+    bool floatSamples;                  ///< IEEE float rather than integer PCM
+    std::vector<unsigned char> scratch; ///< Raw bytes of the block being converted, sized by open()
+
+public:
+    static constexpr size_t READ_CHUNK_FRAMES = 4096;   ///< Frames converted per file read
+
+    /**
+     * @brief Default constructor (no file open)
+     */
+    WavDecoder();
+
+    bool open(const std::string& path) override;
+    size_t read(float* out, size_t frames) override;
+    bool seek(uint64_t frame) override;
+    uint64_t tell() const override;
+    uint64_t getTotalFrames() const override;
+    uint32_t getSampleRate() const override;
+    uint16_t getChannels() const override;
+};
+
+#endif // WAV_DECODER_H
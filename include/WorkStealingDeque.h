@@ -0,0 +1,133 @@
+/**
+ * @file WorkStealingDeque.h
+ * @brief Chase-Lev work-stealing deque of task pointers
+ * @author AI-Enhanced Development System
+ */
+
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Deque owned by one worker thread that other threads may steal from
+ *
+ * The owner pushes and pops at the bottom (newest first, so work it just
+ * split off stays in its cache); thieves take from the top (oldest first,
+ * so they get the largest remaining pieces). Push and pop touch only the
+ * owner's end and synchronize with thieves only when one item is left;
+ * steal() is a single compare-and-swap. This is the Chase-Lev deque with
+ * the memory orderings of Le, Pop, Cohen and Zappa Nardelli (2013).
+ *
+ * The ring doubles when full. Thieves may still be reading the ring it
+ * replaced, so replaced rings are kept until the deque is destroyed; their
+ * total size never exceeds the current ring's.
+ */
+template <typename T>
+class WorkStealingDeque {
+private:
+    /**
+     * @brief Power-of-two circular array indexed by the unbounded positions
+     */
+    struct Ring {
+        int64_t mask;                               ///< Capacity - 1
+        std::unique_ptr<std::atomic<T*>[]> slots;   ///< Items
+
+        explicit Ring(int64_t capacity) : mask(capacity - 1), slots(new std::atomic<T*>[capacity]) {}
+
+        int64_t capacity() const { return mask + 1; }
+        T* get(int64_t index) const { return slots[index & mask].load(std::memory_order_relaxed); }
+        void put(int64_t index, T* item) { slots[index & mask].store(item, std::memory_order_relaxed); }
+    };
+
+    alignas(64) std::atomic<int64_t> top;           ///< Next position to steal (written by thieves)
+    alignas(64) std::atomic<int64_t> bottom;        ///< Next position to push (written by the owner)
+    std::atomic<Ring*> ring;                        ///< Current ring
+    std::vector<std::unique_ptr<Ring>> rings;       ///< Every ring allocated, current one last (owner only)
+
+public:
+    static constexpr int64_t INITIAL_CAPACITY = 256;   ///< Slots before the first growth
+
+    WorkStealingDeque() : top(0), bottom(0), ring(nullptr) {
+        rings.push_back(std::make_unique<Ring>(INITIAL_CAPACITY));
+        ring.store(rings.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Add an item at the bottom; owner thread only
+     * @param item Item (not null)
+     */
+    void push(T* item) {
+        const int64_t b = bottom.load(std::memory_order_relaxed);
+        const int64_t t = top.load(std::memory_order_acquire);
+        Ring* current = ring.load(std::memory_order_relaxed);
+        if (b - t >= current->capacity()) {
+            auto grown = std::make_unique<Ring>(current->capacity() * 2);
+            for (int64_t i = t; i < b; ++i) grown->put(i, current->get(i));
+            current = grown.get();
+            rings.push_back(std::move(grown));
+            ring.store(current, std::memory_order_release);
+        }
+        current->put(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Take the newest item; owner thread only
+     * @return Item, or null if the deque is empty
+     */
+    T* pop() {
+        const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Ring* current = ring.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T* item = current->get(b);
+        if (t == b) {
+            // Last item: race the thieves for it
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    /**
+     * @brief Take the oldest item; any thread
+     * @return Item, or null if the deque is empty or another thread won the race
+     */
+    T* steal() {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) return nullptr;
+        T* item = ring.load(std::memory_order_acquire)->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    /**
+     * @brief Whether the deque looked empty (exact only on the owner thread)
+     * @return True if no items were visible
+     */
+    bool empty() const {
+        return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+};
+
+#endif // WORK_STEALING_DEQUE_H
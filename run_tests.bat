@@ -10,7 +10,7 @@ set TESTS_PASSED=0
 set TESTS_FAILED=0
 
 REM Run Integration Tests
-echo [1/3] Running Integration Tests...
+echo [1/5] Running Integration Tests...
 echo ---------------------------------------------
 bin\test_integration.exe
 if errorlevel 1 (
@@ -23,7 +23,7 @@ if errorlevel 1 (
 echo.
 
 REM Run Vehicle Monitor Tests
-echo [2/3] Running Vehicle Monitor Tests...
+echo [2/5] Running Vehicle Monitor Tests...
 echo ---------------------------------------------
 bin\test_vehicle_monitor.exe
 if errorlevel 1 (
@@ -36,7 +36,7 @@ if errorlevel 1 (
 echo.
 
 REM Run GPS Navigator Tests
-echo [3/3] Running GPS Navigator Tests...
+echo [3/5] Running GPS Navigator Tests...
 echo ---------------------------------------------
 bin\test_gps_navigator.exe
 if errorlevel 1 (
@@ -48,6 +48,32 @@ if errorlevel 1 (
 )
 echo.
 
+REM Run Media Player Tests
+echo [4/5] Running Media Player Tests...
+echo ---------------------------------------------
+bin\test_media_player.exe
+if errorlevel 1 (
+    echo ❌ Media Player tests FAILED
+    set /a TESTS_FAILED+=1
+) else (
+    echo ✅ Media Player tests PASSED
+    set /a TESTS_PASSED+=1
+)
+echo.
+
+REM Run System Settings Tests
+echo [5/5] Running System Settings Tests...
+echo ---------------------------------------------
+bin\test_system_settings.exe
+if errorlevel 1 (
+    echo ❌ System Settings tests FAILED
+    set /a TESTS_FAILED+=1
+) else (
+    echo ✅ System Settings tests PASSED
+    set /a TESTS_PASSED+=1
+)
+echo.
+
 REM Summary
 echo =============================================
 echo TEST SUMMARY
@@ -0,0 +1,340 @@
+/**
+ * @file ArtworkCache.cpp
+ * @brief Implementation of the ArtworkCache class
+ */
+
+#include "ArtworkCache.h"
+#include "BinaryIO.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+namespace {
+const size_t PACK_HEADER_SIZE = 8;
+const uint32_t MAX_PATH_LENGTH = 4096;
+
+uint16_t toRgb565(uint32_t r, uint32_t g, uint32_t b) {
+    return static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+bool readU32(std::istream& in, uint32_t& value) {
+    uint8_t b[4];
+    if (!in.read(reinterpret_cast<char*>(b), sizeof(b))) return false;
+    value = b[0] | (static_cast<uint32_t>(b[1]) << 8) | (static_cast<uint32_t>(b[2]) << 16) |
+            (static_cast<uint32_t>(b[3]) << 24);
+    return true;
+}
+
+bool readU16(std::istream& in, uint16_t& value) {
+    uint8_t b[2];
+    if (!in.read(reinterpret_cast<char*>(b), sizeof(b))) return false;
+    value = static_cast<uint16_t>(b[0] | (b[1] << 8));
+    return true;
+}
+} // namespace
+
+ArtworkCache::ArtworkCache(size_t memoryBudgetBytes, uint16_t thumbnailEdge)
+    : memoryBudget(memoryBudgetBytes), thumbnailSize(thumbnailEdge),
+      memoryUsage(0), hits(0), misses(0) {}
+
+bool ArtworkCache::open(const std::string& packPath) {
+    std::lock_guard<std::mutex> lock(mutex);
+    pack.close();
+    index.clear();
+    resident.clear();
+    lru.clear();
+    memoryUsage = 0;
+
+    std::error_code ec;
+    if (!std::filesystem::exists(packPath, ec)) {
+        BinaryWriter header;
+        header.u32(PACK_MAGIC);
+        header.u32(PACK_VERSION);
+        if (!writeFileContents(packPath, header.data())) return false;
+    }
+
+    pack.open(packPath, std::ios::in | std::ios::out | std::ios::binary);
+    uint32_t magic = 0, version = 0;
+    if (!pack || !readU32(pack, magic) || !readU32(pack, version) ||
+        magic != PACK_MAGIC || version != PACK_VERSION) {
+        pack.close();
+        return false;
+    }
+
+    // Index record headers only; pixel data is skipped with a seek
+    const uint64_t fileSize = std::filesystem::file_size(packPath, ec);
+    uint64_t validEnd = PACK_HEADER_SIZE;
+    uint64_t deadBytes = 0;
+    std::string path;
+    while (true) {
+        uint32_t pathLength = 0;
+        uint16_t width = 0, height = 0;
+        if (!readU32(pack, pathLength) || pathLength > MAX_PATH_LENGTH) break;
+        path.resize(pathLength);
+        if (!pack.read(&path[0], pathLength) || !readU16(pack, width) || !readU16(pack, height)) break;
+        const uint64_t offset = validEnd + 4 + pathLength + 4;
+        const uint64_t end = offset + static_cast<uint64_t>(width) * height * sizeof(uint16_t);
+        if (end > fileSize) break;
+        auto replaced = index.find(path);
+        if (replaced != index.end()) {
+            deadBytes += 4 + pathLength + 4 +
+                         static_cast<uint64_t>(replaced->second.width) * replaced->second.height * sizeof(uint16_t);
+        }
+        index[path] = PackEntry{offset, width, height};
+        validEnd = end;
+        pack.seekg(static_cast<std::streamoff>(end));
+    }
+    pack.clear();
+
+    if (validEnd < fileSize) {
+        pack.close();
+        std::filesystem::resize_file(packPath, validEnd, ec);
+        pack.open(packPath, std::ios::in | std::ios::out | std::ios::binary);
+    }
+    // Re-stored thumbnails leave their old records behind as dead space
+    if (pack && deadBytes * 4 >= validEnd && deadBytes > 0) {
+        compact(packPath);
+    }
+    return static_cast<bool>(pack);
+}
+
+bool ArtworkCache::compact(const std::string& packPath) {
+    // Copy records in file order so the old pack is read sequentially
+    std::vector<std::pair<const std::string*, PackEntry*>> live;
+    live.reserve(index.size());
+    for (auto& entry : index) {
+        live.emplace_back(&entry.first, &entry.second);
+    }
+    std::sort(live.begin(), live.end(),
+              [](const auto& a, const auto& b) { return a.second->offset < b.second->offset; });
+
+    const std::string tempPath = packPath + ".tmp";
+    std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+    BinaryWriter header;
+    header.u32(PACK_MAGIC);
+    header.u32(PACK_VERSION);
+    out.write(header.data().data(), static_cast<std::streamsize>(header.data().size()));
+
+    std::vector<uint64_t> offsets;
+    offsets.reserve(live.size());
+    uint64_t written = PACK_HEADER_SIZE;
+    std::vector<char> pixels;
+    bool copied = static_cast<bool>(out);
+    for (size_t i = 0; copied && i < live.size(); ++i) {
+        const PackEntry& entry = *live[i].second;
+        BinaryWriter record;
+        record.str(*live[i].first);
+        record.u16(entry.width);
+        record.u16(entry.height);
+        // Pixels are copied as stored, so no byte swapping is needed
+        pixels.resize(static_cast<size_t>(entry.width) * entry.height * sizeof(uint16_t));
+        pack.seekg(static_cast<std::streamoff>(entry.offset));
+        copied = static_cast<bool>(pack.read(pixels.data(), static_cast<std::streamsize>(pixels.size())));
+        out.write(record.data().data(), static_cast<std::streamsize>(record.data().size()));
+        out.write(pixels.data(), static_cast<std::streamsize>(pixels.size()));
+        offsets.push_back(written + record.data().size());
+        written += record.data().size() + pixels.size();
+    }
+    copied = copied && static_cast<bool>(out.flush());
+    out.close();
+
+    std::error_code ec;
+    if (copied) {
+        pack.close();
+        std::filesystem::rename(tempPath, packPath, ec);
+        pack.open(packPath, std::ios::in | std::ios::out | std::ios::binary);
+    }
+    if (!copied || ec) {
+        pack.clear();
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    for (size_t i = 0; i < live.size(); ++i) {
+        live[i].second->offset = offsets[i];
+    }
+    return static_cast<bool>(pack);
+}
+
+void ArtworkCache::setDecoder(ImageDecoder imageDecoder) {
+    std::lock_guard<std::mutex> lock(mutex);
+    decoder = std::move(imageDecoder);
+}
+
+bool ArtworkCache::importFromFile(const std::string& audioPath) {
+    ImageDecoder decode;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        decode = decoder;
+    }
+    EmbeddedArtwork artwork;
+    DecodedImage image;
+    if (!decode || !ArtworkExtractor::extract(audioPath, artwork) || !decode(artwork, image)) {
+        return false;
+    }
+    return store(audioPath, image);
+}
+
+bool ArtworkCache::store(const std::string& audioPath, const DecodedImage& image) {
+    auto thumbnail = std::make_shared<Thumbnail>(downscale(image, thumbnailSize));
+    if (thumbnail->pixels.empty() || audioPath.size() > MAX_PATH_LENGTH) return false;
+
+    BinaryWriter record;
+    record.reserve(8 + audioPath.size() + thumbnail->byteSize());
+    record.str(audioPath);
+    record.u16(thumbnail->width);
+    record.u16(thumbnail->height);
+    if (isLittleEndianHost()) {
+        record.bytes(thumbnail->pixels.data(), thumbnail->byteSize());
+    } else {
+        for (uint16_t pixel : thumbnail->pixels) record.u16(pixel);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!pack.is_open()) return false;
+    pack.seekp(0, std::ios::end);
+    const uint64_t recordStart = static_cast<uint64_t>(pack.tellp());
+    pack.write(record.data().data(), static_cast<std::streamsize>(record.data().size()));
+    pack.flush();
+    if (!pack) {
+        pack.clear();
+        return false;
+    }
+
+    index[audioPath] = PackEntry{recordStart + 4 + audioPath.size() + 4, thumbnail->width, thumbnail->height};
+    makeResident(audioPath, std::move(thumbnail));
+    return true;
+}
+
+bool ArtworkCache::contains(const std::string& audioPath) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return index.count(audioPath) != 0;
+}
+
+std::shared_ptr<const Thumbnail> ArtworkCache::get(const std::string& audioPath) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto cached = resident.find(audioPath);
+    if (cached != resident.end()) {
+        ++hits;
+        lru.splice(lru.begin(), lru, cached->second.lruPosition);
+        return cached->second.thumbnail;
+    }
+
+    auto entry = index.find(audioPath);
+    if (entry == index.end()) return nullptr;
+    ++misses;
+
+    auto thumbnail = std::make_shared<Thumbnail>();
+    thumbnail->width = entry->second.width;
+    thumbnail->height = entry->second.height;
+    thumbnail->pixels.resize(static_cast<size_t>(thumbnail->width) * thumbnail->height);
+    pack.seekg(static_cast<std::streamoff>(entry->second.offset));
+    if (!pack.read(reinterpret_cast<char*>(thumbnail->pixels.data()),
+                   static_cast<std::streamsize>(thumbnail->byteSize()))) {
+        pack.clear();
+        return nullptr;
+    }
+    if (!isLittleEndianHost()) {
+        for (auto& pixel : thumbnail->pixels) pixel = static_cast<uint16_t>((pixel >> 8) | (pixel << 8));
+    }
+
+    makeResident(audioPath, thumbnail);
+    return thumbnail;
+}
+
+void ArtworkCache::makeResident(const std::string& audioPath, std::shared_ptr<const Thumbnail> thumbnail) {
+    auto previous = resident.find(audioPath);
+    if (previous != resident.end()) {
+        memoryUsage -= previous->second.thumbnail->byteSize();
+        lru.erase(previous->second.lruPosition);
+        resident.erase(previous);
+    }
+
+    const size_t bytes = thumbnail->byteSize();
+    if (bytes > memoryBudget) return;
+    while (memoryUsage + bytes > memoryBudget && !lru.empty()) {
+        auto oldest = resident.find(lru.back());
+        memoryUsage -= oldest->second.thumbnail->byteSize();
+        resident.erase(oldest);
+        lru.pop_back();
+    }
+
+    lru.push_front(audioPath);
+    resident[audioPath] = Resident{std::move(thumbnail), lru.begin()};
+    memoryUsage += bytes;
+}
+
+size_t ArtworkCache::getMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return memoryUsage;
+}
+
+size_t ArtworkCache::getMemoryBudget() const {
+    return memoryBudget;
+}
+
+size_t ArtworkCache::getPackedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return index.size();
+}
+
+size_t ArtworkCache::getHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+size_t ArtworkCache::getMisses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+Thumbnail ArtworkCache::downscale(const DecodedImage& image, uint16_t maxSize) {
+    Thumbnail thumbnail;
+    if (image.width <= 0 || image.height <= 0 || maxSize == 0 ||
+        image.rgb.size() < static_cast<size_t>(image.width) * image.height * 3) {
+        return thumbnail;
+    }
+
+    const int longest = std::max(image.width, image.height);
+    const int outWidth = longest <= maxSize ? image.width : std::max(1, image.width * maxSize / longest);
+    const int outHeight = longest <= maxSize ? image.height : std::max(1, image.height * maxSize / longest);
+    thumbnail.width = static_cast<uint16_t>(outWidth);
+    thumbnail.height = static_cast<uint16_t>(outHeight);
+    thumbnail.pixels.resize(static_cast<size_t>(outWidth) * outHeight);
+
+    // Source column span of every output column, computed once
+    std::vector<int> columnStart(outWidth + 1);
+    for (int x = 0; x <= outWidth; ++x) {
+        columnStart[x] = static_cast<int>(static_cast<int64_t>(x) * image.width / outWidth);
+    }
+
+    std::vector<uint32_t> sums(static_cast<size_t>(outWidth) * 3);
+    for (int y = 0; y < outHeight; ++y) {
+        const int rowBegin = static_cast<int>(static_cast<int64_t>(y) * image.height / outHeight);
+        const int rowEnd = std::max(rowBegin + 1, static_cast<int>(static_cast<int64_t>(y + 1) * image.height / outHeight));
+        std::fill(sums.begin(), sums.end(), 0);
+
+        for (int sy = rowBegin; sy < rowEnd; ++sy) {
+            const uint8_t* row = image.rgb.data() + static_cast<size_t>(sy) * image.width * 3;
+            for (int x = 0; x < outWidth; ++x) {
+                const int end = std::max(columnStart[x] + 1, columnStart[x + 1]);
+                uint32_t r = 0, g = 0, b = 0;
+                for (int sx = columnStart[x]; sx < end; ++sx) {
+                    r += row[sx * 3];
+                    g += row[sx * 3 + 1];
+                    b += row[sx * 3 + 2];
+                }
+                sums[x * 3] += r;
+                sums[x * 3 + 1] += g;
+                sums[x * 3 + 2] += b;
+            }
+        }
+
+        uint16_t* out = thumbnail.pixels.data() + static_cast<size_t>(y) * outWidth;
+        for (int x = 0; x < outWidth; ++x) {
+            const uint32_t count = static_cast<uint32_t>(rowEnd - rowBegin) *
+                                   std::max(1, columnStart[x + 1] - columnStart[x]);
+            out[x] = toRgb565(sums[x * 3] / count, sums[x * 3 + 1] / count, sums[x * 3 + 2] / count);
+        }
+    }
+    return thumbnail;
+}
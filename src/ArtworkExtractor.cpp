@@ -0,0 +1,167 @@
+/**
+ * @file ArtworkExtractor.cpp
+ * @brief Implementation of the ArtworkExtractor class
+ */
+
+#include "ArtworkExtractor.h"
+#include <cstring>
+#include <fstream>
+
+namespace {
+const uint8_t FLAC_BLOCK_PICTURE = 6;
+
+uint32_t readBE32(const uint8_t* p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+           (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+
+uint32_t readSyncsafe32(const uint8_t* p) {
+    return (static_cast<uint32_t>(p[0] & 0x7F) << 21) | (static_cast<uint32_t>(p[1] & 0x7F) << 14) |
+           (static_cast<uint32_t>(p[2] & 0x7F) << 7) | (p[3] & 0x7F);
+}
+
+// Keeps the first picture, but lets a later front cover replace it
+bool offerPicture(EmbeddedArtwork& candidate, EmbeddedArtwork& best, bool& found) {
+    if (!found || (best.pictureType != ArtworkExtractor::FRONT_COVER &&
+                   candidate.pictureType == ArtworkExtractor::FRONT_COVER)) {
+        best = std::move(candidate);
+        found = true;
+    }
+    return best.pictureType == ArtworkExtractor::FRONT_COVER;
+}
+} // namespace
+
+bool ArtworkExtractor::extract(const std::string& audioPath, EmbeddedArtwork& artwork) {
+    std::ifstream file(audioPath, std::ios::binary);
+    if (!file) return false;
+
+    char magic[4] = {};
+    file.read(magic, sizeof(magic));
+    if (!file) return false;
+
+    if (std::memcmp(magic, "fLaC", 4) == 0) {
+        return extractFlac(file, artwork);
+    }
+    if (std::memcmp(magic, "ID3", 3) == 0) {
+        file.seekg(0);
+        return extractId3(file, artwork);
+    }
+    return false;
+}
+
+bool ArtworkExtractor::extractFlac(std::istream& file, EmbeddedArtwork& artwork) {
+    bool found = false;
+    bool last = false;
+    std::vector<uint8_t> block;
+    while (!last) {
+        uint8_t header[4];
+        if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) break;
+        last = (header[0] & 0x80) != 0;
+        uint8_t type = header[0] & 0x7F;
+        uint32_t length = (static_cast<uint32_t>(header[1]) << 16) | (static_cast<uint32_t>(header[2]) << 8) | header[3];
+
+        if (type != FLAC_BLOCK_PICTURE || length > MAX_PICTURE_BYTES) {
+            file.seekg(length, std::ios::cur);
+            continue;
+        }
+        block.resize(length);
+        if (!file.read(reinterpret_cast<char*>(block.data()), length)) break;
+
+        EmbeddedArtwork candidate;
+        if (parseFlacPicture(block.data(), block.size(), candidate) &&
+            offerPicture(candidate, artwork, found)) {
+            break;
+        }
+    }
+    return found;
+}
+
+bool ArtworkExtractor::parseFlacPicture(const uint8_t* block, size_t size, EmbeddedArtwork& artwork) {
+    size_t pos = 0;
+    auto field = [&](uint32_t& value) {
+        if (size - pos < 4) return false;
+        value = readBE32(block + pos);
+        pos += 4;
+        return true;
+    };
+
+    uint32_t pictureType = 0, mimeLength = 0, descriptionLength = 0, dataLength = 0, ignored = 0;
+    if (!field(pictureType) || !field(mimeLength) || mimeLength > size - pos) return false;
+    artwork.mimeType.assign(reinterpret_cast<const char*>(block + pos), mimeLength);
+    pos += mimeLength;
+    if (!field(descriptionLength) || descriptionLength > size - pos) return false;
+    pos += descriptionLength;
+    // Width, height, colour depth and palette size are re-derived by the decoder
+    for (int i = 0; i < 4; ++i) {
+        if (!field(ignored)) return false;
+    }
+    if (!field(dataLength) || dataLength > size - pos) return false;
+
+    artwork.pictureType = static_cast<uint8_t>(pictureType);
+    artwork.data.assign(block + pos, block + pos + dataLength);
+    return true;
+}
+
+bool ArtworkExtractor::extractId3(std::istream& file, EmbeddedArtwork& artwork) {
+    uint8_t header[10];
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) return false;
+    const uint8_t version = header[3];
+    const uint8_t flags = header[5];
+    // ID3v2.2 uses 3-character frame IDs; unsynchronised tags are rare enough to skip
+    if (version < 3 || version > 4 || (flags & 0x80)) return false;
+
+    const uint32_t tagSize = readSyncsafe32(header + 6);
+    if (tagSize > MAX_PICTURE_BYTES) return false;
+    std::vector<uint8_t> tag(tagSize);
+    if (!file.read(reinterpret_cast<char*>(tag.data()), tagSize)) return false;
+
+    size_t pos = 0;
+    if (flags & 0x40) {
+        if (tag.size() < 4) return false;
+        uint32_t extended = version == 4 ? readSyncsafe32(tag.data()) : readBE32(tag.data()) + 4;
+        pos = extended;
+    }
+
+    bool found = false;
+    while (pos + 10 <= tag.size() && tag[pos] != 0) {
+        const uint8_t* frame = tag.data() + pos;
+        uint32_t frameSize = version == 4 ? readSyncsafe32(frame + 4) : readBE32(frame + 4);
+        pos += 10;
+        if (frameSize > tag.size() - pos) break;
+
+        EmbeddedArtwork candidate;
+        if (std::memcmp(frame, "APIC", 4) == 0 &&
+            parseApicFrame(tag.data() + pos, frameSize, candidate) &&
+            offerPicture(candidate, artwork, found)) {
+            break;
+        }
+        pos += frameSize;
+    }
+    return found;
+}
+
+bool ArtworkExtractor::parseApicFrame(const uint8_t* frame, size_t size, EmbeddedArtwork& artwork) {
+    if (size < 4) return false;
+    const uint8_t encoding = frame[0];
+    size_t pos = 1;
+
+    const uint8_t* mimeEnd = static_cast<const uint8_t*>(std::memchr(frame + pos, 0, size - pos));
+    if (mimeEnd == nullptr) return false;
+    artwork.mimeType.assign(reinterpret_cast<const char*>(frame + pos), mimeEnd - (frame + pos));
+    pos = (mimeEnd - frame) + 1;
+    if (pos >= size) return false;
+    artwork.pictureType = frame[pos++];
+
+    // Description: NUL-terminated, UTF-16 variants (1, 2) use a 2-byte terminator
+    if (encoding == 1 || encoding == 2) {
+        while (pos + 1 < size && (frame[pos] != 0 || frame[pos + 1] != 0)) pos += 2;
+        pos += 2;
+    } else {
+        while (pos < size && frame[pos] != 0) ++pos;
+        pos += 1;
+    }
+    if (pos > size) return false;
+
+    artwork.data.assign(frame + pos, frame + size);
+    return !artwork.data.empty();
+}
@@ -0,0 +1,225 @@
+/**
+ * @file AudioDSP.cpp
+ * @brief Implementation of the AudioDSP class
+ */
+
+#include "AudioDSP.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define AUDIO_DSP_SSE 1
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+constexpr float EQ_FREQUENCIES[AudioDSP::EQ_BANDS] = {60.0f, 230.0f, 910.0f, 3600.0f, 14000.0f};
+constexpr float EQ_Q = 1.0f;
+constexpr float FLAT_EQ_DB = 0.01f;
+constexpr float DENORMAL_THRESHOLD = 1e-15f;
+
+/**
+ * @brief Flush filter state that has decayed towards the denormal range
+ */
+inline float flushDenormal(float z) {
+    return std::fabs(z) < DENORMAL_THRESHOLD ? 0.0f : z;
+}
+
+/**
+ * @brief Multiply interleaved samples by a per-frame linear gain ramp
+ * @return Number of samples processed (a multiple of 4)
+ */
+size_t rampVector(float* samples, size_t count, size_t channels, float gain, float step) {
+    size_t i = 0;
+#ifdef AUDIO_DSP_SSE
+    if (channels == 1 || channels == 2) {
+        __m128 gains = channels == 1
+            ? _mm_setr_ps(gain, gain + step, gain + 2.0f * step, gain + 3.0f * step)
+            : _mm_setr_ps(gain, gain, gain + step, gain + step);
+        const __m128 increment = _mm_set1_ps(step * static_cast<float>(4 / channels));
+        for (; i + 4 <= count; i += 4) {
+            __m128 v = _mm_loadu_ps(samples + i);
+            _mm_storeu_ps(samples + i, _mm_mul_ps(v, gains));
+            gains = _mm_add_ps(gains, increment);
+        }
+    }
+#else
+    (void)samples; (void)count; (void)channels; (void)gain; (void)step;
+#endif
+    return i;
+}
+} // namespace
+
+BiquadCoefficients BiquadCoefficients::identity() {
+    return BiquadCoefficients{1.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+}
+
+BiquadCoefficients BiquadCoefficients::peaking(float frequency, float gainDb, float q, int sampleRate) {
+    double a = std::pow(10.0, gainDb / 40.0);
+    double w0 = 2.0 * M_PI * frequency / sampleRate;
+    double alpha = std::sin(w0) / (2.0 * q);
+    double cosW0 = std::cos(w0);
+    double a0 = 1.0 + alpha / a;
+    return BiquadCoefficients{
+        static_cast<float>((1.0 + alpha * a) / a0),
+        static_cast<float>((-2.0 * cosW0) / a0),
+        static_cast<float>((1.0 - alpha * a) / a0),
+        static_cast<float>((-2.0 * cosW0) / a0),
+        static_cast<float>((1.0 - alpha / a) / a0)
+    };
+}
+
+AudioDSP::AudioDSP(int rate, int channelCount)
+    : sampleRate(rate), channels(std::clamp(channelCount, 1, AUDIO_CHANNELS)),
+      volumeGain(0.25f), loudnessGain(1.0f), currentGain(0.25f), rampStep(0.0f),
+      rampFramesRemaining(0) {
+    eqGainsDb.fill(0.0f);
+    eqCoefficients.fill(BiquadCoefficients::identity());
+    reset();
+}
+
+void AudioDSP::retarget() {
+    float target = volumeGain * loudnessGain;
+    rampStep = (target - currentGain) / static_cast<float>(RAMP_FRAMES);
+    rampFramesRemaining = RAMP_FRAMES;
+}
+
+void AudioDSP::setVolume(int percent) {
+    percent = std::clamp(percent, 0, 100);
+    // Square law approximates perceived loudness better than a linear fader
+    float linear = static_cast<float>(percent) / 100.0f;
+    volumeGain = linear * linear;
+    retarget();
+}
+
+void AudioDSP::setLoudnessGain(float gainDb) {
+    loudnessGain = dbToGain(std::clamp(gainDb, -24.0f, 12.0f));
+    retarget();
+}
+
+void AudioDSP::setEqBand(size_t band, float gainDb) {
+    if (band >= EQ_BANDS) return;
+    gainDb = std::clamp(gainDb, -MAX_EQ_GAIN_DB, MAX_EQ_GAIN_DB);
+    eqGainsDb[band] = gainDb;
+    // Filter state is kept so adjusting a band while playing does not click
+    eqCoefficients[band] = std::fabs(gainDb) < FLAT_EQ_DB
+        ? BiquadCoefficients::identity()
+        : BiquadCoefficients::peaking(EQ_FREQUENCIES[band], gainDb, EQ_Q, sampleRate);
+}
+
+float AudioDSP::getEqBand(size_t band) const {
+    return band < EQ_BANDS ? eqGainsDb[band] : 0.0f;
+}
+
+float AudioDSP::eqBandFrequency(size_t band) {
+    return band < EQ_BANDS ? EQ_FREQUENCIES[band] : 0.0f;
+}
+
+float AudioDSP::getCurrentGain() const {
+    return currentGain;
+}
+
+void AudioDSP::reset() {
+    for (auto& state : eqState) {
+        state.fill(0.0f);
+    }
+    currentGain = volumeGain * loudnessGain;
+    rampStep = 0.0f;
+    rampFramesRemaining = 0;
+}
+
+void AudioDSP::process(float* samples, size_t frames) {
+    if (samples == nullptr || frames == 0) return;
+    applyEq(samples, frames);
+    applyGain(samples, frames);
+}
+
+void AudioDSP::applyEq(float* samples, size_t frames) {
+    const size_t ch = static_cast<size_t>(channels);
+    for (size_t band = 0; band < EQ_BANDS; ++band) {
+        if (std::fabs(eqGainsDb[band]) < FLAT_EQ_DB) continue;
+        const BiquadCoefficients c = eqCoefficients[band];
+        auto& state = eqState[band];
+        // The recurrence is serial in time, so bands run one after another
+        for (size_t c0 = 0; c0 < ch; ++c0) {
+            float z1 = state[2 * c0];
+            float z2 = state[2 * c0 + 1];
+            float* p = samples + c0;
+            for (size_t f = 0; f < frames; ++f, p += ch) {
+                float x = *p;
+                float y = c.b0 * x + z1;
+                z1 = c.b1 * x - c.a1 * y + z2;
+                z2 = c.b2 * x - c.a2 * y;
+                *p = y;
+            }
+            // Silence tails would otherwise leave the state in slow denormals
+            state[2 * c0] = flushDenormal(z1);
+            state[2 * c0 + 1] = flushDenormal(z2);
+        }
+    }
+}
+
+void AudioDSP::applyGain(float* samples, size_t frames) {
+    const size_t ch = static_cast<size_t>(channels);
+    size_t rampFrames = std::min(frames, rampFramesRemaining);
+
+    if (rampFrames > 0) {
+        size_t count = rampFrames * ch;
+        size_t i = rampVector(samples, count, ch, currentGain, rampStep);
+        for (; i < count; ++i) {
+            samples[i] *= currentGain + rampStep * static_cast<float>(i / ch);
+        }
+        rampFramesRemaining -= rampFrames;
+        currentGain = rampFramesRemaining == 0
+            ? volumeGain * loudnessGain
+            : currentGain + rampStep * static_cast<float>(rampFrames);
+    }
+
+    if (currentGain == 1.0f) return;
+
+    size_t i = rampFrames * ch;
+    const size_t count = frames * ch;
+    const float gain = currentGain;
+#ifdef AUDIO_DSP_SSE
+    const __m128 g = _mm_set1_ps(gain);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(samples + i, _mm_mul_ps(_mm_loadu_ps(samples + i), g));
+    }
+#endif
+    for (; i < count; ++i) {
+        samples[i] *= gain;
+    }
+}
+
+void AudioDSP::crossfade(const float* outgoing, const float* incoming, float* out,
+                         size_t frames, int channelCount, float startMix, float endMix) {
+    if (frames == 0) return;
+    const size_t ch = static_cast<size_t>(std::clamp(channelCount, 1, AUDIO_CHANNELS));
+    const size_t count = frames * ch;
+    const float step = (endMix - startMix) / static_cast<float>(frames);
+    size_t i = 0;
+#ifdef AUDIO_DSP_SSE
+    __m128 mix = ch == 1
+        ? _mm_setr_ps(startMix, startMix + step, startMix + 2.0f * step, startMix + 3.0f * step)
+        : _mm_setr_ps(startMix, startMix, startMix + step, startMix + step);
+    const __m128 increment = _mm_set1_ps(step * static_cast<float>(4 / ch));
+    for (; i + 4 <= count; i += 4) {
+        __m128 a = _mm_loadu_ps(outgoing + i);
+        __m128 b = _mm_loadu_ps(incoming + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), mix)));
+        mix = _mm_add_ps(mix, increment);
+    }
+#endif
+    for (; i < count; ++i) {
+        float m = startMix + step * static_cast<float>(i / ch);
+        out[i] = outgoing[i] + (incoming[i] - outgoing[i]) * m;
+    }
+}
+
+float AudioDSP::dbToGain(float db) {
+    return std::pow(10.0f, db / 20.0f);
+}
@@ -0,0 +1,29 @@
+/**
+ * @file AudioDecoder.cpp
+ * @brief Decoder selection by file signature
+ */
+
+#include "AudioDecoder.h"
+#include "WavDecoder.h"
+#include "FlacDecoder.h"
+#include <cstring>
+#include <fstream>
+
+std::unique_ptr<AudioDecoder> AudioDecoder::create(const std::string& path) {
+    char magic[4] = {};
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.read(magic, sizeof(magic))) return nullptr;
+    }
+
+    std::unique_ptr<AudioDecoder> decoder;
+    if (std::memcmp(magic, "RIFF", 4) == 0) {
+        decoder = std::make_unique<WavDecoder>();
+    } else if (std::memcmp(magic, "fLaC", 4) == 0) {
+        decoder = std::make_unique<FlacDecoder>();
+    }
+    if (decoder && !decoder->open(path)) {
+        decoder.reset();
+    }
+    return decoder;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file AudioFocusManager.cpp
+ * @brief Implementation of the AudioFocusManager class
+ */
+
+#include "AudioFocusManager.h"
+#include "AudioDSP.h"
+#include <algorithm>
+
+namespace {
+constexpr float ATTACK_STEP = (1.0f - AudioFocusManager::DUCK_GAIN) / AudioFocusManager::ATTACK_FRAMES;
+constexpr float RELEASE_STEP = (1.0f - AudioFocusManager::DUCK_GAIN) / AudioFocusManager::RELEASE_FRAMES;
+} // namespace
+
+AudioFocusManager::AudioFocusManager(std::shared_ptr<MediaPlayer> player,
+                                     std::shared_ptr<const PromptClipCache> cache)
+    : mediaPlayer(player), clipCache(cache), pendingHead(0), pendingTail(0),
+      activeClip{nullptr, 0}, activePosition(0), duckGain(1.0f), promptGain(1.0f),
+      clipActive(false) {
+    pendingPrompts.fill(VoicePrompt::NAVIGATION_STARTED);
+}
+
+bool AudioFocusManager::requestPrompt(VoicePrompt prompt) {
+    size_t tail = pendingTail.load(std::memory_order_relaxed);
+    size_t head = pendingHead.load(std::memory_order_acquire);
+    if (tail - head >= PROMPT_QUEUE_SIZE) {
+        return false;
+    }
+    pendingPrompts[tail % PROMPT_QUEUE_SIZE] = prompt;
+    pendingTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+void AudioFocusManager::setPromptVolume(int percent) {
+    promptGain.store(static_cast<float>(std::clamp(percent, 0, 100)) / 100.0f, std::memory_order_relaxed);
+}
+
+void AudioFocusManager::mix(float* out, size_t frames) {
+    if (out == nullptr || frames == 0) return;
+
+    if (mediaPlayer) {
+        mediaPlayer->renderAudio(out, frames);
+    } else {
+        std::fill(out, out + frames * AUDIO_CHANNELS, 0.0f);
+    }
+
+    size_t head = pendingHead.load(std::memory_order_relaxed);
+    bool pending = head != pendingTail.load(std::memory_order_acquire);
+    float gain = duckGain.load(std::memory_order_relaxed);
+    if (activeClip.samples == nullptr && !pending && gain >= 1.0f) {
+        return;     // nothing to duck or mix: media passes through untouched
+    }
+
+    const float promptLevel = promptGain.load(std::memory_order_relaxed);
+    for (size_t f = 0; f < frames; ++f) {
+        if (activeClip.samples == nullptr && pending) {
+            activeClip = clipCache ? clipCache->get(pendingPrompts[head % PROMPT_QUEUE_SIZE]) : PromptClip{nullptr, 0};
+            activePosition = 0;
+            // Published before the pop so isPromptActive() sees the clip once the queue looks empty
+            clipActive.store(activeClip.samples != nullptr, std::memory_order_release);
+            pendingHead.store(++head, std::memory_order_release);
+            pending = head != pendingTail.load(std::memory_order_acquire);
+        }
+
+        float promptSample = 0.0f;
+        if (activeClip.samples != nullptr) {
+            // Snap within half a step so float drift cannot add or drop a frame
+            gain -= ATTACK_STEP;
+            if (gain < DUCK_GAIN + 0.5f * ATTACK_STEP) gain = DUCK_GAIN;
+            // Speech starts on the first frame at full duck depth
+            if (gain <= DUCK_GAIN) {
+                promptSample = activeClip.samples[activePosition] * promptLevel;
+                if (++activePosition >= activeClip.frames) {
+                    activeClip = PromptClip{nullptr, 0};
+                }
+            }
+        } else {
+            gain += RELEASE_STEP;
+            if (gain > 1.0f - 0.5f * RELEASE_STEP) gain = 1.0f;
+        }
+
+        float* frame = out + f * AUDIO_CHANNELS;
+        for (int c = 0; c < AUDIO_CHANNELS; ++c) {
+            frame[c] = frame[c] * gain + promptSample;
+        }
+    }
+    // The gain goes first so a reader that sees the clip end also sees the release under way
+    duckGain.store(gain, std::memory_order_relaxed);
+    clipActive.store(activeClip.samples != nullptr, std::memory_order_release);
+}
+
+bool AudioFocusManager::isPromptActive() const {
+    // Read in the reverse order mix() publishes them, so a prompt moving from
+    // the queue to playback to the release is never missed in between
+    if (pendingHead.load(std::memory_order_acquire) != pendingTail.load(std::memory_order_acquire)) {
+        return true;
+    }
+    if (clipActive.load(std::memory_order_acquire)) {
+        return true;
+    }
+    return duckGain.load(std::memory_order_relaxed) < 1.0f;
+}
+
+float AudioFocusManager::getDuckGain() const {
+    return duckGain.load(std::memory_order_relaxed);
+}
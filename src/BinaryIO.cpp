@@ -0,0 +1,226 @@
+/**
+ * @file BinaryIO.cpp
+ * @brief Implementation of the binary encoding helpers
+ */
+
+#include "BinaryIO.h"
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#define BINARY_IO_POSIX 1
+#endif
+
+void BinaryWriter::reserve(size_t bytes) {
+    buffer.reserve(bytes);
+}
+
+void BinaryWriter::u8(uint8_t value) {
+    buffer.push_back(static_cast<char>(value));
+}
+
+void BinaryWriter::u16(uint16_t value) {
+    u8(static_cast<uint8_t>(value));
+    u8(static_cast<uint8_t>(value >> 8));
+}
+
+void BinaryWriter::u32(uint32_t value) {
+    u16(static_cast<uint16_t>(value));
+    u16(static_cast<uint16_t>(value >> 16));
+}
+
+void BinaryWriter::u64(uint64_t value) {
+    u32(static_cast<uint32_t>(value));
+    u32(static_cast<uint32_t>(value >> 32));
+}
+
+void BinaryWriter::i32(int32_t value) {
+    u32(static_cast<uint32_t>(value));
+}
+
+void BinaryWriter::f32(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    u32(bits);
+}
+
+void BinaryWriter::str(const std::string& value) {
+    u32(static_cast<uint32_t>(value.size()));
+    buffer.append(value);
+}
+
+void BinaryWriter::bytes(const void* data, size_t size) {
+    buffer.append(static_cast<const char*>(data), size);
+}
+
+const std::string& BinaryWriter::data() const {
+    return buffer;
+}
+
+BinaryReader::BinaryReader(const void* bytes, size_t length)
+    : data(static_cast<const unsigned char*>(bytes)), size(length), pos(0), ok(true) {}
+
+const unsigned char* BinaryReader::take(size_t count) {
+    if (!ok || count > size - pos) {
+        ok = false;
+        return nullptr;
+    }
+    const unsigned char* p = data + pos;
+    pos += count;
+    return p;
+}
+
+uint8_t BinaryReader::u8() {
+    const unsigned char* p = take(1);
+    return p ? p[0] : 0;
+}
+
+uint16_t BinaryReader::u16() {
+    const unsigned char* p = take(2);
+    return p ? static_cast<uint16_t>(p[0] | (p[1] << 8)) : 0;
+}
+
+uint32_t BinaryReader::u32() {
+    const unsigned char* p = take(4);
+    if (!p) return 0;
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint64_t BinaryReader::u64() {
+    uint64_t low = u32();
+    uint64_t high = u32();
+    return low | (high << 32);
+}
+
+int32_t BinaryReader::i32() {
+    return static_cast<int32_t>(u32());
+}
+
+float BinaryReader::f32() {
+    uint32_t bits = u32();
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::string BinaryReader::str() {
+    uint32_t length = u32();
+    const unsigned char* p = take(length);
+    return p ? std::string(reinterpret_cast<const char*>(p), length) : std::string();
+}
+
+bool BinaryReader::bytes(void* out, size_t count) {
+    const unsigned char* p = take(count);
+    if (!p) return false;
+    std::memcpy(out, p, count);
+    return true;
+}
+
+bool BinaryReader::skip(size_t count) {
+    return take(count) != nullptr;
+}
+
+bool BinaryReader::good() const { return ok; }
+size_t BinaryReader::remaining() const { return size - pos; }
+size_t BinaryReader::position() const { return pos; }
+
+bool readFileContents(const std::string& path, std::string& contents) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    std::streamoff length = file.tellg();
+    if (length < 0) return false;
+    contents.resize(static_cast<size_t>(length));
+    file.seekg(0);
+    return static_cast<bool>(file.read(&contents[0], length));
+}
+
+namespace {
+#if defined(BINARY_IO_POSIX)
+bool writeAndSync(const std::string& path, const std::string& contents) {
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    size_t written = 0;
+    while (written < contents.size()) {
+        ssize_t n = ::write(fd, contents.data() + written, contents.size() - written);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        written += static_cast<size_t>(n);
+    }
+    bool ok = written == contents.size() && ::fsync(fd) == 0;
+    return ::close(fd) == 0 && ok;
+}
+
+void syncDirectoryOf(const std::string& path) {
+    std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    int fd = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+}
+#endif
+} // namespace
+
+bool writeFileContents(const std::string& path, const std::string& contents, bool durable) {
+    // Write beside the target and rename over it, so readers (and mappings)
+    // of the old file never see a half-written one
+    const std::string tempPath = path + ".tmp";
+    bool written = false;
+#if defined(BINARY_IO_POSIX)
+    if (durable) {
+        written = writeAndSync(tempPath, contents);
+    } else
+#endif
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        written = static_cast<bool>(file.flush());
+    }
+    if (!written) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+#if defined(BINARY_IO_POSIX)
+    // The rename itself is only durable once the directory entry is
+    if (durable) syncDirectoryOf(path);
+#endif
+    return true;
+}
+
+uint32_t crc32(const void* data, size_t size) {
+    static const auto table = [] {
+        std::array<uint32_t, 256> entries{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0);
+            entries[i] = crc;
+        }
+        return entries;
+    }();
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+bool isLittleEndianHost() {
+    const uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
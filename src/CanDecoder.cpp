@@ -0,0 +1,115 @@
+/**
+ * @file CanDecoder.cpp
+ * @brief Implementation of the CanDecoder class
+ */
+
+#include "CanDecoder.h"
+
+namespace {
+// OBD-II service 01 response: [length] 0x41 [PID] [A] [B]...
+constexpr uint8_t SHOW_CURRENT_DATA_RESPONSE = 0x41;
+constexpr uint8_t PID_COOLANT_TEMP = 0x05;
+constexpr uint8_t PID_VEHICLE_SPEED = 0x0D;
+constexpr uint8_t PID_FUEL_LEVEL = 0x2F;
+constexpr uint8_t PID_FUEL_RATE = 0x5E;
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+// Next blank-separated token, advancing text past it
+std::string_view nextToken(std::string_view& text) {
+    size_t start = 0;
+    while (start < text.size() && isBlank(text[start])) ++start;
+    size_t end = start;
+    while (end < text.size() && !isBlank(text[end])) ++end;
+    const std::string_view token = text.substr(start, end - start);
+    text.remove_prefix(end);
+    return token;
+}
+
+bool parseIdentifier(std::string_view text, uint32_t& id) {
+    // 3 digits for standard IDs, 8 for extended ones
+    if (text.empty() || text.size() > 8) return false;
+    id = 0;
+    for (char c : text) {
+        const int digit = hexValue(c);
+        if (digit < 0) return false;
+        id = id * 16 + static_cast<uint32_t>(digit);
+    }
+    return true;
+}
+
+bool parseByte(std::string_view text, uint8_t& byte) {
+    if (text.size() != 2) return false;
+    const int high = hexValue(text[0]);
+    const int low = hexValue(text[1]);
+    if (high < 0 || low < 0) return false;
+    byte = static_cast<uint8_t>(high * 16 + low);
+    return true;
+}
+
+// "ID#DDDDDD" with up to eight data bytes
+bool parseCompact(std::string_view token, CanFrame& frame) {
+    const size_t hash = token.find('#');
+    if (hash == std::string_view::npos || !parseIdentifier(token.substr(0, hash), frame.id)) return false;
+    const std::string_view payload = token.substr(hash + 1);
+    if (payload.size() % 2 != 0 || payload.size() > 16) return false;
+    frame.length = static_cast<uint8_t>(payload.size() / 2);
+    for (uint8_t i = 0; i < frame.length; ++i) {
+        if (!parseByte(payload.substr(i * 2u, 2), frame.data[i])) return false;
+    }
+    return true;
+}
+} // namespace
+
+bool CanDecoder::parseCandump(std::string_view line, CanFrame& frame) {
+    frame = CanFrame{};
+    std::string_view token = nextToken(line);
+    if (!token.empty() && token.front() == '(') token = nextToken(line);
+    if (token.find('#') != std::string_view::npos) return parseCompact(token, frame);
+
+    // token was the interface name
+    token = nextToken(line);
+    if (token.find('#') != std::string_view::npos) return parseCompact(token, frame);
+    if (!parseIdentifier(token, frame.id)) return false;
+    const std::string_view length = nextToken(line);
+    if (length.size() != 3 || length[0] != '[' || length[2] != ']' || length[1] < '0' || length[1] > '8') return false;
+    frame.length = static_cast<uint8_t>(length[1] - '0');
+    for (uint8_t i = 0; i < frame.length; ++i) {
+        if (!parseByte(nextToken(line), frame.data[i])) return false;
+    }
+    return true;
+}
+
+CanSignal CanDecoder::decode(const CanFrame& frame, double& value) {
+    if (frame.id < OBD_RESPONSE_FIRST || frame.id > OBD_RESPONSE_LAST || frame.length < 4) return CanSignal::NONE;
+    const uint8_t payload = frame.data[0];
+    if (payload < 3 || payload + 1 > frame.length || frame.data[1] != SHOW_CURRENT_DATA_RESPONSE) return CanSignal::NONE;
+    const uint8_t a = frame.data[3];
+
+    switch (frame.data[2]) {
+        case PID_COOLANT_TEMP:
+            value = a - 40.0;
+            return CanSignal::ENGINE_TEMP;
+        case PID_VEHICLE_SPEED:
+            value = a;
+            return CanSignal::SPEED;
+        case PID_FUEL_LEVEL:
+            value = a * 100.0 / 255.0;
+            return CanSignal::FUEL_LEVEL;
+        case PID_FUEL_RATE:
+            if (payload < 4) return CanSignal::NONE;
+            value = (a * 256.0 + frame.data[4]) / 20.0;
+            return CanSignal::FUEL_RATE;
+        default:
+            return CanSignal::NONE;
+    }
+}
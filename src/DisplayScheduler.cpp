@@ -0,0 +1,39 @@
+/**
+ * @file DisplayScheduler.cpp
+ * @brief Implementation of the DisplayScheduler class
+ */
+
+#include "DisplayScheduler.h"
+#include <cmath>
+
+DisplayScheduler::DisplayScheduler(std::shared_ptr<SystemSettings> systemSettings, std::shared_ptr<GPSNavigator> gps)
+    : settings(systemSettings), navigator(gps) {}
+
+bool DisplayScheduler::tick(int64_t now) {
+    if (!navigator->isGPSSignalAvailable()) return false;
+    const GPSCoordinate here = navigator->getCurrentLocation();
+    if (!here.isValid()) return false;
+
+    const double level = solar.daylightLevel(here.latitude, here.longitude, now);
+    const bool night = level < 0.5;
+    const int brightness = static_cast<int>(std::lround(NIGHT_BRIGHTNESS + (DAY_BRIGHTNESS - NIGHT_BRIGHTNESS) * level));
+    {
+        const SettingsView view = settings->getSnapshot();
+        if (view->theme != DisplayTheme::AUTO ||
+            (view->nightModeEnabled == night && view->displayBrightness == brightness)) {
+            return false;
+        }
+    }
+
+    // Not recorded: a day of ramp steps would otherwise bury the driver's own edits in the undo history
+    return settings->applyAutomatic([night, brightness](SettingsSnapshot& s) {
+        // The theme may have changed since the check above
+        if (s.theme != DisplayTheme::AUTO) return;
+        s.nightModeEnabled = night;
+        s.displayBrightness = brightness;
+    }) != 0;
+}
+
+const SolarSchedule& DisplayScheduler::getSolarSchedule() const {
+    return solar;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file EpochReclaimer.cpp
+ * @brief Implementation of the EpochReclaimer class
+ */
+
+#include "EpochReclaimer.h"
+#include <algorithm>
+
+/**
+ * @brief The calling thread's slot and pin nesting depth
+ */
+struct EpochThreadState {
+    int slot = -1;                  ///< Claimed slot, -1 if none
+    bool claimTried = false;        ///< A slot was looked for already
+    unsigned depth = 0;             ///< Nested Guards alive
+    uint64_t overflowEpoch = 0;     ///< Epoch pinned through the overflow path
+
+    ~EpochThreadState() {
+        if (slot >= 0) {
+            EpochReclaimer::instance().slots[static_cast<size_t>(slot)].owned.store(false, std::memory_order_release);
+        }
+    }
+};
+
+namespace {
+thread_local EpochThreadState threadState;
+} // namespace
+
+EpochReclaimer::Guard::Guard(EpochReclaimer* reclaimer) : owner(reclaimer) {}
+
+EpochReclaimer::Guard::Guard(Guard&& other) noexcept : owner(other.owner) {
+    other.owner = nullptr;
+}
+
+EpochReclaimer::Guard::~Guard() {
+    if (owner != nullptr) owner->leave();
+}
+
+EpochReclaimer& EpochReclaimer::instance() {
+    static EpochReclaimer reclaimer;
+    return reclaimer;
+}
+
+EpochReclaimer::EpochReclaimer() : epoch(1) {}
+
+EpochReclaimer::~EpochReclaimer() {
+    // No reader can outlive static destruction
+    for (const Retired& entry : retired) entry.destroy(entry.object);
+}
+
+EpochReclaimer::Guard EpochReclaimer::pin() {
+    enter();
+    return Guard(this);
+}
+
+void EpochReclaimer::enter() {
+    EpochThreadState& state = threadState;
+    if (state.depth++ > 0) return;
+
+    if (!state.claimTried) {
+        state.claimTried = true;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            bool expected = false;
+            if (slots[i].owned.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                state.slot = static_cast<int>(i);
+                break;
+            }
+        }
+    }
+
+    const uint64_t current = epoch.load(std::memory_order_relaxed);
+    if (state.slot >= 0) {
+        slots[static_cast<size_t>(state.slot)].pinned.store(current, std::memory_order_relaxed);
+    } else {
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        overflowPins.insert(current);
+        state.overflowEpoch = current;
+    }
+    // The pin must be visible before the reader loads any published pointer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void EpochReclaimer::leave() {
+    EpochThreadState& state = threadState;
+    if (--state.depth > 0) return;
+
+    if (state.slot >= 0) {
+        slots[static_cast<size_t>(state.slot)].pinned.store(IDLE, std::memory_order_release);
+    } else {
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        overflowPins.erase(overflowPins.find(state.overflowEpoch));
+    }
+}
+
+uint64_t EpochReclaimer::oldestPinned() const {
+    uint64_t oldest = IDLE;
+    for (const Slot& slot : slots) {
+        oldest = std::min(oldest, slot.pinned.load(std::memory_order_acquire));
+    }
+    std::lock_guard<std::mutex> lock(overflowMutex);
+    if (!overflowPins.empty()) oldest = std::min(oldest, *overflowPins.begin());
+    return oldest;
+}
+
+void EpochReclaimer::retire(void* object, void (*destroy)(void*)) {
+    std::lock_guard<std::mutex> lock(retireMutex);
+    // Readers that pin from now on can no longer reach the object
+    const uint64_t safeEpoch = epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+    retired.push_back(Retired{object, destroy, safeEpoch});
+    collectLocked();
+}
+
+void EpochReclaimer::reclaim() {
+    std::lock_guard<std::mutex> lock(retireMutex);
+    collectLocked();
+}
+
+void EpochReclaimer::collectLocked() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const uint64_t oldest = oldestPinned();
+    auto firstKept = std::partition(retired.begin(), retired.end(),
+                                    [oldest](const Retired& entry) { return entry.epoch <= oldest; });
+    for (auto it = retired.begin(); it != firstKept; ++it) it->destroy(it->object);
+    retired.erase(retired.begin(), firstKept);
+}
+
+size_t EpochReclaimer::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(retireMutex);
+    return retired.size();
+}
@@ -0,0 +1,294 @@
+/**
+ * @file EventLoop.cpp
+ * @brief Implementation of the EventLoop class
+ */
+
+#include "EventLoop.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#define EVENT_LOOP_EPOLL 1
+#endif
+
+namespace {
+// Wake-up events use a handle no source can have
+constexpr EventLoop::SourceId WAKE_ID = 0;
+constexpr int MAX_EVENTS = 16;
+constexpr size_t READ_CHUNK_BYTES = 64 * 1024;
+} // namespace
+
+EventLoop::EventLoop() : nextSourceId(1), alwaysReadyCount(0), epollFd(-1), wakeFd(-1), stopping(false) {
+#if defined(EVENT_LOOP_EPOLL)
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFd >= 0 && wakeFd >= 0) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = WAKE_ID;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+    }
+#endif
+}
+
+EventLoop::~EventLoop() {
+#if defined(EVENT_LOOP_EPOLL)
+    for (const auto& entry : sources) {
+        if (entry.second->ownsFd) ::close(entry.second->fd);
+    }
+    if (wakeFd >= 0) ::close(wakeFd);
+    if (epollFd >= 0) ::close(epollFd);
+#endif
+}
+
+EventLoop::SourceId EventLoop::addTimer(std::chrono::milliseconds interval, Callback callback) {
+    if (interval.count() < 1) interval = std::chrono::milliseconds(1);
+    auto source = std::make_shared<Source>(
+        Source{-1, false, true, false, interval, std::chrono::steady_clock::now() + interval, std::move(callback)});
+    const SourceId id = nextSourceId++;
+
+#if defined(EVENT_LOOP_EPOLL)
+    if (epollFd < 0) return 0;
+    const int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0) return 0;
+    itimerspec spec{};
+    spec.it_interval.tv_sec = static_cast<time_t>(interval.count() / 1000);
+    spec.it_interval.tv_nsec = static_cast<long>(interval.count() % 1000) * 1000000L;
+    spec.it_value = spec.it_interval;
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = id;
+    if (timerfd_settime(fd, 0, &spec, nullptr) != 0 || epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        ::close(fd);
+        return 0;
+    }
+    source->fd = fd;
+    source->ownsFd = true;
+#endif
+
+    sources.emplace(id, std::move(source));
+    return id;
+}
+
+EventLoop::SourceId EventLoop::addReader(int fd, Callback callback) {
+#if defined(EVENT_LOOP_EPOLL)
+    if (epollFd < 0 || fd < 0) return 0;
+    const SourceId id = nextSourceId++;
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = id;
+    bool alwaysReady = false;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        // epoll rejects regular files; they never block, so poll them every pass
+        if (errno != EPERM) return 0;
+        alwaysReady = true;
+        ++alwaysReadyCount;
+    }
+    sources.emplace(id, std::make_shared<Source>(Source{fd, false, false, alwaysReady, std::chrono::milliseconds(0),
+                                                        std::chrono::steady_clock::time_point(),
+                                                        std::move(callback)}));
+    return id;
+#else
+    (void)fd;
+    (void)callback;
+    return 0;
+#endif
+}
+
+EventLoop::SourceId EventLoop::addLineReader(int fd, LineCallback onLine, Callback onClosed) {
+#if defined(EVENT_LOOP_EPOLL)
+    // The handler needs its own handle to remove itself, so it is filled in
+    // after registration; no event can arrive before addReader returns
+    auto self = std::make_shared<SourceId>(0);
+    auto pending = std::make_shared<std::string>();
+    const SourceId id = addReader(fd, [this, fd, self, pending, onLine = std::move(onLine),
+                                       onClosed = std::move(onClosed)]() {
+        // One buffer per loop: handlers run one at a time
+        if (readBuffer.empty()) readBuffer.resize(READ_CHUNK_BYTES);
+        char* const buffer = readBuffer.data();
+        const ssize_t length = ::read(fd, buffer, readBuffer.size());
+        if (length < 0 && (errno == EAGAIN || errno == EINTR)) return;
+        if (length <= 0) {
+            removeSource(*self);
+            if (!pending->empty()) onLine(*pending);
+            pending->clear();
+            if (onClosed) onClosed();
+            return;
+        }
+
+        // Lines wholly inside the buffer are passed as views without copying;
+        // only a line split across reads is assembled in pending
+        const char* start = buffer;
+        const char* const end = buffer + length;
+        while (start < end) {
+            const char* newline = static_cast<const char*>(std::memchr(start, '\n', static_cast<size_t>(end - start)));
+            if (newline == nullptr) {
+                const size_t room = MAX_LINE_BYTES - std::min(pending->size(), MAX_LINE_BYTES);
+                pending->append(start, std::min(static_cast<size_t>(end - start), room));
+                break;
+            }
+            std::string_view line(start, std::min(static_cast<size_t>(newline - start), MAX_LINE_BYTES));
+            if (!pending->empty()) {
+                const size_t room = MAX_LINE_BYTES - std::min(pending->size(), MAX_LINE_BYTES);
+                pending->append(start, std::min(line.size(), room));
+                line = *pending;
+            }
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            onLine(line);
+            pending->clear();
+            start = newline + 1;
+        }
+    });
+    *self = id;
+    return id;
+#else
+    (void)fd;
+    (void)onLine;
+    (void)onClosed;
+    return 0;
+#endif
+}
+
+bool EventLoop::removeSource(SourceId id) {
+    auto it = sources.find(id);
+    if (it == sources.end()) return false;
+#if defined(EVENT_LOOP_EPOLL)
+    if (it->second->alwaysReady) {
+        --alwaysReadyCount;
+    } else {
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, it->second->fd, nullptr);
+    }
+    if (it->second->ownsFd) ::close(it->second->fd);
+#endif
+    sources.erase(it);
+    return true;
+}
+
+void EventLoop::post(Callback task) {
+    {
+        std::lock_guard<std::mutex> lock(taskMutex);
+        tasks.push_back(std::move(task));
+    }
+#if defined(EVENT_LOOP_EPOLL)
+    const uint64_t one = 1;
+    [[maybe_unused]] const ssize_t written = ::write(wakeFd, &one, sizeof(one));
+#else
+    taskSignal.notify_one();
+#endif
+}
+
+size_t EventLoop::runTasks() {
+    std::vector<Callback> ready;
+    {
+        std::lock_guard<std::mutex> lock(taskMutex);
+        ready.swap(tasks);
+    }
+    for (Callback& task : ready) task();
+    return ready.size();
+}
+
+bool EventLoop::dispatch(SourceId id) {
+    auto it = sources.find(id);
+    // Removed by an earlier handler of the same batch
+    if (it == sources.end()) return false;
+    // Holding a reference keeps the handler alive if it removes itself
+    const std::shared_ptr<Source> source = it->second;
+#if defined(EVENT_LOOP_EPOLL)
+    if (source->timer) {
+        uint64_t expirations = 0;
+        if (::read(source->fd, &expirations, sizeof(expirations)) != sizeof(expirations)) return false;
+    }
+#endif
+    source->callback();
+    return true;
+}
+
+size_t EventLoop::runOnce(std::chrono::milliseconds timeout) {
+    size_t handled = 0;
+
+#if defined(EVENT_LOOP_EPOLL)
+    epoll_event events[MAX_EVENTS];
+    int waitMs = timeout.count() < 0 ? -1 : static_cast<int>(timeout.count());
+    if (alwaysReadyCount > 0) waitMs = 0;
+    const int ready = epoll_wait(epollFd, events, MAX_EVENTS, waitMs);
+    if (ready < 0) return 0;
+    for (int i = 0; i < ready; ++i) {
+        const auto id = static_cast<SourceId>(events[i].data.u64);
+        if (id == WAKE_ID) {
+            uint64_t count = 0;
+            [[maybe_unused]] const ssize_t drained = ::read(wakeFd, &count, sizeof(count));
+            handled += runTasks();
+        } else if (dispatch(id)) {
+            ++handled;
+        }
+        if (stopping.load()) break;
+    }
+    if (alwaysReadyCount > 0 && !stopping.load()) {
+        std::vector<SourceId> files;
+        for (const auto& entry : sources) {
+            if (entry.second->alwaysReady) files.push_back(entry.first);
+        }
+        for (SourceId id : files) {
+            if (stopping.load()) break;
+            if (dispatch(id)) ++handled;
+        }
+    }
+#else
+    const auto now = std::chrono::steady_clock::now();
+    auto deadline = timeout.count() < 0 ? std::chrono::steady_clock::time_point::max() : now + timeout;
+    for (const auto& entry : sources) deadline = std::min(deadline, entry.second->due);
+    {
+        std::unique_lock<std::mutex> lock(taskMutex);
+        taskSignal.wait_until(lock, deadline, [this] { return !tasks.empty() || stopping.load(); });
+    }
+    handled += runTasks();
+
+    std::vector<SourceId> due;
+    const auto woke = std::chrono::steady_clock::now();
+    for (const auto& entry : sources) {
+        if (entry.second->due <= woke) due.push_back(entry.first);
+    }
+    for (SourceId id : due) {
+        if (stopping.load()) break;
+        auto it = sources.find(id);
+        if (it == sources.end()) continue;
+        Source& source = *it->second;
+        // Missed periods are skipped rather than replayed
+        while (source.due <= woke) source.due += source.interval;
+        if (dispatch(id)) ++handled;
+    }
+#endif
+    return handled;
+}
+
+void EventLoop::run() {
+    while (!stopping.load()) runOnce(std::chrono::milliseconds(-1));
+    stopping = false;
+}
+
+void EventLoop::stop() {
+    stopping = true;
+#if defined(EVENT_LOOP_EPOLL)
+    const uint64_t one = 1;
+    [[maybe_unused]] const ssize_t written = ::write(wakeFd, &one, sizeof(one));
+#else
+    {
+        // Taking the lock orders the flag with a waiter checking its predicate
+        std::lock_guard<std::mutex> lock(taskMutex);
+    }
+    taskSignal.notify_all();
+#endif
+}
+
+bool EventLoop::supportsDescriptors() {
+#if defined(EVENT_LOOP_EPOLL)
+    return true;
+#else
+    return false;
+#endif
+}
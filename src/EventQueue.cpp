@@ -0,0 +1,37 @@
+/**
+ * @file EventQueue.cpp
+ * @brief Implementation of the EventQueue class
+ */
+
+#include "EventQueue.h"
+
+void EventQueue::setWakeup(std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(mutex);
+    wakeup = std::move(callback);
+}
+
+void EventQueue::post(Task task) {
+    std::function<void()> notify;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(std::move(task));
+        if (pending.size() == 1) notify = wakeup;
+    }
+    if (notify) notify();
+}
+
+size_t EventQueue::drain() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running.swap(pending);
+    }
+    for (Task& task : running) task();
+    const size_t count = running.size();
+    running.clear();
+    return count;
+}
+
+size_t EventQueue::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pending.size();
+}
@@ -0,0 +1,124 @@
+/**
+ * @file FileWatcher.cpp
+ * @brief Implementation of the FileWatcher class
+ */
+
+#include "FileWatcher.h"
+#include <chrono>
+#include <filesystem>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#define FILE_WATCHER_INOTIFY 1
+#endif
+
+FileWatcher::FileWatcher() : running(false), notifyFd(-1), wakeFd{-1, -1} {}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+bool FileWatcher::start(const std::string& path, std::function<void()> callback) {
+    stop();
+
+    const std::filesystem::path file(path);
+    directory = file.has_parent_path() ? file.parent_path().string() : ".";
+    fileName = file.filename().string();
+    onChange = std::move(callback);
+    if (fileName.empty()) return false;
+
+#if defined(FILE_WATCHER_INOTIFY)
+    notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (notifyFd < 0) return false;
+    // Close-after-write covers in-place writers, moved-to covers rename
+    if (inotify_add_watch(notifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0 ||
+        pipe2(wakeFd, O_CLOEXEC) != 0) {
+        ::close(notifyFd);
+        notifyFd = -1;
+        return false;
+    }
+    running = true;
+    worker = std::thread(&FileWatcher::watchNotify, this);
+#else
+    running = true;
+    worker = std::thread(&FileWatcher::watchPolling, this);
+#endif
+    return true;
+}
+
+void FileWatcher::stop() {
+    if (!worker.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(stopMutex);
+        running = false;
+    }
+    stopSignal.notify_all();
+#if defined(FILE_WATCHER_INOTIFY)
+    // Should the write fail, the thread still stops at its next poll timeout
+    const char wake = 0;
+    [[maybe_unused]] const ssize_t written = ::write(wakeFd[1], &wake, 1);
+#endif
+    worker.join();
+
+#if defined(FILE_WATCHER_INOTIFY)
+    ::close(notifyFd);
+    ::close(wakeFd[0]);
+    ::close(wakeFd[1]);
+    notifyFd = -1;
+    wakeFd[0] = wakeFd[1] = -1;
+#endif
+}
+
+bool FileWatcher::isWatching() const {
+    return running.load();
+}
+
+void FileWatcher::watchNotify() {
+#if defined(FILE_WATCHER_INOTIFY)
+    alignas(inotify_event) char buffer[4096];
+    while (running.load()) {
+        pollfd fds[2] = {{notifyFd, POLLIN, 0}, {wakeFd[0], POLLIN, 0}};
+        const int ready = poll(fds, 2, POLL_INTERVAL_MS);
+        if (ready < 0 && errno != EINTR) break;
+        if (ready <= 0 || !(fds[0].revents & POLLIN)) continue;
+
+        // Drain every queued event so a burst of writes triggers one callback
+        bool changed = false;
+        ssize_t length;
+        while ((length = ::read(notifyFd, buffer, sizeof(buffer))) > 0) {
+            for (char* p = buffer; p < buffer + length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(p);
+                if (event->len > 0 && fileName == event->name) changed = true;
+                p += sizeof(inotify_event) + event->len;
+            }
+        }
+        if (changed && running.load()) onChange();
+    }
+#endif
+}
+
+void FileWatcher::watchPolling() {
+    const std::filesystem::path file = std::filesystem::path(directory) / fileName;
+    std::error_code ec;
+    auto lastWrite = std::filesystem::last_write_time(file, ec);
+    bool existed = !ec;
+
+    std::unique_lock<std::mutex> lock(stopMutex);
+    while (running.load()) {
+        stopSignal.wait_for(lock, std::chrono::milliseconds(POLL_INTERVAL_MS));
+        if (!running.load()) break;
+        const auto writeTime = std::filesystem::last_write_time(file, ec);
+        const bool exists = !ec;
+        if (exists && (!existed || writeTime != lastWrite)) {
+            lastWrite = writeTime;
+            lock.unlock();
+            onChange();
+            lock.lock();
+        }
+        existed = exists;
+    }
+}
@@ -0,0 +1,607 @@
+/**
+ * @file FlacDecoder.cpp
+ * @brief Implementation of the FlacDecoder class
+ */
+
+#include "FlacDecoder.h"
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+namespace {
+const uint8_t BLOCK_STREAMINFO = 0;
+const uint8_t BLOCK_SEEKTABLE = 3;
+const size_t MIN_FRAME_BYTES = 6;
+const size_t READ_CHUNK_BYTES = 64 * 1024;
+// A seek decodes at most this fraction of a second before reaching its target
+const uint32_t SEEK_POINTS_PER_SECOND = 10;
+// Playback indexes at most this much of a track (or of one of unknown length) without buildSeekIndex()
+const uint64_t MAX_RESERVED_SECONDS = 3600;
+
+const std::array<uint8_t, 256>& crc8Table() {
+    static const std::array<uint8_t, 256> table = [] {
+        std::array<uint8_t, 256> t{};
+        for (int i = 0; i < 256; ++i) {
+            uint8_t crc = static_cast<uint8_t>(i);
+            for (int bit = 0; bit < 8; ++bit) crc = static_cast<uint8_t>((crc << 1) ^ ((crc & 0x80) ? 0x07 : 0));
+            t[i] = crc;
+        }
+        return t;
+    }();
+    return table;
+}
+
+const std::array<uint16_t, 256>& crc16Table() {
+    static const std::array<uint16_t, 256> table = [] {
+        std::array<uint16_t, 256> t{};
+        for (int i = 0; i < 256; ++i) {
+            uint16_t crc = static_cast<uint16_t>(i << 8);
+            for (int bit = 0; bit < 8; ++bit) crc = static_cast<uint16_t>((crc << 1) ^ ((crc & 0x8000) ? 0x8005 : 0));
+            t[i] = crc;
+        }
+        return t;
+    }();
+    return table;
+}
+
+uint8_t crc8(const uint8_t* data, size_t size) {
+    const auto& table = crc8Table();
+    uint8_t crc = 0;
+    for (size_t i = 0; i < size; ++i) crc = table[crc ^ data[i]];
+    return crc;
+}
+
+uint16_t crc16(const uint8_t* data, size_t size) {
+    const auto& table = crc16Table();
+    uint16_t crc = 0;
+    for (size_t i = 0; i < size; ++i) crc = static_cast<uint16_t>((crc << 8) ^ table[(crc >> 8) ^ data[i]]);
+    return crc;
+}
+
+// Worst case is a verbatim frame; STREAMINFO usually gives a tighter bound
+size_t maxFrameBytes(const FlacStreamInfo& info) {
+    return info.maxFrameSize > 0
+        ? info.maxFrameSize
+        : static_cast<size_t>(info.maxBlockSize) * info.channels * (info.bitsPerSample + 1) / 8 + 64;
+}
+
+/**
+ * MSB-first bit reader over a byte range with a 64-bit cache. Reading past
+ * the end returns zeros and sets 'overrun'; callers check it once per frame.
+ */
+class BitReader {
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t bytePos;
+    uint64_t cache;
+    int cached;
+
+    void refill() {
+        while (cached <= 56 && bytePos < size) {
+            cache |= static_cast<uint64_t>(data[bytePos++]) << (56 - cached);
+            cached += 8;
+        }
+    }
+
+public:
+    bool overrun;
+
+    BitReader(const uint8_t* bytes, size_t length)
+        : data(bytes), size(length), bytePos(0), cache(0), cached(0), overrun(false) {}
+
+    uint32_t read(int bits) {
+        if (bits == 0) return 0;
+        if (cached < bits) {
+            refill();
+            if (cached < bits) {
+                overrun = true;
+                cached = 0;
+                cache = 0;
+                return 0;
+            }
+        }
+        uint32_t value = static_cast<uint32_t>(cache >> (64 - bits));
+        cache <<= bits;
+        cached -= bits;
+        return value;
+    }
+
+    int32_t readSigned(int bits) {
+        if (bits == 0) return 0;
+        uint32_t value = read(bits);
+        return static_cast<int32_t>(value << (32 - bits)) >> (32 - bits);
+    }
+
+    uint32_t readUnary() {
+        uint32_t zeros = 0;
+        while (true) {
+            if (cached == 0) {
+                refill();
+                if (cached == 0) {
+                    overrun = true;
+                    return 0;
+                }
+            }
+            if (cache == 0) {
+                zeros += static_cast<uint32_t>(cached);
+                cached = 0;
+                continue;
+            }
+            int leading = __builtin_clzll(cache);
+            if (leading >= cached) {
+                zeros += static_cast<uint32_t>(cached);
+                cache = 0;
+                cached = 0;
+                continue;
+            }
+            zeros += static_cast<uint32_t>(leading);
+            cache <<= leading + 1;
+            cached -= leading + 1;
+            return zeros;
+        }
+    }
+
+    void alignToByte() {
+        int drop = cached % 8;
+        cache <<= drop;
+        cached -= drop;
+    }
+
+    size_t bytePosition() const {
+        return bytePos - static_cast<size_t>(cached / 8);
+    }
+};
+
+bool readUtf8Number(BitReader& in, uint64_t& value) {
+    uint32_t first = in.read(8);
+    if ((first & 0x80) == 0) {
+        value = first;
+        return true;
+    }
+    int extra = 0;
+    if ((first & 0xE0) == 0xC0) { extra = 1; value = first & 0x1F; }
+    else if ((first & 0xF0) == 0xE0) { extra = 2; value = first & 0x0F; }
+    else if ((first & 0xF8) == 0xF0) { extra = 3; value = first & 0x07; }
+    else if ((first & 0xFC) == 0xF8) { extra = 4; value = first & 0x03; }
+    else if ((first & 0xFE) == 0xFC) { extra = 5; value = first & 0x01; }
+    else if (first == 0xFE) { extra = 6; value = 0; }
+    else return false;
+    for (int i = 0; i < extra; ++i) {
+        uint32_t next = in.read(8);
+        if ((next & 0xC0) != 0x80) return false;
+        value = (value << 6) | (next & 0x3F);
+    }
+    return true;
+}
+
+bool decodeResidual(BitReader& in, uint32_t blockSize, uint32_t order, int32_t* residual) {
+    const uint32_t method = in.read(2);
+    if (method > 1) return false;
+    const int paramBits = method == 0 ? 4 : 5;
+    const uint32_t escape = method == 0 ? 15 : 31;
+    const uint32_t partitionOrder = in.read(4);
+    const uint32_t partitions = 1u << partitionOrder;
+    if ((blockSize >> partitionOrder) < order || (blockSize & (partitions - 1)) != 0) return false;
+
+    uint32_t sample = 0;
+    for (uint32_t p = 0; p < partitions; ++p) {
+        uint32_t count = (blockSize >> partitionOrder) - (p == 0 ? order : 0);
+        uint32_t param = in.read(paramBits);
+        if (param == escape) {
+            int bits = static_cast<int>(in.read(5));
+            for (uint32_t i = 0; i < count; ++i) residual[sample++] = in.readSigned(bits);
+            continue;
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t folded = (in.readUnary() << param) | in.read(static_cast<int>(param));
+            residual[sample++] = static_cast<int32_t>(folded >> 1) ^ -static_cast<int32_t>(folded & 1);
+        }
+        if (in.overrun) return false;
+    }
+    return true;
+}
+
+bool decodeSubframe(BitReader& in, uint32_t blockSize, int bps, int32_t* out) {
+    if (in.read(1) != 0) return false;
+    const uint32_t type = in.read(6);
+    int wasted = 0;
+    if (in.read(1)) {
+        wasted = static_cast<int>(in.readUnary()) + 1;
+        if (wasted >= bps) return false;
+        bps -= wasted;
+    }
+
+    if (type == 0) {
+        std::fill(out, out + blockSize, in.readSigned(bps));
+    } else if (type == 1) {
+        for (uint32_t i = 0; i < blockSize; ++i) out[i] = in.readSigned(bps);
+    } else if (type >= 8 && type <= 12) {
+        const uint32_t order = type - 8;
+        if (order > blockSize) return false;
+        for (uint32_t i = 0; i < order; ++i) out[i] = in.readSigned(bps);
+        if (!decodeResidual(in, blockSize, order, out + order)) return false;
+        // Residuals were written in place; rebuild samples front to back
+        switch (order) {
+            case 1: for (uint32_t i = 1; i < blockSize; ++i) out[i] += out[i - 1]; break;
+            case 2: for (uint32_t i = 2; i < blockSize; ++i) out[i] += 2 * out[i - 1] - out[i - 2]; break;
+            case 3: for (uint32_t i = 3; i < blockSize; ++i) out[i] += 3 * out[i - 1] - 3 * out[i - 2] + out[i - 3]; break;
+            case 4: for (uint32_t i = 4; i < blockSize; ++i) out[i] += 4 * out[i - 1] - 6 * out[i - 2] + 4 * out[i - 3] - out[i - 4]; break;
+            default: break;
+        }
+    } else if (type >= 32) {
+        const uint32_t order = type - 31;
+        if (order > blockSize) return false;
+        for (uint32_t i = 0; i < order; ++i) out[i] = in.readSigned(bps);
+        const int precision = static_cast<int>(in.read(4)) + 1;
+        if (precision == 16) return false;
+        const int shift = in.readSigned(5);
+        if (shift < 0) return false;
+        int32_t coefficients[32];
+        for (uint32_t i = 0; i < order; ++i) coefficients[i] = in.readSigned(precision);
+        if (!decodeResidual(in, blockSize, order, out + order)) return false;
+        for (uint32_t i = order; i < blockSize; ++i) {
+            int64_t prediction = 0;
+            for (uint32_t j = 0; j < order; ++j) {
+                prediction += static_cast<int64_t>(coefficients[j]) * out[i - 1 - j];
+            }
+            out[i] += static_cast<int32_t>(prediction >> shift);
+        }
+    } else {
+        return false;
+    }
+
+    if (wasted > 0) {
+        for (uint32_t i = 0; i < blockSize; ++i) out[i] = static_cast<int32_t>(static_cast<uint32_t>(out[i]) << wasted);
+    }
+    return !in.overrun;
+}
+} // namespace
+
+FlacDecoder::FlacDecoder()
+    : audioOffset(0), fileSize(0), inputPos(0), inputEnd(0), inputOffset(0), frameCursor(0), position(0),
+      sampleScale(1.0f) {}
+
+bool FlacDecoder::open(const std::string& path) {
+    file.close();
+    file.clear();
+    info = FlacStreamInfo();
+    seekIndex.clear();
+    frame = FlacFrame();
+    frameCursor = 0;
+    position = 0;
+    filePath = path;
+
+    file.open(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(0);
+
+    char magic[4];
+    if (!file.read(magic, 4) || std::memcmp(magic, "fLaC", 4) != 0) return false;
+
+    bool haveStreamInfo = false;
+    bool last = false;
+    std::vector<SeekPoint> tablePoints;
+    while (!last) {
+        uint8_t header[4];
+        if (!file.read(reinterpret_cast<char*>(header), 4)) return false;
+        last = (header[0] & 0x80) != 0;
+        const uint8_t type = header[0] & 0x7F;
+        const uint32_t length = (static_cast<uint32_t>(header[1]) << 16) | (header[2] << 8) | header[3];
+
+        if (type == BLOCK_STREAMINFO || type == BLOCK_SEEKTABLE) {
+            std::vector<uint8_t> block(length);
+            if (!file.read(reinterpret_cast<char*>(block.data()), length)) return false;
+            if (type == BLOCK_STREAMINFO && length >= 34) {
+                BitReader in(block.data(), block.size());
+                info.minBlockSize = in.read(16);
+                info.maxBlockSize = in.read(16);
+                in.read(24);                                  // min frame size
+                info.maxFrameSize = in.read(24);
+                info.sampleRate = in.read(20);
+                info.channels = static_cast<uint16_t>(in.read(3) + 1);
+                info.bitsPerSample = static_cast<uint16_t>(in.read(5) + 1);
+                info.totalSamples = (static_cast<uint64_t>(in.read(4)) << 32) | in.read(32);
+                haveStreamInfo = true;
+            } else if (type == BLOCK_SEEKTABLE) {
+                for (size_t i = 0; i + 18 <= block.size(); i += 18) {
+                    uint64_t sample = 0, offset = 0;
+                    for (int b = 0; b < 8; ++b) {
+                        sample = (sample << 8) | block[i + b];
+                        offset = (offset << 8) | block[i + 8 + b];
+                    }
+                    if (sample != UINT64_MAX) tablePoints.push_back(SeekPoint{sample, offset});
+                }
+            }
+        } else {
+            file.seekg(length, std::ios::cur);
+        }
+    }
+
+    // 32-bit streams would need 33-bit side channels; nothing in a car library uses them
+    if (!haveStreamInfo || info.sampleRate == 0 || info.bitsPerSample < 4 || info.bitsPerSample > 24 ||
+        info.maxBlockSize < 16) {
+        return false;
+    }
+    audioOffset = static_cast<uint64_t>(file.tellg());
+    sampleScale = 1.0f / static_cast<float>(1u << (info.bitsPerSample - 1));
+
+    // Everything playback touches is allocated here, never in read() or seek()
+    const size_t blockSamples = static_cast<size_t>(info.maxBlockSize) * info.channels;
+    frame.samples.reserve(blockSamples);
+    frame.planar.reserve(blockSamples);
+    input.assign(maxFrameBytes(info) + READ_CHUNK_BYTES, 0);
+    seekIndex = SeekIndex(std::max<uint32_t>(1, info.sampleRate / SEEK_POINTS_PER_SECOND));
+    const uint64_t seconds = info.totalSamples > 0
+        ? std::min(info.totalSamples / info.sampleRate + 1, MAX_RESERVED_SECONDS)
+        : MAX_RESERVED_SECONDS;
+    seekIndex.reserve(static_cast<size_t>(seconds * SEEK_POINTS_PER_SECOND) + 2);
+    seekIndex.add(0, audioOffset);
+    for (const auto& point : tablePoints) {
+        seekIndex.add(point.frame, audioOffset + point.byteOffset);
+    }
+    restartAt(audioOffset);
+    return true;
+}
+
+void FlacDecoder::restartAt(uint64_t offset) {
+    inputPos = 0;
+    inputEnd = 0;
+    inputOffset = offset;
+    file.clear();
+    file.seekg(static_cast<std::streamoff>(offset));
+}
+
+bool FlacDecoder::fill(size_t bytes) {
+    if (inputEnd - inputPos >= bytes) return true;
+    if (inputPos > 0) {
+        std::memmove(input.data(), input.data() + inputPos, inputEnd - inputPos);
+        inputEnd -= inputPos;
+        inputOffset += inputPos;
+        inputPos = 0;
+    }
+    file.read(reinterpret_cast<char*>(input.data() + inputEnd), static_cast<std::streamsize>(input.size() - inputEnd));
+    inputEnd += static_cast<size_t>(file.gcount());
+    return inputEnd >= bytes;
+}
+
+bool FlacDecoder::decodeNextFrame() {
+    const size_t worstCase = maxFrameBytes(info);
+
+    while (true) {
+        fill(worstCase);
+        if (inputEnd - inputPos < MIN_FRAME_BYTES) return false;
+
+        const uint64_t frameOffset = inputOffset + inputPos;
+        size_t used = decodeFrame(input.data() + inputPos, inputEnd - inputPos, info, frame);
+        if (used > 0) {
+            inputPos += used;
+            frameCursor = 0;
+            // Past the room open() reserved, points are left to buildSeekIndex() rather than allocated here
+            if (seekIndex.size() < seekIndex.capacity()) seekIndex.add(frame.firstSample, frameOffset);
+            return true;
+        }
+        // Corrupt or truncated frame: resynchronize on the next sync code
+        ++inputPos;
+        while (inputPos + 1 < inputEnd &&
+               !(input[inputPos] == 0xFF && (input[inputPos + 1] & 0xFE) == 0xF8)) {
+            ++inputPos;
+        }
+    }
+}
+
+size_t FlacDecoder::read(float* out, size_t frames) {
+    const uint16_t channels = info.channels;
+    size_t done = 0;
+    while (done < frames) {
+        if (frameCursor >= frame.blockSize) {
+            if (!decodeNextFrame()) break;
+            // A block that started before the current position (after resync)
+            if (frame.firstSample + frame.blockSize <= position) {
+                frameCursor = frame.blockSize;
+                continue;
+            }
+            if (frame.firstSample < position) frameCursor = static_cast<size_t>(position - frame.firstSample);
+        }
+        const size_t n = std::min(frames - done, static_cast<size_t>(frame.blockSize) - frameCursor);
+        const int32_t* src = frame.samples.data() + frameCursor * channels;
+        float* dst = out + done * channels;
+        for (size_t i = 0; i < n * channels; ++i) {
+            dst[i] = static_cast<float>(src[i]) * sampleScale;
+        }
+        frameCursor += n;
+        done += n;
+        position += n;
+    }
+    return done;
+}
+
+bool FlacDecoder::seek(uint64_t target) {
+    if (!file.is_open()) return false;
+    if (info.totalSamples > 0) target = std::min(target, info.totalSamples);
+
+    // Still inside the buffered frame: no I/O at all
+    if (target >= frame.firstSample && target < frame.firstSample + frame.blockSize) {
+        frameCursor = static_cast<size_t>(target - frame.firstSample);
+        position = target;
+        return true;
+    }
+
+    const SeekPoint* point = seekIndex.find(target);
+    restartAt(point != nullptr ? point->byteOffset : audioOffset);
+    // Reset in place so the buffers reserved by open() are kept
+    frame.firstSample = 0;
+    frame.blockSize = 0;
+    frameCursor = 0;
+    while (decodeNextFrame()) {
+        if (frame.firstSample + frame.blockSize > target) {
+            frameCursor = static_cast<size_t>(target - std::min(target, frame.firstSample));
+            position = target;
+            return true;
+        }
+    }
+    position = target;
+    return true;
+}
+
+uint64_t FlacDecoder::tell() const { return position; }
+uint64_t FlacDecoder::getTotalFrames() const { return info.totalSamples; }
+uint32_t FlacDecoder::getSampleRate() const { return info.sampleRate; }
+uint16_t FlacDecoder::getChannels() const { return info.channels; }
+const FlacStreamInfo& FlacDecoder::getStreamInfo() const { return info; }
+size_t FlacDecoder::getSeekPointCount() const { return seekIndex.size(); }
+
+size_t FlacDecoder::decodeFrame(const uint8_t* data, size_t size, const FlacStreamInfo& info, FlacFrame& out) {
+    static const uint32_t SAMPLE_RATES[12] = {0, 88200, 176400, 192000, 8000, 16000, 22050, 24000,
+                                              32000, 44100, 48000, 96000};
+    static const int SAMPLE_SIZES[8] = {0, 8, 12, 0, 16, 20, 24, 32};
+    if (size < MIN_FRAME_BYTES || data[0] != 0xFF || (data[1] & 0xFE) != 0xF8) return 0;
+
+    BitReader in(data, size);
+    in.read(15);
+    const bool variableBlocks = in.read(1) != 0;
+    const uint32_t blockCode = in.read(4);
+    const uint32_t rateCode = in.read(4);
+    const uint32_t channelCode = in.read(4);
+    const uint32_t sizeCode = in.read(3);
+    if (in.read(1) != 0 || blockCode == 0 || rateCode == 15 || channelCode > 10 || sizeCode == 3) return 0;
+
+    uint64_t number = 0;
+    if (!readUtf8Number(in, number)) return 0;
+
+    uint32_t blockSize = 0;
+    if (blockCode == 1) blockSize = 192;
+    else if (blockCode <= 5) blockSize = 576u << (blockCode - 2);
+    else if (blockCode == 6) blockSize = in.read(8) + 1;
+    else if (blockCode == 7) blockSize = in.read(16) + 1;
+    else blockSize = 256u << (blockCode - 8);
+
+    if (rateCode == 12) in.read(8);
+    else if (rateCode == 13 || rateCode == 14) in.read(16);
+    else if (rateCode != 0 && SAMPLE_RATES[rateCode] != info.sampleRate) return 0;
+
+    const size_t headerBytes = in.bytePosition();
+    if (headerBytes >= size || in.read(8) != crc8(data, headerBytes)) return 0;
+
+    const int bps = sizeCode == 0 ? info.bitsPerSample : SAMPLE_SIZES[sizeCode];
+    const uint32_t channels = channelCode < 8 ? channelCode + 1 : 2;
+    if (bps != info.bitsPerSample || channels != info.channels || blockSize > info.maxBlockSize) return 0;
+
+    // Planar scratch lives in the frame, so a reused frame decodes without allocating
+    std::vector<int32_t>& planar = out.planar;
+    planar.resize(static_cast<size_t>(blockSize) * channels);
+    for (uint32_t c = 0; c < channels; ++c) {
+        const bool side = (channelCode == 8 && c == 1) || (channelCode == 9 && c == 0) || (channelCode == 10 && c == 1);
+        if (!decodeSubframe(in, blockSize, bps + (side ? 1 : 0), planar.data() + c * blockSize)) return 0;
+    }
+
+    in.alignToByte();
+    const size_t bodyBytes = in.bytePosition();
+    if (bodyBytes + 2 > size) return 0;
+    const uint16_t expected = static_cast<uint16_t>((data[bodyBytes] << 8) | data[bodyBytes + 1]);
+    if (crc16(data, bodyBytes) != expected) return 0;
+
+    int32_t* a = planar.data();
+    int32_t* b = planar.data() + blockSize;
+    if (channelCode == 8) {             // left/side
+        for (uint32_t i = 0; i < blockSize; ++i) b[i] = a[i] - b[i];
+    } else if (channelCode == 9) {      // side/right
+        for (uint32_t i = 0; i < blockSize; ++i) a[i] += b[i];
+    } else if (channelCode == 10) {     // mid/side
+        for (uint32_t i = 0; i < blockSize; ++i) {
+            int32_t mid = static_cast<int32_t>((static_cast<uint32_t>(a[i]) << 1) | (b[i] & 1));
+            int32_t side = b[i];
+            a[i] = (mid + side) >> 1;
+            b[i] = (mid - side) >> 1;
+        }
+    }
+
+    out.firstSample = variableBlocks ? number : number * info.minBlockSize;
+    out.blockSize = blockSize;
+    out.samples.resize(static_cast<size_t>(blockSize) * channels);
+    for (uint32_t c = 0; c < channels; ++c) {
+        const int32_t* src = planar.data() + c * blockSize;
+        for (uint32_t i = 0; i < blockSize; ++i) out.samples[i * channels + c] = src[i];
+    }
+    return bodyBytes + 2;
+}
+
+bool FlacDecoder::forEachFrameParallel(unsigned threads,
+                                       const std::function<void(const FlacFrame&, uint64_t)>& onFrame) {
+    std::ifstream whole(filePath, std::ios::binary);
+    if (!whole || fileSize <= audioOffset) return false;
+    std::vector<uint8_t> audio(static_cast<size_t>(fileSize - audioOffset));
+    whole.seekg(static_cast<std::streamoff>(audioOffset));
+    if (!whole.read(reinterpret_cast<char*>(audio.data()), static_cast<std::streamsize>(audio.size()))) return false;
+
+    if (threads == 0) threads = TaskScheduler::instance().getConcurrency();
+    // Ranges much smaller than a frame only add resync work
+    const size_t minRange = std::max<size_t>(info.maxFrameSize, 16 * 1024);
+    threads = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(threads, audio.size() / minRange)));
+
+    // Worker i owns every frame that starts in [begin_i, begin_{i+1})
+    auto worker = [&](size_t begin, size_t end) {
+        FlacFrame decoded;
+        size_t pos = begin;
+        while (pos < end) {
+            size_t used = 0;
+            if (audio[pos] == 0xFF && pos + 1 < audio.size() && (audio[pos + 1] & 0xFE) == 0xF8) {
+                used = decodeFrame(audio.data() + pos, audio.size() - pos, info, decoded);
+            }
+            if (used == 0) {
+                ++pos;
+                continue;
+            }
+            onFrame(decoded, audioOffset + pos);
+            pos += used;
+        }
+    };
+
+    // One scheduler piece per range; the calling thread decodes ranges too
+    const size_t rangeSize = audio.size() / threads;
+    TaskScheduler::instance().parallelFor(0, threads, 1, [&](size_t first, size_t last) {
+        for (size_t t = first; t < last; ++t) {
+            worker(t * rangeSize, t + 1 == threads ? audio.size() : (t + 1) * rangeSize);
+        }
+    });
+    return true;
+}
+
+bool FlacDecoder::decodeAll(std::vector<float>& out, unsigned threads) {
+    const uint16_t channels = info.channels;
+    out.assign(static_cast<size_t>(info.totalSamples) * channels, 0.0f);
+    std::atomic<uint64_t> decodedFrames(0);
+    // Frames land at their own stream position, so workers never share output
+    bool ok = forEachFrameParallel(threads, [&](const FlacFrame& decoded, uint64_t) {
+        if (decoded.firstSample >= info.totalSamples) return;
+        const size_t n = static_cast<size_t>(std::min<uint64_t>(decoded.blockSize, info.totalSamples - decoded.firstSample));
+        float* dst = out.data() + decoded.firstSample * channels;
+        for (size_t i = 0; i < n * channels; ++i) {
+            dst[i] = static_cast<float>(decoded.samples[i]) * sampleScale;
+        }
+        decodedFrames.fetch_add(n, std::memory_order_relaxed);
+    });
+    return ok && decodedFrames.load() == info.totalSamples;
+}
+
+size_t FlacDecoder::buildSeekIndex(unsigned threads) {
+    std::mutex pointsMutex;
+    std::vector<SeekPoint> points;
+    forEachFrameParallel(threads, [&](const FlacFrame& decoded, uint64_t offset) {
+        std::lock_guard<std::mutex> lock(pointsMutex);
+        points.push_back(SeekPoint{decoded.firstSample, offset});
+    });
+    std::sort(points.begin(), points.end(),
+              [](const SeekPoint& a, const SeekPoint& b) { return a.frame < b.frame; });
+
+    seekIndex.clear();
+    seekIndex.add(0, audioOffset);
+    for (const auto& point : points) {
+        seekIndex.add(point.frame, point.byteOffset);
+    }
+    return seekIndex.size();
+}
@@ -4,6 +4,7 @@
  */
 
 #include "GPSNavigator.h"
+#include "MessageCatalog.h"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -36,15 +37,18 @@ GPSNavigator::GPSNavigator(std::shared_ptr<NotificationManager> notifManager)
     : currentLocation(0.0, 0.0, 0.0), destination(0.0, 0.0, 0.0),
       status(NavigationStatus::IDLE), currentSpeed(0.0), currentHeading(0.0),
       gpsSignalAvailable(true), satelliteCount(8), accuracy(3.0),
-      notificationManager(notifManager) {}
+      notificationManager(notifManager), eventBus(nullptr) {}
 
 void GPSNavigator::updateLocation(const GPSCoordinate& location) {
     if (!location.isValid()) {
-        notificationManager->addNotification("Invalid GPS coordinates received", AlertLevel::WARNING);
+        notificationManager->addNotification(MessageCatalog::instance().text(MessageId::GPS_INVALID_COORDINATES), AlertLevel::WARNING);
         return;
     }
     
     currentLocation = location;
+    if (eventBus != nullptr) {
+        eventBus->publish(PositionChangedEvent{location.latitude, location.longitude, location.altitude});
+    }
     checkGPSSignal();
     
     // Check if we're navigating and update status
@@ -52,33 +56,34 @@ void GPSNavigator::updateLocation(const GPSCoordinate& location) {
         double distanceToDestination = getDistanceToDestination();
         if (distanceToDestination < 0.1) { // Within 100 meters
             status = NavigationStatus::ARRIVED;
-            notificationManager->addNotification("Destination reached!", AlertLevel::INFO);
+            notificationManager->addNotification(MessageCatalog::instance().text(MessageId::GPS_DESTINATION_REACHED), AlertLevel::INFO);
+            announce(VoicePrompt::DESTINATION_REACHED);
         }
     }
 }
 
 void GPSNavigator::setDestination(const GPSCoordinate& dest, const std::string& name) {
     if (!dest.isValid()) {
-        notificationManager->addNotification("Invalid destination coordinates", AlertLevel::WARNING);
+        notificationManager->addNotification(MessageCatalog::instance().text(MessageId::GPS_INVALID_DESTINATION), AlertLevel::WARNING);
         return;
     }
     
     destination = dest;
     status = NavigationStatus::IDLE;
     
-    std::stringstream ss;
-    ss << "Destination set: " << name << " (" << formatCoordinate(dest) << ")";
-    notificationManager->addNotification(ss.str(), AlertLevel::INFO);
+    notificationManager->addNotification(
+        MessageCatalog::instance().format(MessageId::GPS_DESTINATION_SET, {name, formatCoordinate(dest)}),
+        AlertLevel::INFO);
 }
 
 void GPSNavigator::startNavigation() {
     if (!destination.isValid()) {
-        notificationManager->addNotification("No destination set for navigation", AlertLevel::WARNING);
+        notificationManager->addNotification(MessageCatalog::instance().text(MessageId::GPS_NO_DESTINATION), AlertLevel::WARNING);
         return;
     }
     
     if (!gpsSignalAvailable) {
-        notificationManager->addNotification("GPS signal unavailable - cannot start navigation", AlertLevel::CRITICAL);
+        notificationManager->addNotification(MessageCatalog::instance().text(MessageId::GPS_SIGNAL_UNAVAILABLE), AlertLevel::CRITICAL);
         return;
     }
     
@@ -86,25 +91,25 @@ void GPSNavigator::startNavigation() {
     double distance = getDistanceToDestination();
     double eta = getEstimatedTimeToArrival();
     
-    std::stringstream ss;
-    ss << "Navigation started - Distance: " << std::fixed << std::setprecision(1) 
-       << distance << " km, ETA: " << std::fixed << std::setprecision(0) << eta << " min";
-    notificationManager->addNotification(ss.str(), AlertLevel::INFO);
+    notificationManager->addNotification(
+        MessageCatalog::instance().format(MessageId::GPS_NAVIGATION_STARTED,
+                                          {formatFixed(distance, 1), formatFixed(eta, 0)}),
+        AlertLevel::INFO);
+    announce(VoicePrompt::NAVIGATION_STARTED);
 }
 void GPSNavigator::stopNavigation() {
     status = NavigationStatus::IDLE;
     clearRoute();
-    notificationManager->addNotification("Navigation stopped", AlertLevel::INFO);
+    notificationManager->addNotification(MessageCatalog::instance().text(MessageId::GPS_NAVIGATION_STOPPED), AlertLevel::INFO);
 }
 void GPSNavigator::addWaypoint(const Waypoint& waypoint) {
     if (!waypoint.coordinate.isValid()) {
-        notificationManager->addNotification("Invalid waypoint coordinates", AlertLevel::WARNING);
+        notificationManager->addNotification(MessageCatalog::instance().text(MessageId::GPS_INVALID_WAYPOINT), AlertLevel::WARNING);
         return;
     }    
     route.push_back(waypoint);
-        std::stringstream ss;
-    ss << "Waypoint added: " << waypoint.name;
-    notificationManager->addNotification(ss.str(), AlertLevel::INFO);
+    notificationManager->addNotification(
+        MessageCatalog::instance().format(MessageId::GPS_WAYPOINT_ADDED, {waypoint.name}), AlertLevel::INFO);
 }
 
 void GPSNavigator::clearRoute() {
@@ -144,6 +149,7 @@ double GPSNavigator::getEstimatedTimeToArrival() const {
 }
 void GPSNavigator::updateSpeed(double speed) {
     currentSpeed = std::max(0.0, speed);
+    if (eventBus != nullptr) eventBus->publish(SpeedChangedEvent{currentSpeed});
 }
 void GPSNavigator::updateHeading(double heading) {
     // Normalize heading to 0-360 degrees
@@ -163,14 +169,27 @@ void GPSNavigator::checkGPSSignal() {
         if (status == NavigationStatus::NAVIGATING) {
             status = NavigationStatus::GPS_LOST;
         }
-        notificationManager->addNotification("GPS signal lost!", AlertLevel::CRITICAL);
+        notificationManager->addNotification(MessageCatalog::instance().text(MessageId::GPS_SIGNAL_LOST), AlertLevel::CRITICAL);
+        announce(VoicePrompt::GPS_SIGNAL_LOST);
     } else if (gpsSignalAvailable && !previousSignalStatus) {
         if (status == NavigationStatus::GPS_LOST) {
             status = NavigationStatus::NAVIGATING;
         }
-        notificationManager->addNotification("GPS signal restored", AlertLevel::INFO);
+        notificationManager->addNotification(MessageCatalog::instance().text(MessageId::GPS_SIGNAL_RESTORED), AlertLevel::INFO);
+        announce(VoicePrompt::GPS_SIGNAL_RESTORED);
+    }
+}
+void GPSNavigator::announce(VoicePrompt prompt) {
+    if (voicePromptHandler) {
+        voicePromptHandler(prompt);
     }
 }
+void GPSNavigator::setVoicePromptHandler(std::function<void(VoicePrompt)> handler) {
+    voicePromptHandler = std::move(handler);
+}
+void GPSNavigator::setEventBus(VehicleEventBus* bus) {
+    eventBus = bus;
+}
 double GPSNavigator::calculateBearing(const GPSCoordinate& from, const GPSCoordinate& to) const {
     if (!from.isValid() || !to.isValid()) {
         return 0.0;
@@ -249,11 +268,10 @@ void GPSNavigator::displayRoute() const {
     std::cout << std::string(40, '=') << std::endl;
 }
 void GPSNavigator::simulateGPSUpdate() {
-    std::random_device rd;
-    std::mt19937 gen(rd());    
+    static std::mt19937 gen(std::random_device{}());
     // Simulate small GPS coordinate changes
     std::uniform_real_distribution<> coordVar(-0.001, 0.001);
-    std::uniform_real_distribution<> speedVar(-2.0, 5.0);
+    std::uniform_real_distribution<> speedVar(-5.0, 5.0);
     std::uniform_real_distribution<> headingVar(-10.0, 10.0);
     std::uniform_int_distribution<> satVar(4, 12);
     std::uniform_real_distribution<> accVar(1.0, 8.0);
@@ -264,11 +282,9 @@ void GPSNavigator::simulateGPSUpdate() {
         currentLocation.altitude
     );    
     updateLocation(newLocation);
-    updateSpeed(std::max(0.0, currentSpeed + speedVar(gen)));
+    updateSpeed(std::max(0.0, currentSpeed + 0.1 * (SIMULATED_CRUISE_SPEED - currentSpeed) + speedVar(gen)));
     updateHeading(currentHeading + headingVar(gen));
     updateGPSSignal(satVar(gen), accVar(gen));
-    
-    std::cout << "\tGPS data updated..." << std::endl;
 }
 std::string GPSNavigator::statusToString(NavigationStatus status) {
     switch (status) {
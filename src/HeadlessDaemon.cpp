@@ -0,0 +1,372 @@
+/**
+ * @file HeadlessDaemon.cpp
+ * @brief Implementation of the HeadlessDaemon class
+ */
+
+#include "HeadlessDaemon.h"
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HEADLESS_DAEMON_POSIX 1
+#endif
+
+namespace {
+const size_t SINK_BUFFER_BYTES = 64 * 1024;
+const auto FLUSH_INTERVAL = std::chrono::milliseconds(1000);
+const auto DISPLAY_TICK = std::chrono::milliseconds(60000);
+const char* const DEFAULT_TCP_ADDRESS = "127.0.0.1";
+
+#if !defined(HEADLESS_DAEMON_POSIX)
+// Without signalfd, stop signals only raise this flag for a polling timer
+std::atomic<bool> stopRequested(false);
+const auto SIGNAL_POLL_INTERVAL = std::chrono::milliseconds(200);
+#endif
+
+int64_t unixMillis(std::chrono::system_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+}
+
+bool parseFormatOption(const std::string& option, FeedFormat& format) {
+    for (size_t i = 0; i < static_cast<size_t>(FeedFormat::COUNT); ++i) {
+        const auto candidate = static_cast<FeedFormat>(i);
+        if (option == std::string("--") + VehicleDataFeed::formatName(candidate)) {
+            format = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+DaemonOptions::DaemonOptions() : alertSink("-"), stateInterval(1000) {}
+
+HeadlessDaemon::HeadlessDaemon(DaemonOptions daemonOptions, std::shared_ptr<NotificationManager> notifications,
+                               std::shared_ptr<VehicleMonitor> vehicle, std::shared_ptr<GPSNavigator> gps,
+                               std::shared_ptr<DisplayScheduler> scheduler)
+    : options(std::move(daemonOptions)), notificationManager(std::move(notifications)),
+      vehicleMonitor(std::move(vehicle)), gpsNavigator(std::move(gps)), displayScheduler(std::move(scheduler)),
+      feed(vehicleMonitor, gpsNavigator), alertOutput(nullptr), stateOutput(nullptr), openInputs(0), alertCount(0),
+      stateCount(0), connectionCount(0), startTime(std::chrono::steady_clock::now()) {
+    notificationManager->setConsoleOutput(false);
+    notificationManager->setHistoryLimit(HISTORY_LIMIT);
+}
+
+HeadlessDaemon::~HeadlessDaemon() {
+    notificationManager->setSink(nullptr);
+    closeSink(alertOutput);
+    closeSink(stateOutput);
+#if defined(HEADLESS_DAEMON_POSIX)
+    for (int fd : descriptors) ::close(fd);
+#endif
+}
+
+bool HeadlessDaemon::parseArguments(int argc, const char* const* argv, DaemonOptions& parsed, std::string& error) {
+    parsed = DaemonOptions();
+    bool headless = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+        if (option == "--headless") {
+            headless = true;
+            continue;
+        }
+        FeedFormat format;
+        const bool input = parseFormatOption(option, format);
+        if (!input && option != "--alerts" && option != "--state" && option != "--state-interval") {
+            error = "Unknown option: " + option;
+            return false;
+        }
+        if (i + 1 >= argc) {
+            error = "Missing value for " + option;
+            return false;
+        }
+        const std::string value = argv[++i];
+        if (input) {
+            parsed.inputs.push_back(DaemonInput{format, value});
+        } else if (option == "--alerts") {
+            parsed.alertSink = value;
+        } else if (option == "--state") {
+            parsed.stateSink = value;
+        } else if (option == "--state-interval") {
+            char* end = nullptr;
+            const long milliseconds = std::strtol(value.c_str(), &end, 10);
+            if (end == value.c_str() || *end != '\0' || milliseconds < 1) {
+                error = "Invalid state interval: " + value;
+                return false;
+            }
+            parsed.stateInterval = std::chrono::milliseconds(milliseconds);
+        }
+    }
+    if (!headless) {
+        error = "Options require --headless";
+        return false;
+    }
+    if (parsed.inputs.empty()) {
+        error = "No inputs given";
+        return false;
+    }
+    return true;
+}
+
+const char* HeadlessDaemon::usage() {
+    return "Usage: vehicle_system --headless [inputs] [outputs]\n"
+           "Inputs (repeatable; SOURCE is a file, a FIFO, - for stdin, or tcp:[address:]port):\n"
+           "  --nmea SOURCE             NMEA 0183 RMC/GGA sentences\n"
+           "  --can SOURCE              candump log with OBD-II responses\n"
+           "  --telemetry SOURCE        \"<sensor> <value>\" lines\n"
+           "Outputs (a path, or - for stdout):\n"
+           "  --alerts SINK             alerts, one per line (default: -)\n"
+           "  --state SINK              periodic vehicle and GPS state records\n"
+           "  --state-interval MS       time between state records (default: 1000)\n"
+           "Signals: SIGUSR1 prints throughput counters to stderr; SIGINT/SIGTERM stop.\n";
+}
+
+void HeadlessDaemon::blockSignals() {
+#if defined(HEADLESS_DAEMON_POSIX)
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGUSR1);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    // A reader of a sink pipe going away must not kill the daemon
+    std::signal(SIGPIPE, SIG_IGN);
+#else
+    std::signal(SIGINT, [](int) { stopRequested = true; });
+    std::signal(SIGTERM, [](int) { stopRequested = true; });
+#endif
+}
+
+std::FILE* HeadlessDaemon::openSink(const std::string& target) {
+    std::FILE* sink = target == "-" ? stdout : std::fopen(target.c_str(), "a");
+    if (sink != nullptr) std::setvbuf(sink, nullptr, _IOFBF, SINK_BUFFER_BYTES);
+    return sink;
+}
+
+void HeadlessDaemon::closeSink(std::FILE* sink) {
+    if (sink == nullptr) return;
+    if (sink == stdout) {
+        std::fflush(sink);
+    } else {
+        std::fclose(sink);
+    }
+}
+
+bool HeadlessDaemon::addLineSource(FeedFormat format, int fd, bool countsAsInput) {
+#if defined(HEADLESS_DAEMON_POSIX)
+    const auto id = loop.addLineReader(
+        fd, [this, format](std::string_view line) { feed.apply(format, line); },
+        [this, fd, countsAsInput]() {
+            descriptors.erase(std::find(descriptors.begin(), descriptors.end(), fd));
+            ::close(fd);
+            if (countsAsInput && --openInputs == 0) loop.stop();
+        });
+    if (id == 0) return false;
+    descriptors.push_back(fd);
+    if (countsAsInput) ++openInputs;
+    return true;
+#else
+    (void)format;
+    (void)fd;
+    (void)countsAsInput;
+    return false;
+#endif
+}
+
+bool HeadlessDaemon::openInput(const DaemonInput& input) {
+#if defined(HEADLESS_DAEMON_POSIX)
+    if (input.source.compare(0, 4, "tcp:") == 0) return listenTcp(input.format, input.source.substr(4));
+    if (input.source == "-") {
+        const int fd = ::fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, 0);
+        if (fd < 0) return false;
+        if (!addLineSource(input.format, fd, true)) {
+            ::close(fd);
+            return false;
+        }
+        return true;
+    }
+
+    struct stat info;
+    if (::stat(input.source.c_str(), &info) != 0) return false;
+    // Read-write keeps a FIFO open across writers, so it runs until stopped
+    const bool fifo = S_ISFIFO(info.st_mode);
+    const int fd = ::open(input.source.c_str(), (fifo ? O_RDWR : O_RDONLY) | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) return false;
+    if (!addLineSource(input.format, fd, true)) {
+        ::close(fd);
+        return false;
+    }
+    return true;
+#else
+    (void)input;
+    return false;
+#endif
+}
+
+bool HeadlessDaemon::listenTcp(FeedFormat format, const std::string& endpoint) {
+#if defined(HEADLESS_DAEMON_POSIX)
+    const size_t colon = endpoint.rfind(':');
+    const std::string address = colon == std::string::npos ? DEFAULT_TCP_ADDRESS : endpoint.substr(0, colon);
+    const std::string portText = colon == std::string::npos ? endpoint : endpoint.substr(colon + 1);
+    char* end = nullptr;
+    const long port = std::strtol(portText.c_str(), &end, 10);
+    if (portText.empty() || *end != '\0' || port < 1 || port > 65535) return false;
+
+    sockaddr_in socketAddress{};
+    socketAddress.sin_family = AF_INET;
+    socketAddress.sin_port = htons(static_cast<uint16_t>(port));
+    if (inet_pton(AF_INET, address.c_str(), &socketAddress.sin_addr) != 1) return false;
+
+    const int listener = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listener < 0) return false;
+    const int reuse = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    if (::bind(listener, reinterpret_cast<const sockaddr*>(&socketAddress), sizeof(socketAddress)) != 0 ||
+        ::listen(listener, SOMAXCONN) != 0) {
+        ::close(listener);
+        return false;
+    }
+    descriptors.push_back(listener);
+    // A listener never ends, so the daemon runs until it is signalled
+    ++openInputs;
+    return loop.addReader(listener, [this, format, listener]() {
+        int client;
+        while ((client = ::accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+            ++connectionCount;
+            if (!addLineSource(format, client, false)) ::close(client);
+        }
+    }) != 0;
+#else
+    (void)format;
+    (void)endpoint;
+    return false;
+#endif
+}
+
+void HeadlessDaemon::watchSignals() {
+#if defined(HEADLESS_DAEMON_POSIX)
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGUSR1);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    const int signalFd = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (signalFd < 0) return;
+    descriptors.push_back(signalFd);
+    loop.addReader(signalFd, [this, signalFd]() {
+        signalfd_siginfo info;
+        while (::read(signalFd, &info, sizeof(info)) == static_cast<ssize_t>(sizeof(info))) {
+            if (info.ssi_signo == SIGUSR1) {
+                std::cerr << "vehicle_system: " << counterReport() << std::endl;
+            } else {
+                loop.stop();
+            }
+        }
+    });
+#else
+    loop.addTimer(SIGNAL_POLL_INTERVAL, [this]() {
+        if (stopRequested.load()) loop.stop();
+    });
+#endif
+}
+
+void HeadlessDaemon::writeState() {
+    const GPSCoordinate location = gpsNavigator->getCurrentLocation();
+    std::fprintf(stateOutput,
+                 "%lld\tSTATE\tspeed=%.1f\tengine_temp=%.1f\tfuel=%.1f\tbrake_wear=%.1f\tconsumption=%.1f"
+                 "\tlat=%.6f\tlon=%.6f\talt=%.1f\theading=%.1f\tsatellites=%d\tgps_fix=%d\n",
+                 static_cast<long long>(unixMillis(std::chrono::system_clock::now())),
+                 vehicleMonitor->getCurrentSpeed(), vehicleMonitor->getEngineTemperature(),
+                 vehicleMonitor->getFuelLevel(), vehicleMonitor->getBrakeWearLevel(),
+                 vehicleMonitor->getFuelConsumptionRate(), location.latitude, location.longitude, location.altitude,
+                 gpsNavigator->getCurrentHeading(), gpsNavigator->getSatelliteCount(),
+                 gpsNavigator->isGPSSignalAvailable() ? 1 : 0);
+    ++stateCount;
+}
+
+int HeadlessDaemon::run() {
+    startTime = std::chrono::steady_clock::now();
+    if (!options.alertSink.empty() && (alertOutput = openSink(options.alertSink)) == nullptr) {
+        std::cerr << "vehicle_system: Cannot open alert output " << options.alertSink << std::endl;
+        return 1;
+    }
+    if (!options.stateSink.empty() && (stateOutput = openSink(options.stateSink)) == nullptr) {
+        std::cerr << "vehicle_system: Cannot open state output " << options.stateSink << std::endl;
+        return 1;
+    }
+    for (const DaemonInput& input : options.inputs) {
+        if (!openInput(input)) {
+            std::cerr << "vehicle_system: Cannot open " << VehicleDataFeed::formatName(input.format) << " input "
+                      << input.source << std::endl;
+            return 1;
+        }
+    }
+
+    if (alertOutput != nullptr) {
+        notificationManager->setSink([this](const Notification& notification) {
+            std::fprintf(alertOutput, "%lld\t%s\t%s\n", static_cast<long long>(unixMillis(notification.timestamp)),
+                         NotificationManager::alertLevelToString(notification.level).c_str(),
+                         notification.message.c_str());
+            ++alertCount;
+        });
+    }
+    if (stateOutput != nullptr) loop.addTimer(options.stateInterval, [this]() { writeState(); });
+    loop.addTimer(FLUSH_INTERVAL, [this]() {
+        if (alertOutput != nullptr) std::fflush(alertOutput);
+        if (stateOutput != nullptr) std::fflush(stateOutput);
+    });
+    if (displayScheduler) {
+        loop.addTimer(DISPLAY_TICK, [this]() { displayScheduler->tick(std::time(nullptr)); });
+    }
+    watchSignals();
+
+    loop.run();
+
+    // Where a replay ended is worth a record even between intervals
+    if (stateOutput != nullptr) writeState();
+    notificationManager->setSink(nullptr);
+    if (alertOutput != nullptr) std::fflush(alertOutput);
+    if (stateOutput != nullptr) std::fflush(stateOutput);
+    std::cerr << "vehicle_system: " << counterReport() << std::endl;
+    return 0;
+}
+
+void HeadlessDaemon::stop() {
+    loop.stop();
+}
+
+std::string HeadlessDaemon::counterReport() const {
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(3) << "uptime " << seconds << " s";
+    for (size_t i = 0; i < static_cast<size_t>(FeedFormat::COUNT); ++i) {
+        const auto format = static_cast<FeedFormat>(i);
+        const FeedCounters& counters = feed.getCounters(format);
+        if (counters.lines == 0) continue;
+        report << std::setprecision(0) << "; " << VehicleDataFeed::formatName(format) << " " << counters.lines
+               << " lines " << (seconds > 0.0 ? counters.lines / seconds : 0.0) << "/s "
+               << std::setprecision(1) << (seconds > 0.0 ? counters.bytes / seconds / 1e6 : 0.0) << " MB/s "
+               << counters.rejected << " rejected";
+    }
+    report << "; alerts " << alertCount << "; state records " << stateCount << "; connections " << connectionCount;
+    return report.str();
+}
+
+const VehicleDataFeed& HeadlessDaemon::getFeed() const {
+    return feed;
+}
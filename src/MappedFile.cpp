@@ -0,0 +1,119 @@
+/**
+ * @file MappedFile.cpp
+ * @brief Implementation of the MappedFile class
+ */
+
+#include "MappedFile.h"
+#include "BinaryIO.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_FILE_POSIX 1
+#elif defined(_WIN32)
+#include <windows.h>
+#define MAPPED_FILE_WIN32 1
+#endif
+
+MappedFile::MappedFile() : bytes(nullptr), length(0), mappingHandle(nullptr) {}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+
+#if defined(MAPPED_FILE_POSIX)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    length = static_cast<size_t>(info.st_size);
+    if (length == 0) {
+        // mmap rejects empty mappings
+        ::close(fd);
+        bytes = reinterpret_cast<const uint8_t*>(fallback.data());
+        return true;
+    }
+    void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping holds its own reference to the file
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        length = 0;
+        return false;
+    }
+    // Records are looked up by ID, so read-ahead mostly loads unused pages
+    madvise(mapped, length, MADV_RANDOM);
+    bytes = static_cast<const uint8_t*>(mapped);
+    return true;
+#elif defined(MAPPED_FILE_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+    length = static_cast<size_t>(fileSize.QuadPart);
+    if (length == 0) {
+        CloseHandle(file);
+        bytes = reinterpret_cast<const uint8_t*>(fallback.data());
+        return true;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        length = 0;
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        length = 0;
+        return false;
+    }
+    mappingHandle = mapping;
+    bytes = static_cast<const uint8_t*>(view);
+    return true;
+#else
+    if (!readFileContents(path, fallback)) return false;
+    bytes = reinterpret_cast<const uint8_t*>(fallback.data());
+    length = fallback.size();
+    return true;
+#endif
+}
+
+void MappedFile::close() {
+    if (bytes != nullptr && length > 0 && fallback.empty()) {
+#if defined(MAPPED_FILE_POSIX)
+        munmap(const_cast<uint8_t*>(bytes), length);
+#elif defined(MAPPED_FILE_WIN32)
+        UnmapViewOfFile(bytes);
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+#endif
+    }
+    bytes = nullptr;
+    length = 0;
+    mappingHandle = nullptr;
+    fallback.clear();
+    fallback.shrink_to_fit();
+}
+
+bool MappedFile::isOpen() const {
+    return bytes != nullptr;
+}
+
+const uint8_t* MappedFile::data() const {
+    return bytes;
+}
+
+size_t MappedFile::size() const {
+    return length;
+}
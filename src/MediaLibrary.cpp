@@ -0,0 +1,323 @@
+/**
+ * @file MediaLibrary.cpp
+ * @brief Implementation of the MediaLibrary class
+ */
+
+#include "MediaLibrary.h"
+#include "BinaryIO.h"
+#include "MetadataNormalizer.h"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+// Every record takes at least 24 bytes; never trust a count beyond that
+const size_t MIN_RECORD_BYTES = 24;
+
+uint64_t hashPath(const std::string& path) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : path) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+Track readTrackRecord(BinaryReader& in, uint32_t version, uint32_t& playCount) {
+    std::string title = in.str();
+    std::string artist = in.str();
+    std::string album = in.str();
+    Track track(title, artist, album, 0);
+    track.filePath = in.str();
+    track.duration = in.i32();
+    track.replayGainDb = in.f32();
+    playCount = version >= 2 ? in.u32() : 0;
+    return track;
+}
+
+void writeTrackRecord(BinaryWriter& out, const Track& track, uint32_t playCount) {
+    out.str(track.title);
+    out.str(track.artist);
+    out.str(track.album);
+    out.str(track.filePath);
+    out.i32(track.duration);
+    out.f32(track.replayGainDb);
+    out.u32(playCount);
+}
+
+bool readHeader(BinaryReader& in, uint32_t& version, uint32_t& count) {
+    const uint32_t magic = in.u32();
+    version = in.u32();
+    count = in.u32();
+    return in.good() && magic == MediaLibrary::CACHE_MAGIC && version >= 1 && version <= MediaLibrary::CACHE_VERSION;
+}
+
+bool readRecency(BinaryReader& in, uint32_t version, size_t trackCount, std::vector<TrackId>& recent) {
+    if (version < 2) return true;
+    uint32_t recentCount = in.u32();
+    if (recentCount > trackCount) return false;
+    recent.resize(recentCount);
+    for (auto& id : recent) id = in.u32();
+    return in.good();
+}
+} // namespace
+
+Track::Track(const std::string& t, const std::string& ar, const std::string& al, int dur)
+    : title(t), artist(ar), album(al), duration(dur) {}
+
+MediaLibrary::MediaLibrary() : pagedVersion(0), pageCapacity(0) {}
+
+TrackId MediaLibrary::appendTrack(Track&& track, uint64_t key) {
+    TrackId id = static_cast<TrackId>(size());
+    if (!track.filePath.empty()) {
+        pathIndex.emplace(hashPath(track.filePath), id);
+    }
+    recordingIndex.emplace(key, id);
+    sortKeys.push_back(MetadataNormalizer::sortKey(track.title));
+    tracks.push_back(std::move(track));
+    statistics.resize(size());
+    return id;
+}
+
+TrackId MediaLibrary::findDuplicate(const Track& track, uint64_t key) const {
+    if (!track.filePath.empty()) {
+        TrackId id = findByPath(track.filePath);
+        if (id != INVALID_TRACK_ID) return id;
+    }
+    auto it = recordingIndex.find(key);
+    if (it != recordingIndex.end() && MetadataNormalizer::sameRecording(*getTrack(it->second), track)) {
+        return it->second;
+    }
+    return INVALID_TRACK_ID;
+}
+
+TrackId MediaLibrary::addTrack(const Track& track) {
+    Track normalized = track;
+    MetadataNormalizer::normalize(normalized);
+    const uint64_t key = MetadataNormalizer::duplicateKey(normalized);
+    return appendTrack(std::move(normalized), key);
+}
+
+std::vector<TrackId> MediaLibrary::addScannedTracks(std::vector<Track> scanned, unsigned threads) {
+    const std::vector<uint64_t> keys = MetadataNormalizer::normalizeAll(scanned, threads);
+
+    // Insertion stays sequential so IDs follow scan order
+    std::vector<TrackId> ids(scanned.size());
+    tracks.reserve(tracks.size() + scanned.size());
+    for (size_t i = 0; i < scanned.size(); ++i) {
+        TrackId existing = findDuplicate(scanned[i], keys[i]);
+        ids[i] = existing != INVALID_TRACK_ID ? existing : appendTrack(std::move(scanned[i]), keys[i]);
+    }
+    return ids;
+}
+
+Track MediaLibrary::readPagedTrack(TrackId id) const {
+    const uint32_t offset = recordOffsets[id];
+    BinaryReader in(pagedFile->data() + offset, pagedFile->size() - offset);
+    uint32_t playCount = 0;
+    Track track = readTrackRecord(in, pagedVersion, playCount);
+    MetadataNormalizer::normalize(track);
+    return track;
+}
+
+const Track* MediaLibrary::pageIn(TrackId id) const {
+    auto cached = pageIndex.find(id);
+    if (cached != pageIndex.end()) {
+        pageLru.splice(pageLru.begin(), pageLru, cached->second);
+        return &cached->second->second;
+    }
+    pageLru.emplace_front(id, readPagedTrack(id));
+    pageIndex.emplace(id, pageLru.begin());
+    if (pageLru.size() > pageCapacity) {
+        pageIndex.erase(pageLru.back().first);
+        pageLru.pop_back();
+    }
+    return &pageLru.front().second;
+}
+
+std::string_view MediaLibrary::titleOf(TrackId id) const {
+    if (id >= recordOffsets.size()) {
+        return tracks[id - recordOffsets.size()].title;
+    }
+    // A record starts with the length-prefixed title, checked by openPaged
+    const uint8_t* record = pagedFile->data() + recordOffsets[id];
+    BinaryReader in(record, 4);
+    const uint32_t length = in.u32();
+    return std::string_view(reinterpret_cast<const char*>(record + 4), length);
+}
+
+const Track* MediaLibrary::getTrack(TrackId id) const {
+    if (id < recordOffsets.size()) return pageIn(id);
+    const size_t index = id - recordOffsets.size();
+    return index < tracks.size() ? &tracks[index] : nullptr;
+}
+
+std::vector<TrackId> MediaLibrary::browseByTitle(size_t first, size_t count) const {
+    if (titleOrder.size() != size()) {
+        titleOrder.resize(size());
+        std::iota(titleOrder.begin(), titleOrder.end(), 0);
+        // Sort keys settle almost every comparison without touching the records
+        std::sort(titleOrder.begin(), titleOrder.end(), [this](TrackId a, TrackId b) {
+            if (sortKeys[a] != sortKeys[b]) return sortKeys[a] < sortKeys[b];
+            const int order = MetadataNormalizer::compareFolded(titleOf(a), titleOf(b));
+            return order != 0 ? order < 0 : a < b;
+        });
+    }
+    if (first >= titleOrder.size()) return {};
+    const size_t last = std::min(titleOrder.size(), first + count);
+    return std::vector<TrackId>(titleOrder.begin() + first, titleOrder.begin() + last);
+}
+
+TrackId MediaLibrary::findByPath(const std::string& path) const {
+    auto it = pathIndex.find(hashPath(path));
+    if (it == pathIndex.end()) return INVALID_TRACK_ID;
+    // Confirm against the stored path in case of a hash collision
+    return getTrack(it->second)->filePath == path ? it->second : INVALID_TRACK_ID;
+}
+
+void MediaLibrary::recordPlay(TrackId id) {
+    statistics.recordPlay(id);
+}
+
+const PlayStatistics& MediaLibrary::getStatistics() const {
+    return statistics;
+}
+
+size_t MediaLibrary::size() const {
+    return recordOffsets.size() + tracks.size();
+}
+
+void MediaLibrary::clear() {
+    tracks.clear();
+    pathIndex.clear();
+    recordingIndex.clear();
+    sortKeys.clear();
+    titleOrder.clear();
+    statistics.clear();
+    pageLru.clear();
+    pageIndex.clear();
+    recordOffsets.clear();
+    pagedFile.reset();
+    pagedVersion = 0;
+    pageCapacity = 0;
+}
+
+bool MediaLibrary::save(const std::string& path) const {
+    BinaryWriter out;
+    out.reserve(16 + size() * 104);
+    out.u32(CACHE_MAGIC);
+    out.u32(CACHE_VERSION);
+    out.u32(static_cast<uint32_t>(size()));
+    const auto& playCounts = statistics.getPlayCounts();
+    // Paged records are decoded directly so saving does not churn the LRU
+    for (TrackId id = 0; id < recordOffsets.size(); ++id) {
+        writeTrackRecord(out, readPagedTrack(id), playCounts[id]);
+    }
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        writeTrackRecord(out, tracks[i], playCounts[recordOffsets.size() + i]);
+    }
+    const auto recent = statistics.recentlyPlayed(statistics.getPlayedCount());
+    out.u32(static_cast<uint32_t>(recent.size()));
+    for (TrackId id : recent) {
+        out.u32(id);
+    }
+    return writeFileContents(path, out.data());
+}
+
+bool MediaLibrary::load(const std::string& path) {
+    std::string contents;
+    if (!readFileContents(path, contents)) return false;
+
+    BinaryReader in(contents.data(), contents.size());
+    uint32_t version = 0, count = 0;
+    if (!readHeader(in, version, count)) return false;
+
+    std::vector<Track> loaded;
+    std::vector<uint32_t> playCounts;
+    loaded.reserve(std::min<size_t>(count, in.remaining() / MIN_RECORD_BYTES));
+    for (uint32_t i = 0; i < count && in.good(); ++i) {
+        uint32_t playCount = 0;
+        loaded.push_back(readTrackRecord(in, version, playCount));
+        playCounts.push_back(playCount);
+    }
+    std::vector<TrackId> recent;
+    if (!in.good() || !readRecency(in, version, loaded.size(), recent)) return false;
+
+    PlayStatistics loadedStatistics;
+    if (!loadedStatistics.restore(playCounts, recent)) return false;
+
+    // Caches written before normalization existed are cleaned up here
+    const std::vector<uint64_t> keys = MetadataNormalizer::normalizeAll(loaded);
+
+    clear();
+    tracks = std::move(loaded);
+    statistics = std::move(loadedStatistics);
+    sortKeys.reserve(tracks.size());
+    for (TrackId id = 0; id < tracks.size(); ++id) {
+        if (!tracks[id].filePath.empty()) {
+            pathIndex.emplace(hashPath(tracks[id].filePath), id);
+        }
+        recordingIndex.emplace(keys[id], id);
+        sortKeys.push_back(MetadataNormalizer::sortKey(tracks[id].title));
+    }
+    return true;
+}
+
+bool MediaLibrary::openPaged(const std::string& path, size_t cachedTracks) {
+    auto file = std::make_unique<MappedFile>();
+    // Record offsets are stored as 32 bits
+    if (!file->open(path) || file->size() > std::numeric_limits<uint32_t>::max()) return false;
+
+    BinaryReader in(file->data(), file->size());
+    uint32_t version = 0, count = 0;
+    if (!readHeader(in, version, count)) return false;
+
+    // One pass over the records; each decoded track is dropped right away
+    const size_t reserve = std::min<size_t>(count, in.remaining() / MIN_RECORD_BYTES);
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> playCounts;
+    std::vector<uint64_t> titleKeys;
+    std::unordered_map<uint64_t, TrackId> paths;
+    std::unordered_map<uint64_t, TrackId> recordings;
+    offsets.reserve(reserve);
+    playCounts.reserve(reserve);
+    titleKeys.reserve(reserve);
+    for (uint32_t i = 0; i < count && in.good(); ++i) {
+        offsets.push_back(static_cast<uint32_t>(in.position()));
+        uint32_t playCount = 0;
+        Track track = readTrackRecord(in, version, playCount);
+        MetadataNormalizer::normalize(track);
+        if (!track.filePath.empty()) {
+            paths.emplace(hashPath(track.filePath), i);
+        }
+        recordings.emplace(MetadataNormalizer::duplicateKey(track), i);
+        titleKeys.push_back(MetadataNormalizer::sortKey(track.title));
+        playCounts.push_back(playCount);
+    }
+    std::vector<TrackId> recent;
+    if (!in.good() || !readRecency(in, version, offsets.size(), recent)) return false;
+
+    PlayStatistics loadedStatistics;
+    if (!loadedStatistics.restore(playCounts, recent)) return false;
+
+    clear();
+    pagedFile = std::move(file);
+    pagedVersion = version;
+    pageCapacity = std::max(cachedTracks, MIN_PAGE_CAPACITY);
+    recordOffsets = std::move(offsets);
+    pathIndex = std::move(paths);
+    recordingIndex = std::move(recordings);
+    sortKeys = std::move(titleKeys);
+    statistics = std::move(loadedStatistics);
+    return true;
+}
+
+bool MediaLibrary::isPaged() const {
+    return pagedFile != nullptr;
+}
+
+size_t MediaLibrary::getPagedCount() const {
+    return recordOffsets.size();
+}
+
+size_t MediaLibrary::getCachedTrackCount() const {
+    return pageLru.size();
+}
@@ -8,15 +8,278 @@
 #include <iomanip>
 #include <thread>
 #include <chrono>
+#include <algorithm>
+
+namespace {
+// dspChanges bits; EQ band n uses EQ_BAND_CHANGED << n
+constexpr uint32_t VOLUME_CHANGED = 1u << 0;
+constexpr uint32_t LOUDNESS_CHANGED = 1u << 1;
+constexpr uint32_t EQ_BAND_CHANGED = 1u << 2;
+} // namespace
 
-Track::Track(const std::string& t, const std::string& ar, const std::string& al, int dur)
-    : title(t), artist(ar), album(al), duration(dur) {}
 MediaPlayer::MediaPlayer(std::shared_ptr<NotificationManager> notifManager)
-    : currentTrackIndex(0), state(PlayerState::STOPPED), volume(50), 
-      currentPosition(0), notificationManager(notifManager) {}
-void MediaPlayer::addTrack(const Track& track) {
-    playlist.push_back(track);
+    : libraryCacheLimit(0), currentTrackIndex(0), state(PlayerState::STOPPED), volume(50), 
+      audioTrack(INVALID_TRACK_ID), fadeFramesRemaining(0), positionFrames(0), trackFrames(0),
+      pendingSeek(NO_SEEK), trackEnded(false), dspVolume(50), dspLoudnessDb(0.0f), dspChanges(0), notificationManager(notifManager) {
+    for (auto& band : dspEqDb) {
+        band.store(0.0f, std::memory_order_relaxed);
+    }
+    // Decoders have at most AUDIO_CHANNELS channels, so the callback never has to grow this
+    decodeBuffer.assign(MAX_DECODE_FRAMES * AUDIO_CHANNELS, 0.0f);
+    fadeBuffer.assign(MAX_DECODE_FRAMES * AUDIO_CHANNELS, 0.0f);
+    dsp.setVolume(volume);
+    dsp.reset();
+}
+void MediaPlayer::applyTrackGain() {
+    if (const Track* track = trackAt(currentTrackIndex)) {
+        dspLoudnessDb.store(track->replayGainDb, std::memory_order_relaxed);
+        publishDspChange(LOUDNESS_CHANGED);
+    }
+}
+void MediaPlayer::publishDspChange(uint32_t bit) {
+    dspChanges.fetch_or(bit, std::memory_order_release);
+}
+void MediaPlayer::applyDspChanges() {
+    // A value stored after the exchange sets its bit again and is applied twice, which is harmless
+    const uint32_t changes = dspChanges.exchange(0, std::memory_order_acquire);
+    if (changes == 0) return;
+    if (changes & VOLUME_CHANGED) {
+        dsp.setVolume(dspVolume.load(std::memory_order_relaxed));
+    }
+    if (changes & LOUDNESS_CHANGED) {
+        dsp.setLoudnessGain(dspLoudnessDb.load(std::memory_order_relaxed));
+    }
+    for (size_t band = 0; band < AudioDSP::EQ_BANDS; ++band) {
+        if (changes & (EQ_BAND_CHANGED << band)) {
+            dsp.setEqBand(band, dspEqDb[band].load(std::memory_order_relaxed));
+        }
+    }
+}
+void MediaPlayer::loadTrackAudio() {
+    const Track* track = trackAt(currentTrackIndex);
+    std::unique_ptr<AudioDecoder> source;
+    if (track != nullptr && !track->filePath.empty()) {
+        source = AudioDecoder::create(track->filePath);
+        if (source && (source->getSampleRate() != AUDIO_SAMPLE_RATE || source->getChannels() > AUDIO_CHANNELS)) {
+            source.reset();
+        }
+        if (!source) {
+            notificationManager->addNotification("Cannot play " + track->filePath, AlertLevel::WARNING);
+        }
+    }
+    
+    std::lock_guard<std::mutex> lock(decoderMutex);
+    // A track left mid-play, or within a crossfade of its end, fades out under the new one;
+    // the source it replaces is freed here, not on the audio thread
+    const bool fade = state == PlayerState::PLAYING && decoder && positionFrames.load() < trackFrames.load();
+    fadingDecoder = fade ? std::move(decoder) : nullptr;
+    fadeFramesRemaining = fade ? CROSSFADE_FRAMES : 0;
+    audioTrack = playlist.at(currentTrackIndex);
+    decoder = std::move(source);
+    if (decoder) {
+        trackFrames.store(decoder->getTotalFrames());
+    } else {
+        // Virtual tracks have no audio; the clock runs over silence for their duration
+        trackFrames.store(track != nullptr ? static_cast<uint64_t>(std::max(track->duration, 0)) * AUDIO_SAMPLE_RATE : 0);
+    }
+    pendingSeek.store(NO_SEEK);
+    // Cleared under the lock, so an end flagged for the previous track cannot leak into this one
+    trackEnded.store(false);
+    positionFrames.store(0, std::memory_order_release);
+}
+size_t MediaPlayer::decodeFrames(AudioDecoder& source, float* out, size_t frames) {
+    const uint16_t channels = source.getChannels();
+    size_t decoded = 0;
+    while (decoded < frames) {
+        const size_t wanted = std::min(frames - decoded, MAX_DECODE_FRAMES);
+        const size_t read = source.read(decodeBuffer.data(), wanted);
+        float* frame = out + decoded * AUDIO_CHANNELS;
+        for (size_t f = 0; f < read; ++f, frame += AUDIO_CHANNELS) {
+            frame[0] = decodeBuffer[f * channels];
+            frame[1] = decodeBuffer[f * channels + (channels > 1 ? 1 : 0)];
+        }
+        decoded += read;
+        if (read < wanted) break;
+    }
+    return decoded;
+}
+void MediaPlayer::mixOutgoingTrack(float* buffer, size_t frames) {
+    size_t mixed = 0;
+    while (mixed < frames && fadeFramesRemaining > 0) {
+        const size_t slice = std::min({frames - mixed, fadeFramesRemaining, MAX_DECODE_FRAMES});
+        const size_t read = decodeFrames(*fadingDecoder, fadeBuffer.data(), slice);
+        std::fill(fadeBuffer.begin() + read * AUDIO_CHANNELS, fadeBuffer.begin() + slice * AUDIO_CHANNELS, 0.0f);
+        const float startMix = 1.0f - static_cast<float>(fadeFramesRemaining) / CROSSFADE_FRAMES;
+        fadeFramesRemaining -= slice;
+        const float endMix = 1.0f - static_cast<float>(fadeFramesRemaining) / CROSSFADE_FRAMES;
+        float* out = buffer + mixed * AUDIO_CHANNELS;
+        AudioDSP::crossfade(fadeBuffer.data(), out, out, slice, AUDIO_CHANNELS, startMix, endMix);
+        mixed += slice;
+    }
+}
+const Track* MediaPlayer::trackAt(size_t position) const {
+    return library.getTrack(playlist.at(position));
+}
+void MediaPlayer::playlistChanged() {
+    if (currentTrackIndex >= playlist.size()) {
+        currentTrackIndex = playlist.empty() ? 0 : playlist.size() - 1;
+    }
+    queue.reset(playlist.size(), currentTrackIndex);
+    if (playlist.at(currentTrackIndex) != audioTrack) {
+        loadTrackAudio();
+    }
+}
+TrackId MediaPlayer::addTrack(const Track& track) {
+    TrackId id = library.addTrack(track);
+    playlist.append(id);
+    queue.setTrackCount(playlist.size());
+    if (playlist.size() == 1) {
+        loadTrackAudio();
+    }
     notificationManager->addNotification("Track added: " + track.title, AlertLevel::INFO);
+    return id;
+}
+size_t MediaPlayer::addScannedTracks(std::vector<Track> scanned) {
+    const size_t scannedCount = scanned.size();
+    const TrackId firstNew = static_cast<TrackId>(library.size());
+    const bool wasEmpty = playlist.size() == 0;
+    library.addScannedTracks(std::move(scanned));
+    // Tracks that were not duplicates got the next IDs in scan order
+    for (TrackId id = firstNew; id < library.size(); ++id) {
+        playlist.append(id);
+    }
+    const size_t added = library.size() - firstNew;
+    queue.setTrackCount(playlist.size());
+    if (wasEmpty && playlist.size() > 0) {
+        loadTrackAudio();
+    }
+    std::cout << "\tScan added " << added << " tracks, skipped " << (scannedCount - added) << " duplicates" << std::endl;
+    return added;
+}
+bool MediaPlayer::insertTrack(size_t position, TrackId id) {
+    if (library.getTrack(id) == nullptr || !playlist.insert(position, {id})) {
+        notificationManager->addNotification("Invalid playlist insert", AlertLevel::WARNING);
+        return false;
+    }
+    if (playlist.size() > 1 && position <= currentTrackIndex) {
+        ++currentTrackIndex;
+    }
+    playlistChanged();
+    return true;
+}
+bool MediaPlayer::moveTrack(size_t from, size_t to) {
+    if (!playlist.move(from, to)) {
+        notificationManager->addNotification("Invalid playlist move", AlertLevel::WARNING);
+        return false;
+    }
+    // Keep the current entry selected wherever it ends up
+    if (from == currentTrackIndex) {
+        currentTrackIndex = to;
+    } else if (from < currentTrackIndex && to >= currentTrackIndex) {
+        --currentTrackIndex;
+    } else if (from > currentTrackIndex && to <= currentTrackIndex) {
+        ++currentTrackIndex;
+    }
+    playlistChanged();
+    return true;
+}
+bool MediaPlayer::removeTrack(size_t position) {
+    if (!playlist.remove(position)) {
+        notificationManager->addNotification("Invalid playlist removal", AlertLevel::WARNING);
+        return false;
+    }
+    if (position < currentTrackIndex) {
+        --currentTrackIndex;
+    }
+    playlistChanged();
+    if (playlist.empty()) {
+        state = PlayerState::STOPPED;
+    }
+    return true;
+}
+size_t MediaPlayer::getPlaylistSize() const {
+    return playlist.size();
+}
+const MediaLibrary& MediaPlayer::getLibrary() const {
+    return library;
+}
+bool MediaPlayer::saveLibrary(const std::string& path) {
+    if (!library.save(path)) {
+        notificationManager->addNotification("Failed to save media library", AlertLevel::WARNING);
+        return false;
+    }
+    return true;
+}
+bool MediaPlayer::loadLibrary(const std::string& path) {
+    const bool loaded = libraryCacheLimit > 0 ? library.openPaged(path, libraryCacheLimit) : library.load(path);
+    if (!loaded) {
+        notificationManager->addNotification("Failed to load media library", AlertLevel::WARNING);
+        return false;
+    }
+    // Playlist IDs referred to the previous library
+    playlist.clear();
+    state = PlayerState::STOPPED;
+    playlistChanged();
+    return true;
+}
+void MediaPlayer::setLibraryCacheLimit(size_t cachedTracks) {
+    libraryCacheLimit = cachedTracks;
+}
+bool MediaPlayer::savePlaylist(const std::string& path) {
+    if (!playlist.save(path)) {
+        notificationManager->addNotification("Failed to save playlist", AlertLevel::WARNING);
+        return false;
+    }
+    return true;
+}
+bool MediaPlayer::loadPlaylist(const std::string& path) {
+    if (!playlist.load(path, library)) {
+        notificationManager->addNotification("Failed to load playlist", AlertLevel::WARNING);
+        return false;
+    }
+    currentTrackIndex = 0;
+    playlistChanged();
+    std::cout << "\tPlaylist loaded with " << playlist.size() << " tracks" << std::endl;
+    return true;
+}
+void MediaPlayer::setArtworkCache(std::shared_ptr<ArtworkCache> cache) {
+    artworkCache = std::move(cache);
+}
+size_t MediaPlayer::scanArtwork() {
+    if (!artworkCache) return 0;
+    size_t added = 0;
+    for (TrackId id = 0; id < library.size(); ++id) {
+        const Track* track = library.getTrack(id);
+        if (track->filePath.empty() || artworkCache->contains(track->filePath)) continue;
+        if (artworkCache->importFromFile(track->filePath)) {
+            ++added;
+        }
+    }
+    if (added > 0) {
+        std::cout << "\tArtwork cached for " << added << " tracks" << std::endl;
+    }
+    return added;
+}
+std::shared_ptr<const Thumbnail> MediaPlayer::getCurrentArtwork() const {
+    const Track* track = getCurrentTrack();
+    if (!artworkCache || track == nullptr || track->filePath.empty()) return nullptr;
+    return artworkCache->get(track->filePath);
+}
+bool MediaPlayer::exportPlaylist(const std::string& path) {
+    if (!playlist.exportM3U8(path, library)) {
+        notificationManager->addNotification("Failed to export playlist", AlertLevel::WARNING);
+        return false;
+    }
+    return true;
+}
+bool MediaPlayer::importPlaylist(const std::string& path) {
+    if (playlist.importM3U8(path, library) == 0) {
+        notificationManager->addNotification("No playable entries in " + path, AlertLevel::WARNING);
+        return false;
+    }
+    currentTrackIndex = 0;
+    playlistChanged();
+    return true;
 }
 void MediaPlayer::play() {
     if (playlist.empty()) {
@@ -25,9 +288,14 @@ void MediaPlayer::play() {
     }
     if (currentTrackIndex >= playlist.size()) {
         currentTrackIndex = 0;
+        queue.reset(playlist.size(), currentTrackIndex);
+    }
+    if (state == PlayerState::STOPPED) {
+        library.recordPlay(playlist.at(currentTrackIndex));
     }
     state = PlayerState::PLAYING;
-    notificationManager->addNotification("Now playing: " + playlist[currentTrackIndex].title, AlertLevel::INFO);
+    applyTrackGain();
+    notificationManager->addNotification("Now playing: " + trackAt(currentTrackIndex)->title, AlertLevel::INFO);
     std::cout << " -> Playing..." << std::endl;
 }
 
@@ -43,42 +311,181 @@ void MediaPlayer::pause() {
 
 void MediaPlayer::stop() {
     state = PlayerState::STOPPED;
-    currentPosition = 0;
+    {
+        // Playing again restarts the track; the rest of a crossfade would be out of place
+        std::lock_guard<std::mutex> lock(decoderMutex);
+        fadeFramesRemaining = 0;
+    }
+    pendingSeek.store(0);
+    positionFrames.store(0, std::memory_order_release);
     std::cout << " [-] Stopped" << std::endl;
 }
 
 void MediaPlayer::nextTrack() {
     if (playlist.empty()) return;
     
-    currentTrackIndex = (currentTrackIndex + 1) % playlist.size();
-    currentPosition = 0;
+    queue.next(false, currentTrackIndex);
+    loadTrackAudio();
+    applyTrackGain();
     
+    if (state == PlayerState::PLAYING) {
+        library.recordPlay(playlist.at(currentTrackIndex));
+    }
     if (state == PlayerState::PLAYING && notificationManager) {
-        notificationManager->addNotification("Skipped to: " + playlist[currentTrackIndex].title, AlertLevel::INFO);
+        notificationManager->addNotification("Skipped to: " + trackAt(currentTrackIndex)->title, AlertLevel::INFO);
     }
     std::cout << "\tNext track" << std::endl;
 }
 
 void MediaPlayer::previousTrack() {
     if (playlist.empty()) return;    
-    currentTrackIndex = (currentTrackIndex - 1 + playlist.size()) % playlist.size();
-    currentPosition = 0;    
+    // At the start of a shuffle session there is nothing earlier; restart the track
+    queue.previous(currentTrackIndex);
+    loadTrackAudio();
+    applyTrackGain();
+    if (state == PlayerState::PLAYING) {
+        library.recordPlay(playlist.at(currentTrackIndex));
+    }
     if (state == PlayerState::PLAYING && notificationManager) {
-        notificationManager->addNotification("Previous track: " + playlist[currentTrackIndex].title, AlertLevel::INFO);
+        notificationManager->addNotification("Previous track: " + trackAt(currentTrackIndex)->title, AlertLevel::INFO);
     }
     std::cout << "\tPrevious track" << std::endl;
 }
 
+void MediaPlayer::setShuffle(bool enabled) {
+    queue.setShuffle(enabled);
+    std::cout << "\tShuffle " << (enabled ? "on" : "off") << std::endl;
+}
+bool MediaPlayer::isShuffleEnabled() const {
+    return queue.isShuffleEnabled();
+}
+void MediaPlayer::setRepeatMode(RepeatMode mode) {
+    queue.setRepeatMode(mode);
+    std::cout << "\tRepeat " << PlaybackQueue::repeatModeToString(mode) << std::endl;
+}
+RepeatMode MediaPlayer::getRepeatMode() const {
+    return queue.getRepeatMode();
+}
+void MediaPlayer::playNext(size_t index) {
+    if (!queue.playNext(index)) {
+        notificationManager->addNotification("Invalid track selection", AlertLevel::WARNING);
+        return;
+    }
+    notificationManager->addNotification("Playing next: " + trackAt(index)->title, AlertLevel::INFO);
+}
+void MediaPlayer::addToQueue(size_t index) {
+    if (!queue.enqueue(index)) {
+        notificationManager->addNotification("Invalid track selection", AlertLevel::WARNING);
+        return;
+    }
+    notificationManager->addNotification("Added to queue: " + trackAt(index)->title, AlertLevel::INFO);
+}
+void MediaPlayer::trackFinished() {
+    if (playlist.empty()) return;
+    if (!queue.next(true, currentTrackIndex)) {
+        state = PlayerState::STOPPED;
+        pendingSeek.store(0);
+        positionFrames.store(0, std::memory_order_release);
+        std::cout << " [-] End of playlist" << std::endl;
+        return;
+    }
+    loadTrackAudio();
+    applyTrackGain();
+    if (state == PlayerState::PLAYING) {
+        library.recordPlay(playlist.at(currentTrackIndex));
+        notificationManager->addNotification("Now playing: " + trackAt(currentTrackIndex)->title, AlertLevel::INFO);
+    }
+}
+bool MediaPlayer::pollTrackEnd() {
+    if (!trackEnded.exchange(false, std::memory_order_acquire)) return false;
+    if (state == PlayerState::PLAYING) {
+        // With nothing to fade into, the last track plays out and is flagged again at its end
+        if (positionFrames.load() < trackFrames.load() && !queue.hasNext()) return false;
+        trackFinished();
+    }
+    return true;
+}
+size_t MediaPlayer::getCurrentTrackIndex() const {
+    return currentTrackIndex;
+}
+
 void MediaPlayer::setVolume(int vol) {
     if (vol < 0) vol = 0;
     if (vol > 100) vol = 100;
     volume = vol;
+    dspVolume.store(volume, std::memory_order_relaxed);
+    publishDspChange(VOLUME_CHANGED);
     std::cout << "\tVolume set to " << volume << "%" << std::endl;
     if (state == PlayerState::PLAYING) {
         std::cout << "\tAdjusting volume while playing..." << std::endl;
     }
     notificationManager->addNotification("Volume set to " + std::to_string(volume) + "%", AlertLevel::INFO);
 }
+void MediaPlayer::setEqualizerBand(size_t band, float gainDb) {
+    if (band >= AudioDSP::EQ_BANDS) {
+        notificationManager->addNotification("Invalid equalizer band", AlertLevel::WARNING);
+        return;
+    }
+    gainDb = std::clamp(gainDb, -AudioDSP::MAX_EQ_GAIN_DB, AudioDSP::MAX_EQ_GAIN_DB);
+    dspEqDb[band].store(gainDb, std::memory_order_relaxed);
+    publishDspChange(EQ_BAND_CHANGED << band);
+    std::cout << "\tEQ " << AudioDSP::eqBandFrequency(band) << " Hz set to "
+              << gainDb << " dB" << std::endl;
+}
+void MediaPlayer::renderAudio(float* buffer, size_t frames) {
+    if (buffer == nullptr || frames == 0) return;
+    std::fill(buffer, buffer + frames * AUDIO_CHANNELS, 0.0f);
+    applyDspChanges();
+    if (state.load(std::memory_order_acquire) != PlayerState::PLAYING) return;
+    
+    // Never wait on the UI thread: if it is swapping tracks, play this block as silence
+    std::unique_lock<std::mutex> lock(decoderMutex, std::try_to_lock);
+    if (lock.owns_lock()) {
+        uint64_t position = positionFrames.load(std::memory_order_relaxed);
+        uint64_t target = pendingSeek.exchange(NO_SEEK);
+        if (target != NO_SEEK) {
+            position = target;
+            if (decoder) decoder->seek(target);
+        }
+        
+        const uint64_t length = trackFrames.load(std::memory_order_relaxed);
+        const uint64_t remaining = length > position ? length - position : 0;
+        size_t played = static_cast<size_t>(std::min<uint64_t>(frames, remaining));
+        if (decoder && played > 0) {
+            played = decodeFrames(*decoder, buffer, played);
+        }
+        if (fadeFramesRemaining > 0) {
+            mixOutgoingTrack(buffer, frames);
+        }
+        positionFrames.store(position + played, std::memory_order_release);
+        // Flagged a crossfade ahead of the end so the next track starts under this one's tail;
+        // a short read means the decoder ran out before its reported length
+        const uint64_t lead = decoder ? std::min<uint64_t>(CROSSFADE_FRAMES, length / 2) : 0;
+        if (length > 0 && (played < frames || position + played + lead >= length)) {
+            trackEnded.store(true, std::memory_order_release);
+        }
+    }
+    // The chain also runs over silence so ramp and filter state stay continuous
+    dsp.process(buffer, frames);
+}
+bool MediaPlayer::seek(double seconds) {
+    if (trackAt(currentTrackIndex) == nullptr) return false;
+    const uint64_t length = trackFrames.load();
+    double frame = std::max(0.0, seconds) * AUDIO_SAMPLE_RATE;
+    uint64_t target = std::min(static_cast<uint64_t>(frame), length);
+    positionFrames.store(target, std::memory_order_release);
+    pendingSeek.store(target);
+    return true;
+}
+double MediaPlayer::getPosition() const {
+    return static_cast<double>(positionFrames.load(std::memory_order_acquire)) / AUDIO_SAMPLE_RATE;
+}
+uint64_t MediaPlayer::getPositionFrames() const {
+    return positionFrames.load(std::memory_order_acquire);
+}
+double MediaPlayer::getTrackLength() const {
+    return static_cast<double>(trackFrames.load()) / AUDIO_SAMPLE_RATE;
+}
 int MediaPlayer::getVolume() const {
     return volume;
 }
@@ -94,16 +501,22 @@ void MediaPlayer::displayCurrentTrack() const {
         std::cout << "\tInvalid track index" << std::endl;
         return;
     }
-    const Track& track = playlist[currentTrackIndex];
+    const Track& track = *trackAt(currentTrackIndex);
     std::cout << "\n         NOW PLAYING        " << std::endl;
     std::cout << "Title: " << track.title << std::endl;
     std::cout << "Artist: " << track.artist << std::endl;
     std::cout << "Album: " << track.album << std::endl;
     std::cout << "Duration: " << track.duration / 60 << ":" 
               << std::setfill('0') << std::setw(2) << track.duration % 60 << std::endl;
+    int position = static_cast<int>(getPosition());
+    std::cout << "Position: " << std::setfill(' ') << position / 60 << ":" 
+              << std::setfill('0') << std::setw(2) << position % 60 << std::setfill(' ') << std::endl;
+    if (auto artwork = getCurrentArtwork()) {
+        std::cout << "Artwork: " << artwork->width << "x" << artwork->height << std::endl;
+    }
     
     std::string stateStr;
-    switch (state) {
+    switch (state.load()) {
         case PlayerState::PLAYING: stateStr = "PLAYING"; break;
         case PlayerState::PAUSED: stateStr = "PAUSED"; break;
         case PlayerState::STOPPED: stateStr = "STOPPED"; break;
@@ -111,6 +524,8 @@ void MediaPlayer::displayCurrentTrack() const {
     }
     std::cout << "Status: " << stateStr << std::endl;
     std::cout << "Volume: " << volume << "%" << std::endl;
+    std::cout << "Shuffle: " << (queue.isShuffleEnabled() ? "ON" : "OFF")
+              << "  Repeat: " << PlaybackQueue::repeatModeToString(queue.getRepeatMode()) << std::endl;
     std::cout << "Track: " << (currentTrackIndex + 1) << "/" << playlist.size() << std::endl;
 }
 
@@ -123,17 +538,35 @@ void MediaPlayer::displayPlaylist() const {
     std::cout << "\n\t=== PLAYLIST ===" << std::endl;
     for (size_t i = 0; i < playlist.size(); ++i) {
         std::string indicator = (i == currentTrackIndex) ? "► " : "  ";
-        std::cout << indicator << (i + 1) << ". " << playlist[i].title 
-                  << " - " << playlist[i].artist << std::endl;
+        const Track* track = trackAt(i);
+        std::cout << indicator << (i + 1) << ". " << track->title 
+                  << " - " << track->artist << std::endl;
+    }
+}
+
+void MediaPlayer::displayStatistics(size_t count) const {
+    const PlayStatistics& statistics = library.getStatistics();
+    std::cout << "\n\t=== MOST PLAYED ===" << std::endl;
+    size_t rank = 1;
+    for (TrackId id : statistics.mostPlayed(count)) {
+        const Track* track = library.getTrack(id);
+        std::cout << "  " << rank++ << ". " << track->title << " - " << track->artist
+                  << " (" << statistics.getPlayCount(id) << " plays)" << std::endl;
+    }
+    std::cout << "\n\t=== RECENTLY PLAYED ===" << std::endl;
+    rank = 1;
+    for (TrackId id : statistics.recentlyPlayed(count)) {
+        const Track* track = library.getTrack(id);
+        std::cout << "  " << rank++ << ". " << track->title << " - " << track->artist << std::endl;
     }
 }
 
 const Track* MediaPlayer::getCurrentTrack() const {
-    if (playlist.empty() || currentTrackIndex >= playlist.size()) return nullptr;
-    return &playlist[currentTrackIndex];
+    return trackAt(currentTrackIndex);
 }
 
 void MediaPlayer::loadDemoPlaylist() {
+    library.clear();
     playlist.clear();
     
     addTrack(Track("Bohemian Rhapsody", "Queen", "A Night at the Opera", 355));
@@ -152,5 +585,6 @@ void MediaPlayer::loadDemoPlaylist() {
     addTrack(Track("Lose Yourself", "Eminem", "8 Mile", 326));
     
     currentTrackIndex = 0;
+    playlistChanged();
     std::cout << "\tDemo playlist loaded with " << playlist.size() << " tracks" << std::endl;
 }
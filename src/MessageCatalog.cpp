@@ -0,0 +1,202 @@
+/**
+ * @file MessageCatalog.cpp
+ * @brief Implementation of the MessageCatalog class
+ */
+
+#include "MessageCatalog.h"
+#include "BinaryIO.h"
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+// magic, version, language count, message count
+const size_t HEADER_BYTES = 16;
+const size_t CHECKSUM_BYTES = 4;
+
+const char* const LANGUAGE_CODES[MessageCatalog::LANGUAGE_COUNT] = {"en", "es", "fr", "de", "ja"};
+
+struct BuiltInMessage {
+    const char* name;       ///< Name used in locale sources
+    const char* english;    ///< Built-in English text
+};
+
+const BuiltInMessage BUILT_IN[MessageCatalog::MESSAGE_COUNT] = {
+    {"GPS_INVALID_COORDINATES", "Invalid GPS coordinates received"},
+    {"GPS_DESTINATION_REACHED", "Destination reached!"},
+    {"GPS_INVALID_DESTINATION", "Invalid destination coordinates"},
+    {"GPS_DESTINATION_SET", "Destination set: {0} ({1})"},
+    {"GPS_NO_DESTINATION", "No destination set for navigation"},
+    {"GPS_SIGNAL_UNAVAILABLE", "GPS signal unavailable - cannot start navigation"},
+    {"GPS_NAVIGATION_STARTED", "Navigation started - Distance: {0} km, ETA: {1} min"},
+    {"GPS_NAVIGATION_STOPPED", "Navigation stopped"},
+    {"GPS_INVALID_WAYPOINT", "Invalid waypoint coordinates"},
+    {"GPS_WAYPOINT_ADDED", "Waypoint added: {0}"},
+    {"GPS_SIGNAL_LOST", "GPS signal lost!"},
+    {"GPS_SIGNAL_RESTORED", "GPS signal restored"},
+    {"ENGINE_OVERHEATING", "Engine overheating! Temperature: {0}°C (Max: {1}°C)"},
+    {"ENGINE_TEMPERATURE_HIGH", "Engine temperature elevated: {0}°C"},
+    {"FUEL_CRITICAL", "CRITICAL: Fuel level extremely low! {0}% remaining"},
+    {"FUEL_LOW", "Low fuel warning: {0}% remaining"},
+    {"SPEED_LIMIT_EXCEEDED", "Speed limit exceeded! Current: {0} km/h (Limit: {1} km/h)"},
+    {"BRAKES_WORN", "Brake system requires attention! Wear level: {0}%"},
+    {"SYSTEM_CHECK_OK", "System check completed - All systems normal"},
+    {"ALERT_CRITICAL_BANNER", "CRITICAL ALERT: {0}"},
+    {"ALERT_WARNING_BANNER", "WARNING: {0}"},
+    {"NOTIFICATIONS_EMPTY", "No notifications."},
+    {"NOTIFICATION_CENTER_TITLE", "=== NOTIFICATION CENTER ==="},
+    {"NOTIFICATIONS_CLEARED", "All notifications cleared."},
+    {"NOTIFICATION_SOUNDS_ON", "Notification sounds enabled"},
+    {"NOTIFICATION_SOUNDS_OFF", "Notification sounds disabled"},
+};
+
+/**
+ * @brief Every language on the built-in English text
+ */
+std::vector<const char*> englishTables() {
+    std::vector<const char*> tables(MessageCatalog::LANGUAGE_COUNT * MessageCatalog::MESSAGE_COUNT);
+    for (size_t i = 0; i < tables.size(); ++i) {
+        tables[i] = BUILT_IN[i % MessageCatalog::MESSAGE_COUNT].english;
+    }
+    return tables;
+}
+} // namespace
+
+MessageCatalog::MessageCatalog() : tables(englishTables()), active(tables.data()), language(0) {}
+
+MessageCatalog& MessageCatalog::instance() {
+    static MessageCatalog catalog;
+    return catalog;
+}
+
+bool MessageCatalog::load(const std::string& path) {
+    auto file = std::make_unique<MappedFile>();
+    if (!file->open(path) || file->size() < HEADER_BYTES + CHECKSUM_BYTES) return false;
+
+    const char* base = reinterpret_cast<const char*>(file->data());
+    const size_t checkedBytes = file->size() - CHECKSUM_BYTES;
+    BinaryReader in(base, checkedBytes);
+    const uint32_t magic = in.u32();
+    const uint32_t version = in.u32();
+    const uint32_t languages = in.u32();
+    const uint32_t messages = in.u32();
+    BinaryReader tail(base + checkedBytes, CHECKSUM_BYTES);
+    if (magic != CATALOG_MAGIC || version != CATALOG_VERSION || tail.u32() != crc32(base, checkedBytes) ||
+        static_cast<uint64_t>(languages) * messages * 4 > in.remaining()) {
+        return false;
+    }
+
+    // Resolve every pair once so lookups never check for gaps; newer files
+    // may carry extra languages or messages, which are ignored
+    std::vector<const char*> resolved = englishTables();
+    const size_t stringsStart = HEADER_BYTES + static_cast<size_t>(languages) * messages * 4;
+    for (uint32_t lang = 0; lang < languages; ++lang) {
+        for (uint32_t msg = 0; msg < messages; ++msg) {
+            const uint32_t offset = in.u32();
+            if (offset == 0) continue;
+            if (offset < stringsStart || offset >= checkedBytes ||
+                std::memchr(base + offset, '\0', checkedBytes - offset) == nullptr) {
+                return false;
+            }
+            if (lang < LANGUAGE_COUNT && msg < MESSAGE_COUNT) {
+                resolved[lang * MESSAGE_COUNT + msg] = base + offset;
+            }
+        }
+    }
+
+    tables = std::move(resolved);
+    mapping = std::move(file);
+    active.store(tables.data() + language.load() * MESSAGE_COUNT, std::memory_order_release);
+    return true;
+}
+
+void MessageCatalog::setLanguage(size_t index) {
+    if (index >= LANGUAGE_COUNT) return;
+    language.store(index);
+    active.store(tables.data() + index * MESSAGE_COUNT, std::memory_order_release);
+}
+
+size_t MessageCatalog::getLanguage() const {
+    return language.load();
+}
+
+const char* MessageCatalog::text(MessageId id) const {
+    return active.load(std::memory_order_acquire)[static_cast<size_t>(id)];
+}
+
+std::string MessageCatalog::format(MessageId id, std::initializer_list<std::string_view> args) const {
+    const char* pattern = text(id);
+    std::string result;
+    result.reserve(std::strlen(pattern) + 16);
+    for (const char* p = pattern; *p != '\0'; ++p) {
+        if (p[0] == '{' && p[1] >= '0' && p[1] <= '9' && p[2] == '}') {
+            const size_t index = static_cast<size_t>(p[1] - '0');
+            if (index < args.size()) {
+                result.append(*(args.begin() + index));
+                p += 2;
+                continue;
+            }
+        }
+        result.push_back(*p);
+    }
+    return result;
+}
+
+const char* MessageCatalog::englishText(MessageId id) {
+    return BUILT_IN[static_cast<size_t>(id)].english;
+}
+
+const char* MessageCatalog::messageName(MessageId id) {
+    return BUILT_IN[static_cast<size_t>(id)].name;
+}
+
+const char* MessageCatalog::languageCode(size_t index) {
+    return index < LANGUAGE_COUNT ? LANGUAGE_CODES[index] : "";
+}
+
+bool MessageCatalog::compile(const std::string& localeDir, const std::string& path) {
+    std::vector<std::string> texts(LANGUAGE_COUNT * MESSAGE_COUNT);
+    for (size_t msg = 0; msg < MESSAGE_COUNT; ++msg) {
+        texts[msg] = BUILT_IN[msg].english;
+    }
+
+    for (size_t lang = 1; lang < LANGUAGE_COUNT; ++lang) {
+        std::string source;
+        if (!readFileContents(localeDir + "/" + LANGUAGE_CODES[lang] + ".txt", source)) continue;
+        std::istringstream lines(source);
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (line.empty() || line[0] == '#') continue;
+            const size_t equals = line.find('=');
+            if (equals == std::string::npos) return false;
+            const std::string name = line.substr(0, equals);
+            size_t msg = 0;
+            while (msg < MESSAGE_COUNT && name != BUILT_IN[msg].name) ++msg;
+            if (msg == MESSAGE_COUNT) return false;
+            texts[lang * MESSAGE_COUNT + msg] = line.substr(equals + 1);
+        }
+    }
+
+    BinaryWriter out;
+    out.u32(CATALOG_MAGIC);
+    out.u32(CATALOG_VERSION);
+    out.u32(static_cast<uint32_t>(LANGUAGE_COUNT));
+    out.u32(static_cast<uint32_t>(MESSAGE_COUNT));
+    size_t offset = HEADER_BYTES + texts.size() * 4;
+    for (const std::string& text : texts) {
+        out.u32(text.empty() ? 0 : static_cast<uint32_t>(offset));
+        if (!text.empty()) offset += text.size() + 1;
+    }
+    for (const std::string& text : texts) {
+        if (!text.empty()) out.bytes(text.c_str(), text.size() + 1);
+    }
+    out.u32(crc32(out.data().data(), out.data().size()));
+    return writeFileContents(path, out.data());
+}
+
+std::string formatFixed(double value, int decimals) {
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(decimals) << value;
+    return text.str();
+}
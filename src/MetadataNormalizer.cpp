@@ -0,0 +1,128 @@
+/**
+ * @file MetadataNormalizer.cpp
+ * @brief Implementation of the MetadataNormalizer class
+ */
+
+#include "MetadataNormalizer.h"
+#include "MediaLibrary.h"
+#include "TaskScheduler.h"
+#include <algorithm>
+
+namespace {
+// Below this many tracks per slice, handing it to another thread costs more than it saves
+const size_t MIN_TRACKS_PER_SLICE = 2048;
+
+const uint64_t FNV_OFFSET = 14695981039346656037ull;
+const uint64_t FNV_PRIME = 1099511628211ull;
+
+char foldChar(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+bool isFeaturing(const std::string& text, size_t begin, size_t end) {
+    static const char* const VARIANTS[] = {"ft", "ft.", "feat", "feat.", "featuring"};
+    const size_t length = end - begin;
+    for (const char* variant : VARIANTS) {
+        size_t i = 0;
+        while (i < length && variant[i] != '\0' && foldChar(text[begin + i]) == variant[i]) ++i;
+        if (i == length && variant[i] == '\0') return true;
+    }
+    return false;
+}
+
+uint64_t hashFolded(uint64_t hash, const std::string& text) {
+    for (char c : text) {
+        hash = (hash ^ static_cast<uint8_t>(foldChar(c))) * FNV_PRIME;
+    }
+    // Separator so ("ab", "c") and ("a", "bc") differ
+    return (hash ^ 0xFF) * FNV_PRIME;
+}
+
+bool equalFolded(const std::string& a, const std::string& b) {
+    return a.size() == b.size() &&
+           std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) { return foldChar(x) == foldChar(y); });
+}
+} // namespace
+
+std::string MetadataNormalizer::normalizeText(const std::string& text) {
+    std::string result;
+    result.reserve(text.size());
+    size_t pos = 0;
+    while (pos < text.size()) {
+        while (pos < text.size() && isSpace(text[pos])) ++pos;
+        if (pos == text.size()) break;
+        size_t end = pos;
+        while (end < text.size() && !isSpace(text[end])) ++end;
+
+        if (!result.empty()) result += ' ';
+        // "(feat. X)" keeps its bracket
+        size_t word = pos;
+        while (word < end && (text[word] == '(' || text[word] == '[')) ++word;
+        result.append(text, pos, word - pos);
+        if (isFeaturing(text, word, end)) {
+            result += "ft.";
+        } else {
+            result.append(text, word, end - word);
+        }
+        pos = end;
+    }
+    return result;
+}
+
+void MetadataNormalizer::normalize(Track& track) {
+    track.title = normalizeText(track.title);
+    track.artist = normalizeText(track.artist);
+    track.album = normalizeText(track.album);
+}
+
+uint64_t MetadataNormalizer::duplicateKey(const Track& track) {
+    uint64_t hash = hashFolded(FNV_OFFSET, track.title);
+    hash = hashFolded(hash, track.artist);
+    const uint32_t duration = static_cast<uint32_t>(track.duration);
+    for (int shift = 0; shift < 32; shift += 8) {
+        hash = (hash ^ ((duration >> shift) & 0xFF)) * FNV_PRIME;
+    }
+    return hash;
+}
+
+bool MetadataNormalizer::sameRecording(const Track& a, const Track& b) {
+    return a.duration == b.duration && equalFolded(a.title, b.title) && equalFolded(a.artist, b.artist);
+}
+
+uint64_t MetadataNormalizer::sortKey(std::string_view text) {
+    uint64_t key = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        key = (key << 8) | (i < text.size() ? static_cast<uint8_t>(foldChar(text[i])) : 0);
+    }
+    return key;
+}
+
+int MetadataNormalizer::compareFolded(std::string_view a, std::string_view b) {
+    const size_t common = std::min(a.size(), b.size());
+    for (size_t i = 0; i < common; ++i) {
+        const uint8_t x = static_cast<uint8_t>(foldChar(a[i]));
+        const uint8_t y = static_cast<uint8_t>(foldChar(b[i]));
+        if (x != y) return x < y ? -1 : 1;
+    }
+    return a.size() == b.size() ? 0 : (a.size() < b.size() ? -1 : 1);
+}
+
+std::vector<uint64_t> MetadataNormalizer::normalizeAll(std::vector<Track>& tracks, unsigned threads) {
+    std::vector<uint64_t> keys(tracks.size());
+    auto worker = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            normalize(tracks[i]);
+            keys[i] = duplicateKey(tracks[i]);
+        }
+    };
+
+    if (threads == 0) threads = TaskScheduler::instance().getConcurrency();
+    // Each piece owns a contiguous slice, so no locking is needed
+    const size_t sliceSize = std::max<size_t>(MIN_TRACKS_PER_SLICE, (tracks.size() + threads - 1) / threads);
+    TaskScheduler::instance().parallelFor(0, tracks.size(), sliceSize, worker, TaskPriority::LOW);
+    return keys;
+}
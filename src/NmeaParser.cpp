@@ -0,0 +1,100 @@
+/**
+ * @file NmeaParser.cpp
+ * @brief Implementation of the NmeaParser class
+ */
+
+#include "NmeaParser.h"
+#include <charconv>
+#include <cstring>
+
+namespace {
+constexpr size_t MAX_FIELDS = 16;
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+bool parseNumber(std::string_view text, double& value) {
+    if (text.empty()) return false;
+    const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+// "ddmm.mmmm" or "dddmm.mmmm" with its hemisphere letter
+bool parseCoordinate(std::string_view text, std::string_view hemisphere, char negative, double& degrees) {
+    double value = 0.0;
+    if (!parseNumber(text, value) || hemisphere.size() != 1) return false;
+    const double whole = static_cast<double>(static_cast<int>(value / 100.0));
+    degrees = whole + (value - whole * 100.0) / 60.0;
+    if (hemisphere[0] == negative) degrees = -degrees;
+    return true;
+}
+} // namespace
+
+bool NmeaParser::checksumValid(std::string_view sentence) {
+    if (sentence.size() < 4 || sentence[0] != '$') return false;
+    const size_t star = sentence.size() - 3;
+    if (sentence[star] != '*') return false;
+    const int high = hexValue(sentence[star + 1]);
+    const int low = hexValue(sentence[star + 2]);
+    if (high < 0 || low < 0) return false;
+    unsigned char sum = 0;
+    for (size_t i = 1; i < star; ++i) sum ^= static_cast<unsigned char>(sentence[i]);
+    return sum == high * 16 + low;
+}
+
+bool NmeaParser::parse(std::string_view sentence, NmeaFix& fix) {
+    fix = NmeaFix{};
+    while (!sentence.empty() && (sentence.back() == ' ' || sentence.back() == '\t')) sentence.remove_suffix(1);
+    if (!checksumValid(sentence)) return false;
+
+    // Split "$TTSSS,f1,f2,...*hh" into fields without copying
+    std::string_view fields[MAX_FIELDS];
+    size_t count = 0;
+    const char* cursor = sentence.data() + 1;
+    const char* const end = sentence.data() + sentence.size() - 3;
+    while (count < MAX_FIELDS) {
+        const char* comma = static_cast<const char*>(std::memchr(cursor, ',', static_cast<size_t>(end - cursor)));
+        const char* fieldEnd = comma != nullptr ? comma : end;
+        fields[count++] = std::string_view(cursor, static_cast<size_t>(fieldEnd - cursor));
+        if (comma == nullptr) break;
+        cursor = comma + 1;
+    }
+    if (fields[0].size() != 5) return false;
+    const std::string_view type = fields[0].substr(2);
+
+    if (type == "RMC") {
+        if (count < 9) return false;
+        // Status 'V' means the receiver has no valid fix
+        if (fields[2] != "A") return true;
+        fix.hasPosition = parseCoordinate(fields[3], fields[4], 'S', fix.latitude) &&
+                          parseCoordinate(fields[5], fields[6], 'W', fix.longitude);
+        double knots = 0.0;
+        if (parseNumber(fields[7], knots)) {
+            fix.hasMotion = true;
+            fix.speedKmh = knots * KNOTS_TO_KMH;
+            if (!parseNumber(fields[8], fix.course)) fix.course = 0.0;
+        }
+        return true;
+    }
+    if (type == "GGA") {
+        if (count < 10) return false;
+        double satellites = 0.0;
+        double hdop = 0.0;
+        if (parseNumber(fields[7], satellites) && parseNumber(fields[8], hdop)) {
+            fix.hasQuality = true;
+            fix.satellites = static_cast<int>(satellites);
+            fix.accuracy = hdop * METERS_PER_HDOP;
+        }
+        // Quality 0 means no fix; the satellite count is still worth reporting
+        if (fields[6].empty() || fields[6] == "0") return true;
+        fix.hasPosition = parseCoordinate(fields[2], fields[3], 'S', fix.latitude) &&
+                          parseCoordinate(fields[4], fields[5], 'W', fix.longitude);
+        fix.hasAltitude = parseNumber(fields[9], fix.altitude);
+        return true;
+    }
+    return false;
+}
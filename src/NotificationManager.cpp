@@ -4,6 +4,7 @@
  */
 
 #include "NotificationManager.h"
+#include "MessageCatalog.h"
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
@@ -11,33 +12,40 @@
 Notification::Notification(const std::string& msg, AlertLevel lvl)
     : message(msg), level(lvl), timestamp(std::chrono::system_clock::now()) {}
 
-NotificationManager::NotificationManager() : soundEnabled(true) {}
+NotificationManager::NotificationManager() : soundEnabled(true), consoleOutput(true), historyLimit(0) {}
 
 void NotificationManager::addNotification(const std::string& message, AlertLevel level) {
     // Basic input sanitization - remove control characters
     std::string sanitizedMessage = message;
     sanitizedMessage.erase(std::remove_if(sanitizedMessage.begin(), sanitizedMessage.end(),
-                          [](char c) { return c < 32 && c != '\t' && c != '\n'; }), sanitizedMessage.end());
+                          [](unsigned char c) { return c < 32 && c != '\t' && c != '\n'; }), sanitizedMessage.end());
     
+    std::lock_guard<std::mutex> lock(mutex);
     notifications.emplace_back(sanitizedMessage, level);    
+    if (historyLimit > 0 && notifications.size() > historyLimit) notifications.pop_front();
+    if (sink) sink(notifications.back());
     // Immediate display for critical alerts
+    if (!consoleOutput) return;
     if (level == AlertLevel::CRITICAL) {
-        std::cout << "\n\t\tCRITICAL ALERT: " << sanitizedMessage << std::endl;
+        std::cout << "\n\t\t" << MessageCatalog::instance().format(MessageId::ALERT_CRITICAL_BANNER, {sanitizedMessage})
+                  << std::endl;
         if (soundEnabled) {
             std::cout << "\t*BEEP BEEP BEEP*" << std::endl;
         }
     } else if (level == AlertLevel::WARNING) {
-        std::cout << "\n\tWARNING: " << sanitizedMessage << std::endl;
+        std::cout << "\n\t" << MessageCatalog::instance().format(MessageId::ALERT_WARNING_BANNER, {sanitizedMessage})
+                  << std::endl;
     }
 }
 
 void NotificationManager::displayNotifications() const {
+    std::lock_guard<std::mutex> lock(mutex);
     if (notifications.empty()) {
-        std::cout << "\tNo notifications." << std::endl;
+        std::cout << "\t" << MessageCatalog::instance().text(MessageId::NOTIFICATIONS_EMPTY) << std::endl;
         return;
     }
     
-    std::cout << "\n\t=== NOTIFICATION CENTER ===" << std::endl;
+    std::cout << "\n\t" << MessageCatalog::instance().text(MessageId::NOTIFICATION_CENTER_TITLE) << std::endl;
     std::cout << std::string(40, '-') << std::endl;
     
     std::stringstream ss;
@@ -62,25 +70,56 @@ void NotificationManager::displayNotifications() const {
 }
 
 void NotificationManager::clearNotifications() {
+    std::lock_guard<std::mutex> lock(mutex);
     notifications.clear();
-    std::cout << "\tAll notifications cleared." << std::endl;
+    if (!consoleOutput) return;
+    std::cout << "\t" << MessageCatalog::instance().text(MessageId::NOTIFICATIONS_CLEARED) << std::endl;
 }
 
 int NotificationManager::getNotificationCount(AlertLevel level) const {
+    std::lock_guard<std::mutex> lock(mutex);
     return std::count_if(notifications.begin(), notifications.end(),
                         [level](const auto& n) { return n.level == level; });
 }
 
 int NotificationManager::getNotificationCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
     return static_cast<int>(notifications.size());
 }
 
+std::string NotificationManager::getLatestMessage() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return notifications.empty() ? std::string() : notifications.back().message;
+}
+
 void NotificationManager::setSoundEnabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex);
     soundEnabled = enabled;
-    std::cout << "\tNotification sounds " << (enabled ? "enabled" : "disabled") << std::endl;
+    if (!consoleOutput) return;
+    std::cout << "\t"
+              << MessageCatalog::instance().text(enabled ? MessageId::NOTIFICATION_SOUNDS_ON
+                                                         : MessageId::NOTIFICATION_SOUNDS_OFF)
+              << std::endl;
+}
+
+void NotificationManager::setConsoleOutput(bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex);
+    consoleOutput = enabled;
+}
+
+void NotificationManager::setHistoryLimit(size_t limit) {
+    std::lock_guard<std::mutex> lock(mutex);
+    historyLimit = limit;
+    while (historyLimit > 0 && notifications.size() > historyLimit) notifications.pop_front();
+}
+
+void NotificationManager::setSink(std::function<void(const Notification&)> callback) {
+    std::lock_guard<std::mutex> lock(mutex);
+    sink = std::move(callback);
 }
 
 bool NotificationManager::hasCriticalAlerts() const {
+    std::lock_guard<std::mutex> lock(mutex);
     return std::any_of(notifications.begin(), notifications.end(),
                       [](const auto& n) { return n.level == AlertLevel::CRITICAL; });
 }
@@ -0,0 +1,145 @@
+/**
+ * @file PlayStatistics.cpp
+ * @brief Implementation of the PlayStatistics class
+ */
+
+#include "PlayStatistics.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+const TrackId NO_TRACK = std::numeric_limits<TrackId>::max();
+} // namespace
+
+PlayStatistics::PlayStatistics() : recentHead(NO_TRACK), recentSize(0) {}
+
+void PlayStatistics::resize(size_t trackCount) {
+    const size_t oldCount = playCounts.size();
+    if (trackCount <= oldCount) return;
+
+    playCounts.resize(trackCount, 0);
+    countPosition.resize(trackCount);
+    recentPrev.resize(trackCount, NO_TRACK);
+    recentNext.resize(trackCount, NO_TRACK);
+    // Zero-play tracks form the last group, so new tracks simply append
+    if (groupStart.count(0) == 0) {
+        groupStart[0] = byCount.size();
+    }
+    for (size_t id = oldCount; id < trackCount; ++id) {
+        countPosition[id] = byCount.size();
+        byCount.push_back(static_cast<TrackId>(id));
+    }
+}
+
+void PlayStatistics::recordPlay(TrackId id) {
+    if (id >= playCounts.size()) return;
+
+    const uint32_t count = playCounts[id];
+    if (count != std::numeric_limits<uint32_t>::max()) {
+        const size_t first = groupStart[count];
+        const size_t position = countPosition[id];
+        const TrackId displaced = byCount[first];
+        std::swap(byCount[first], byCount[position]);
+        countPosition[displaced] = position;
+        countPosition[id] = first;
+
+        // The track now closes the (count + 1) group, which ends right before 'first'
+        if (groupStart.count(count + 1) == 0) {
+            groupStart[count + 1] = first;
+        }
+        if (first + 1 < byCount.size() && playCounts[byCount[first + 1]] == count) {
+            groupStart[count] = first + 1;
+        } else {
+            groupStart.erase(count);
+        }
+        playCounts[id] = count + 1;
+    }
+
+    unlinkRecent(id);
+    pushRecent(id);
+}
+
+void PlayStatistics::unlinkRecent(TrackId id) {
+    const bool linked = recentHead == id || recentPrev[id] != NO_TRACK;
+    if (!linked) return;
+    if (recentPrev[id] != NO_TRACK) recentNext[recentPrev[id]] = recentNext[id];
+    if (recentNext[id] != NO_TRACK) recentPrev[recentNext[id]] = recentPrev[id];
+    if (recentHead == id) recentHead = recentNext[id];
+    recentPrev[id] = recentNext[id] = NO_TRACK;
+    --recentSize;
+}
+
+void PlayStatistics::pushRecent(TrackId id) {
+    recentPrev[id] = NO_TRACK;
+    recentNext[id] = recentHead;
+    if (recentHead != NO_TRACK) recentPrev[recentHead] = id;
+    recentHead = id;
+    ++recentSize;
+}
+
+uint32_t PlayStatistics::getPlayCount(TrackId id) const {
+    return id < playCounts.size() ? playCounts[id] : 0;
+}
+
+std::vector<TrackId> PlayStatistics::mostPlayed(size_t k) const {
+    std::vector<TrackId> result;
+    for (size_t i = 0; i < byCount.size() && result.size() < k && playCounts[byCount[i]] > 0; ++i) {
+        result.push_back(byCount[i]);
+    }
+    return result;
+}
+
+std::vector<TrackId> PlayStatistics::recentlyPlayed(size_t k) const {
+    std::vector<TrackId> result;
+    for (TrackId id = recentHead; id != NO_TRACK && result.size() < k; id = recentNext[id]) {
+        result.push_back(id);
+    }
+    return result;
+}
+
+size_t PlayStatistics::getPlayedCount() const {
+    return recentSize;
+}
+
+const std::vector<uint32_t>& PlayStatistics::getPlayCounts() const {
+    return playCounts;
+}
+
+bool PlayStatistics::restore(const std::vector<uint32_t>& counts, const std::vector<TrackId>& recentFirst) {
+    std::vector<bool> seen(counts.size(), false);
+    for (TrackId id : recentFirst) {
+        if (id >= counts.size() || seen[id]) return false;
+        seen[id] = true;
+    }
+
+    clear();
+    resize(counts.size());
+    playCounts = counts;
+
+    // One sort rebuilds the count index; ties keep library order
+    std::stable_sort(byCount.begin(), byCount.end(),
+                     [this](TrackId a, TrackId b) { return playCounts[a] > playCounts[b]; });
+    groupStart.clear();
+    for (size_t i = 0; i < byCount.size(); ++i) {
+        countPosition[byCount[i]] = i;
+        if (i == 0 || playCounts[byCount[i]] != playCounts[byCount[i - 1]]) {
+            groupStart[playCounts[byCount[i]]] = i;
+        }
+    }
+
+    for (auto it = recentFirst.rbegin(); it != recentFirst.rend(); ++it) {
+        pushRecent(*it);
+    }
+    return true;
+}
+
+void PlayStatistics::clear() {
+    playCounts.clear();
+    byCount.clear();
+    countPosition.clear();
+    groupStart.clear();
+    recentPrev.clear();
+    recentNext.clear();
+    recentHead = NO_TRACK;
+    recentSize = 0;
+}
@@ -0,0 +1,211 @@
+/**
+ * @file PlaybackQueue.cpp
+ * @brief Implementation of the PlaybackQueue class
+ */
+
+#include "PlaybackQueue.h"
+#include <algorithm>
+
+PlaybackQueue::PlaybackQueue(unsigned int seed)
+    : trackCount(0), shuffleEnabled(false), repeatMode(RepeatMode::OFF),
+      historyCursor(0), shufflePosition(0), shuffleChunkPos(0), rng(seed) {
+    shuffleChunk.reserve(SHUFFLE_CHUNK);
+}
+
+void PlaybackQueue::reset(size_t count, size_t startIndex) {
+    trackCount = count;
+    history.clear();
+    upNext.clear();
+    historyCursor = 0;
+    if (count > 0) {
+        history.push_back(std::min(startIndex, count - 1));
+    }
+    restartShuffle(current());
+}
+
+void PlaybackQueue::setTrackCount(size_t count) {
+    // Appended tracks live at permutation slots past shufflePosition, so the
+    // running shuffle cycle picks them up without being regenerated.
+    trackCount = count;
+    if (history.empty() && count > 0) {
+        history.push_back(0);
+        historyCursor = 0;
+    }
+}
+
+void PlaybackQueue::setShuffle(bool enabled) {
+    if (enabled == shuffleEnabled) return;
+    shuffleEnabled = enabled;
+    // Forward history belongs to the old ordering
+    if (!history.empty()) {
+        history.erase(history.begin() + historyCursor + 1, history.end());
+    }
+    if (enabled) {
+        restartShuffle(current());
+    }
+}
+
+bool PlaybackQueue::isShuffleEnabled() const { return shuffleEnabled; }
+void PlaybackQueue::setRepeatMode(RepeatMode mode) { repeatMode = mode; }
+RepeatMode PlaybackQueue::getRepeatMode() const { return repeatMode; }
+size_t PlaybackQueue::getQueueLength() const { return upNext.size(); }
+
+bool PlaybackQueue::playNext(size_t index) {
+    if (index >= trackCount) return false;
+    upNext.push_front(index);
+    return true;
+}
+
+bool PlaybackQueue::enqueue(size_t index) {
+    if (index >= trackCount) return false;
+    upNext.push_back(index);
+    return true;
+}
+
+size_t PlaybackQueue::permutationAt(size_t slot) const {
+    auto it = shuffleSwaps.find(slot);
+    return it != shuffleSwaps.end() ? it->second : slot;
+}
+
+void PlaybackQueue::restartShuffle(size_t first) {
+    shuffleSwaps.clear();
+    shuffleChunk.clear();
+    shuffleChunkPos = 0;
+    shufflePosition = 0;
+    if (first < trackCount) {
+        // Pin the current track to slot 0 so the cycle does not replay it
+        if (first != 0) {
+            shuffleSwaps[first] = 0;
+        }
+        shufflePosition = 1;
+    }
+}
+
+bool PlaybackQueue::refillShuffleChunk() {
+    shuffleChunk.clear();
+    shuffleChunkPos = 0;
+    while (shuffleChunk.size() < SHUFFLE_CHUNK && shufflePosition < trackCount) {
+        std::uniform_int_distribution<size_t> pick(shufflePosition, trackCount - 1);
+        size_t slot = pick(rng);
+        size_t chosen = permutationAt(slot);
+        shuffleSwaps[slot] = permutationAt(shufflePosition);
+        // Consumed slots are never read again
+        if (slot != shufflePosition) {
+            shuffleSwaps.erase(shufflePosition);
+        } else {
+            shuffleSwaps.erase(slot);
+        }
+        shuffleChunk.push_back(chosen);
+        ++shufflePosition;
+    }
+    return !shuffleChunk.empty();
+}
+
+bool PlaybackQueue::drawNext(bool wrap, size_t& index) {
+    if (trackCount == 0) return false;
+
+    if (shuffleEnabled) {
+        if (shuffleChunkPos >= shuffleChunk.size() && !refillShuffleChunk()) {
+            if (!wrap) return false;
+            restartShuffle(current());
+            if (!refillShuffleChunk()) {
+                index = current();  // single-track playlist
+                return true;
+            }
+        }
+        index = shuffleChunk[shuffleChunkPos++];
+        return true;
+    }
+
+    size_t cur = current();
+    if (cur + 1 < trackCount) {
+        index = cur + 1;
+    } else if (wrap) {
+        index = 0;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void PlaybackQueue::pushHistory(size_t index) {
+    if (!history.empty()) {
+        history.erase(history.begin() + historyCursor + 1, history.end());
+    }
+    history.push_back(index);
+    if (history.size() > MAX_HISTORY) {
+        history.pop_front();
+    }
+    historyCursor = history.size() - 1;
+}
+
+bool PlaybackQueue::next(bool automatic, size_t& index) {
+    if (trackCount == 0) return false;
+
+    if (automatic && repeatMode == RepeatMode::ONE) {
+        index = current();
+        return true;
+    }
+
+    if (!upNext.empty()) {
+        index = upNext.front();
+        upNext.pop_front();
+        pushHistory(index);
+        return true;
+    }
+
+    // Re-play forward history left behind by previous()
+    if (historyCursor + 1 < history.size()) {
+        index = history[++historyCursor];
+        return true;
+    }
+
+    bool wrap = !automatic || repeatMode == RepeatMode::ALL;
+    if (!drawNext(wrap, index)) return false;
+    pushHistory(index);
+    return true;
+}
+
+bool PlaybackQueue::hasNext() const {
+    if (trackCount == 0) return false;
+    if (repeatMode != RepeatMode::OFF || !upNext.empty() || historyCursor + 1 < history.size()) return true;
+    if (shuffleEnabled) return shuffleChunkPos < shuffleChunk.size() || shufflePosition < trackCount;
+    return current() + 1 < trackCount;
+}
+
+bool PlaybackQueue::previous(size_t& index) {
+    if (trackCount == 0) return false;
+
+    if (historyCursor > 0) {
+        index = history[--historyCursor];
+        return true;
+    }
+
+    if (shuffleEnabled) {
+        // Nothing earlier in this shuffle session
+        index = current();
+        return false;
+    }
+
+    // Sequential mode: extend history backwards with the preceding track
+    index = (current() + trackCount - 1) % trackCount;
+    history.push_front(index);
+    if (history.size() > MAX_HISTORY) {
+        history.pop_back();
+    }
+    historyCursor = 0;
+    return true;
+}
+
+size_t PlaybackQueue::current() const {
+    return history.empty() ? 0 : history[historyCursor];
+}
+
+const char* PlaybackQueue::repeatModeToString(RepeatMode mode) {
+    switch (mode) {
+        case RepeatMode::OFF: return "OFF";
+        case RepeatMode::ONE: return "ONE";
+        case RepeatMode::ALL: return "ALL";
+        default: return "UNKNOWN";
+    }
+}
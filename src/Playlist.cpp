@@ -0,0 +1,158 @@
+/**
+ * @file Playlist.cpp
+ * @brief Implementation of the Playlist class
+ */
+
+#include "Playlist.h"
+#include "BinaryIO.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace {
+const char LIBRARY_URI_PREFIX[] = "library://";
+} // namespace
+
+Playlist::Playlist(const std::string& playlistName) : name(playlistName) {}
+
+const std::string& Playlist::getName() const { return name; }
+void Playlist::setName(const std::string& playlistName) { name = playlistName; }
+size_t Playlist::size() const { return entries.size(); }
+bool Playlist::empty() const { return entries.empty(); }
+const std::vector<TrackId>& Playlist::getEntries() const { return entries; }
+
+TrackId Playlist::at(size_t position) const {
+    return position < entries.size() ? entries[position] : INVALID_TRACK_ID;
+}
+
+void Playlist::append(TrackId id) {
+    entries.push_back(id);
+}
+
+bool Playlist::insert(size_t position, const std::vector<TrackId>& ids) {
+    if (position > entries.size()) return false;
+    entries.insert(entries.begin() + position, ids.begin(), ids.end());
+    return true;
+}
+
+bool Playlist::remove(size_t position, size_t count) {
+    if (position > entries.size() || count > entries.size() - position) return false;
+    entries.erase(entries.begin() + position, entries.begin() + position + count);
+    return true;
+}
+
+bool Playlist::move(size_t from, size_t to) {
+    if (from >= entries.size() || to >= entries.size()) return false;
+    auto begin = entries.begin();
+    if (from < to) {
+        std::rotate(begin + from, begin + from + 1, begin + to + 1);
+    } else if (from > to) {
+        std::rotate(begin + to, begin + from, begin + from + 1);
+    }
+    return true;
+}
+
+void Playlist::clear() {
+    entries.clear();
+}
+
+bool Playlist::save(const std::string& path) const {
+    BinaryWriter out;
+    out.reserve(16 + name.size() + entries.size() * sizeof(TrackId));
+    out.u32(FILE_MAGIC);
+    out.u32(FILE_VERSION);
+    out.str(name);
+    out.u32(static_cast<uint32_t>(entries.size()));
+    if (isLittleEndianHost()) {
+        out.bytes(entries.data(), entries.size() * sizeof(TrackId));
+    } else {
+        for (TrackId id : entries) out.u32(id);
+    }
+    return writeFileContents(path, out.data());
+}
+
+bool Playlist::load(const std::string& path, const MediaLibrary& library) {
+    std::string contents;
+    if (!readFileContents(path, contents)) return false;
+
+    BinaryReader in(contents.data(), contents.size());
+    if (in.u32() != FILE_MAGIC || in.u32() != FILE_VERSION) return false;
+    std::string loadedName = in.str();
+    uint32_t count = in.u32();
+    if (!in.good() || in.remaining() != static_cast<size_t>(count) * sizeof(TrackId)) return false;
+
+    std::vector<TrackId> loaded(count);
+    if (isLittleEndianHost()) {
+        in.bytes(loaded.data(), loaded.size() * sizeof(TrackId));
+    } else {
+        for (auto& id : loaded) id = in.u32();
+    }
+
+    const size_t librarySize = library.size();
+    if (std::any_of(loaded.begin(), loaded.end(), [librarySize](TrackId id) { return id >= librarySize; })) {
+        return false;
+    }
+
+    name = std::move(loadedName);
+    entries = std::move(loaded);
+    return true;
+}
+
+bool Playlist::exportM3U8(const std::string& path, const MediaLibrary& library) const {
+    std::ostringstream out;
+    out << "#EXTM3U\n";
+    out << "#PLAYLIST:" << name << "\n";
+    for (TrackId id : entries) {
+        const Track* track = library.getTrack(id);
+        if (track == nullptr) continue;
+        out << "#EXTINF:" << track->duration << "," << track->artist << " - " << track->title << "\n";
+        if (track->filePath.empty()) {
+            out << LIBRARY_URI_PREFIX << id << "\n";
+        } else {
+            out << track->filePath << "\n";
+        }
+    }
+    return writeFileContents(path, out.str());
+}
+
+size_t Playlist::importM3U8(const std::string& path, const MediaLibrary& library) {
+    std::ifstream file(path);
+    if (!file) return 0;
+
+    std::string importedName = name;
+    std::vector<TrackId> imported;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+        if (line[0] == '#') {
+            if (line.compare(0, 10, "#PLAYLIST:") == 0) {
+                importedName = line.substr(10);
+            }
+            continue;
+        }
+
+        TrackId id = INVALID_TRACK_ID;
+        const size_t prefixLength = std::strlen(LIBRARY_URI_PREFIX);
+        if (line.compare(0, prefixLength, LIBRARY_URI_PREFIX) == 0) {
+            try {
+                unsigned long value = std::stoul(line.substr(prefixLength));
+                if (value < library.size()) id = static_cast<TrackId>(value);
+            } catch (const std::exception&) {
+                id = INVALID_TRACK_ID;
+            }
+        } else {
+            id = library.findByPath(line);
+        }
+        if (id != INVALID_TRACK_ID) {
+            imported.push_back(id);
+        }
+    }
+
+    if (imported.empty()) return 0;
+
+    name = std::move(importedName);
+    entries = std::move(imported);
+    return entries.size();
+}
@@ -0,0 +1,112 @@
+/**
+ * @file PromptClipCache.cpp
+ * @brief Implementation of the PromptClipCache class
+ */
+
+#include "PromptClipCache.h"
+#include "AudioDSP.h"
+#include "WavDecoder.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+PromptClipCache::PromptClipCache() {
+    offsets.fill(0);
+    lengths.fill(0);
+}
+
+std::string PromptClipCache::promptFileName(VoicePrompt prompt) {
+    switch (prompt) {
+        case VoicePrompt::NAVIGATION_STARTED: return "navigation_started.wav";
+        case VoicePrompt::DESTINATION_REACHED: return "destination_reached.wav";
+        case VoicePrompt::GPS_SIGNAL_LOST: return "gps_signal_lost.wav";
+        case VoicePrompt::GPS_SIGNAL_RESTORED: return "gps_signal_restored.wav";
+        default: return "unknown.wav";
+    }
+}
+
+bool PromptClipCache::readWav(const std::string& path, std::vector<float>& samples) {
+    WavDecoder wav;
+    if (!wav.open(path) || wav.getSampleRate() != AUDIO_SAMPLE_RATE) {
+        return false;
+    }
+    const uint16_t channels = wav.getChannels();
+    std::vector<float> interleaved(static_cast<size_t>(wav.getTotalFrames()) * channels);
+    size_t frames = wav.read(interleaved.data(), static_cast<size_t>(wav.getTotalFrames()));
+
+    samples.assign(frames, 0.0f);
+    for (size_t f = 0; f < frames; ++f) {
+        float sum = 0.0f;
+        for (uint16_t c = 0; c < channels; ++c) {
+            sum += interleaved[f * channels + c];
+        }
+        samples[f] = sum / channels;
+    }
+    return true;
+}
+
+void PromptClipCache::synthesizeChime(VoicePrompt prompt, std::vector<float>& samples) {
+    // Distinct rising/falling two-note chimes stand in for recorded speech
+    static const float NOTES[VOICE_PROMPT_COUNT][2] = {
+        {660.0f, 880.0f},   // navigation started
+        {880.0f, 1320.0f},  // destination reached
+        {880.0f, 440.0f},   // GPS signal lost
+        {440.0f, 880.0f}    // GPS signal restored
+    };
+    const size_t noteFrames = AUDIO_SAMPLE_RATE / 6;
+    const size_t index = static_cast<size_t>(prompt);
+    samples.assign(2 * noteFrames, 0.0f);
+    for (size_t n = 0; n < 2; ++n) {
+        double phaseStep = 2.0 * M_PI * NOTES[index][n] / AUDIO_SAMPLE_RATE;
+        for (size_t i = 0; i < noteFrames; ++i) {
+            // Short fade in/out per note to avoid clicks
+            double edge = std::min(i, noteFrames - 1 - i) / (0.01 * AUDIO_SAMPLE_RATE);
+            double envelope = std::min(1.0, edge);
+            samples[n * noteFrames + i] = static_cast<float>(0.5 * envelope * std::sin(phaseStep * i));
+        }
+    }
+}
+
+void PromptClipCache::store(VoicePrompt prompt, const std::vector<float>& samples) {
+    size_t index = static_cast<size_t>(prompt);
+    offsets[index] = pool.size();
+    lengths[index] = samples.size();
+    pool.insert(pool.end(), samples.begin(), samples.end());
+}
+
+size_t PromptClipCache::preload(const std::string& directory) {
+    pool.clear();
+    offsets.fill(0);
+    lengths.fill(0);
+
+    size_t loadedFromDisk = 0;
+    std::vector<float> samples;
+    for (size_t i = 0; i < VOICE_PROMPT_COUNT; ++i) {
+        VoicePrompt prompt = static_cast<VoicePrompt>(i);
+        samples.clear();
+        if (!directory.empty() && readWav(directory + "/" + promptFileName(prompt), samples) && !samples.empty()) {
+            ++loadedFromDisk;
+        } else {
+            synthesizeChime(prompt, samples);
+        }
+        store(prompt, samples);
+    }
+    pool.shrink_to_fit();
+    return loadedFromDisk;
+}
+
+PromptClip PromptClipCache::get(VoicePrompt prompt) const {
+    size_t index = static_cast<size_t>(prompt);
+    if (index >= VOICE_PROMPT_COUNT || lengths[index] == 0) {
+        return PromptClip{nullptr, 0};
+    }
+    return PromptClip{pool.data() + offsets[index], lengths[index]};
+}
+
+size_t PromptClipCache::getMemoryUsage() const {
+    return pool.capacity() * sizeof(float);
+}
@@ -0,0 +1,39 @@
+/**
+ * @file SeekIndex.cpp
+ * @brief Implementation of the SeekIndex class
+ */
+
+#include "SeekIndex.h"
+#include <algorithm>
+
+SeekIndex::SeekIndex(uint64_t spacingFrames) : spacing(spacingFrames) {}
+
+bool SeekIndex::add(uint64_t frame, uint64_t byteOffset) {
+    if (!points.empty() && frame < points.back().frame + spacing) {
+        return false;
+    }
+    points.push_back(SeekPoint{frame, byteOffset});
+    return true;
+}
+
+const SeekPoint* SeekIndex::find(uint64_t frame) const {
+    auto after = std::upper_bound(points.begin(), points.end(), frame,
+                                  [](uint64_t target, const SeekPoint& point) { return target < point.frame; });
+    return after == points.begin() ? nullptr : &*(after - 1);
+}
+
+size_t SeekIndex::size() const {
+    return points.size();
+}
+
+void SeekIndex::reserve(size_t count) {
+    points.reserve(count);
+}
+
+size_t SeekIndex::capacity() const {
+    return points.capacity();
+}
+
+void SeekIndex::clear() {
+    points.clear();
+}
@@ -0,0 +1,121 @@
+/**
+ * @file SettingsHistory.cpp
+ * @brief Implementation of the SettingsHistory class
+ */
+
+#include "SettingsHistory.h"
+
+SettingsHistory::SettingsHistory() : entries{}, head(0), count(0), cursor(0), nextTransaction(1) {}
+
+SettingsAuditEntry& SettingsHistory::slot(size_t index) {
+    return entries[(head + index) % CAPACITY];
+}
+
+const SettingsAuditEntry& SettingsHistory::slot(size_t index) const {
+    return entries[(head + index) % CAPACITY];
+}
+
+void SettingsHistory::evictOldest() {
+    const uint32_t oldest = slot(0).transaction;
+    while (count > 0 && slot(0).transaction == oldest) {
+        head = (head + 1) % CAPACITY;
+        --count;
+        if (cursor > 0) --cursor;
+    }
+}
+
+void SettingsHistory::record(SettingKeySet changed, const SettingsSnapshot& previous,
+                             const SettingsSnapshot& current, int64_t timestamp) {
+    if (changed == 0) return;
+    count = cursor;
+    const uint32_t transaction = nextTransaction++;
+    for (const SettingSpec& spec : SETTINGS_SCHEMA) {
+        if ((changed & settingBit(spec.key)) == 0) continue;
+        if (count == CAPACITY) evictOldest();
+        slot(count) = SettingsAuditEntry{timestamp, transaction, spec.key, static_cast<uint8_t>(spec.get(previous)),
+                                         static_cast<uint8_t>(spec.get(current))};
+        ++count;
+        cursor = count;
+    }
+}
+
+bool SettingsHistory::undo(SettingsSnapshot& target) {
+    bool applied = false;
+    while (cursor > 0 && !applied) {
+        const uint32_t transaction = slot(cursor - 1).transaction;
+        while (cursor > 0 && slot(cursor - 1).transaction == transaction) {
+            const SettingsAuditEntry& entry = slot(--cursor);
+            const SettingSpec& spec = settingSpec(entry.key);
+            // Changed since without being recorded here; the newer value wins
+            if (spec.get(target) != entry.newValue) continue;
+            spec.set(target, entry.oldValue);
+            applied = true;
+        }
+    }
+    return applied;
+}
+
+bool SettingsHistory::redo(SettingsSnapshot& target) {
+    bool applied = false;
+    while (cursor < count && !applied) {
+        const uint32_t transaction = slot(cursor).transaction;
+        while (cursor < count && slot(cursor).transaction == transaction) {
+            const SettingsAuditEntry& entry = slot(cursor++);
+            const SettingSpec& spec = settingSpec(entry.key);
+            if (spec.get(target) != entry.oldValue) continue;
+            spec.set(target, entry.newValue);
+            applied = true;
+        }
+    }
+    return applied;
+}
+
+bool SettingsHistory::canUndo() const {
+    return cursor > 0;
+}
+
+bool SettingsHistory::canRedo() const {
+    return cursor < count;
+}
+
+size_t SettingsHistory::size() const {
+    return count;
+}
+
+const SettingsAuditEntry& SettingsHistory::at(size_t index) const {
+    return slot(index);
+}
+
+std::vector<SettingsAuditEntry> SettingsHistory::undoableEntries() const {
+    std::vector<SettingsAuditEntry> result;
+    result.reserve(cursor);
+    for (size_t i = 0; i < cursor; ++i) result.push_back(slot(i));
+    return result;
+}
+
+bool SettingsHistory::restore(const std::vector<SettingsAuditEntry>& loaded) {
+    if (loaded.size() > CAPACITY) return false;
+    uint32_t lastTransaction = 0;
+    for (const SettingsAuditEntry& entry : loaded) {
+        if (static_cast<unsigned>(entry.key) >= SETTING_COUNT || entry.transaction < lastTransaction) return false;
+        const SettingSpec& spec = settingSpec(entry.key);
+        if (entry.oldValue < spec.minValue || entry.oldValue > spec.maxValue || entry.newValue < spec.minValue ||
+            entry.newValue > spec.maxValue) {
+            return false;
+        }
+        lastTransaction = entry.transaction;
+    }
+
+    head = 0;
+    count = loaded.size();
+    cursor = count;
+    for (size_t i = 0; i < count; ++i) entries[i] = loaded[i];
+    nextTransaction = lastTransaction + 1;
+    return true;
+}
+
+void SettingsHistory::clear() {
+    head = 0;
+    count = 0;
+    cursor = 0;
+}
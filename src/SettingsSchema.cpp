@@ -0,0 +1,42 @@
+/**
+ * @file SettingsSchema.cpp
+ * @brief Schema-driven helpers for system settings
+ */
+
+#include "SettingsSchema.h"
+
+SettingsSnapshot defaultSettings() {
+    SettingsSnapshot settings{};
+    for (const SettingSpec& spec : SETTINGS_SCHEMA) {
+        spec.set(settings, spec.defaultValue);
+    }
+    return settings;
+}
+
+bool isValidSettings(const SettingsSnapshot& settings) {
+    for (const SettingSpec& spec : SETTINGS_SCHEMA) {
+        const int value = spec.get(settings);
+        if (value < spec.minValue || value > spec.maxValue) return false;
+    }
+    return true;
+}
+
+SettingKeySet diffSettings(const SettingsSnapshot& a, const SettingsSnapshot& b) {
+    SettingKeySet changed = 0;
+    for (const SettingSpec& spec : SETTINGS_SCHEMA) {
+        if (spec.get(a) != spec.get(b)) changed |= settingBit(spec.key);
+    }
+    return changed;
+}
+
+std::string formatSetting(const SettingSpec& spec, int value) {
+    std::string text = spec.prefix;
+    if (spec.type == SettingType::INTEGER) {
+        text += std::to_string(value);
+    } else if (value >= spec.minValue && value <= spec.maxValue) {
+        text += spec.choices[value];
+    } else {
+        text += "Unknown";
+    }
+    return text + spec.suffix;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file SettingsText.cpp
+ * @brief Implementation of the settings text tokenizer
+ */
+
+#include "SettingsText.h"
+#include <charconv>
+#include <cstring>
+
+namespace {
+const std::string_view BYTE_ORDER_MARK = "\xEF\xBB\xBF";
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+// Decimal text of 0-255, so settingValueText never allocates
+struct NumberTable {
+    char digits[256][4];
+    constexpr NumberTable() : digits{} {
+        for (int n = 0; n < 256; ++n) {
+            int i = 0;
+            if (n >= 100) digits[n][i++] = static_cast<char>('0' + n / 100);
+            if (n >= 10) digits[n][i++] = static_cast<char>('0' + n / 10 % 10);
+            digits[n][i] = static_cast<char>('0' + n % 10);
+        }
+    }
+};
+constexpr NumberTable NUMBERS;
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        char x = a[i];
+        char y = b[i];
+        if (x >= 'A' && x <= 'Z') x = static_cast<char>(x - 'A' + 'a');
+        if (y >= 'A' && y <= 'Z') y = static_cast<char>(y - 'A' + 'a');
+        if (x != y) return false;
+    }
+    return true;
+}
+} // namespace
+
+SettingsTextParser::SettingsTextParser(std::string_view input)
+    : text(input), position(0), line(0), error{0, 0, nullptr} {
+    if (text.substr(0, BYTE_ORDER_MARK.size()) == BYTE_ORDER_MARK) position = BYTE_ORDER_MARK.size();
+}
+
+bool SettingsTextParser::next(SettingsTextItem& item) {
+    // Plain pointer scans: the generic find_first_not_of family is several
+    // times slower on these short lines
+    const char* const textEnd = text.data() + text.size();
+    while (!failed() && position < text.size()) {
+        const char* const begin = text.data() + position;
+        const char* newline = static_cast<const char*>(std::memchr(begin, '\n', textEnd - begin));
+        if (newline == nullptr) newline = textEnd;
+        position = static_cast<size_t>(newline - text.data()) + 1;
+        ++line;
+
+        const char* end = newline;
+        if (end > begin && end[-1] == '\r') --end;
+        const char* start = begin;
+        while (start < end && isBlank(*start)) ++start;
+        if (start == end || *start == '#' || *start == ';') continue;
+        while (isBlank(end[-1])) --end;
+        const size_t column = static_cast<size_t>(start - begin) + 1;
+
+        if (*start == '[') {
+            if (end[-1] != ']' || end - start < 2) {
+                fail(line, static_cast<size_t>(end - begin) + 1, "Expected ']' at end of section header");
+                return false;
+            }
+            if (end - start == 2) {
+                fail(line, column + 1, "Empty section name");
+                return false;
+            }
+            item = SettingsTextItem{SettingsTextItemKind::SECTION,
+                                    std::string_view(start + 1, static_cast<size_t>(end - start - 2)), {}, line,
+                                    column + 1, 0};
+            return true;
+        }
+
+        const char* equals = static_cast<const char*>(std::memchr(start, '=', end - start));
+        if (equals == nullptr) {
+            fail(line, column, "Expected 'key = value'");
+            return false;
+        }
+        if (equals == start) {
+            fail(line, column, "Missing key before '='");
+            return false;
+        }
+        const char* keyEnd = equals;
+        while (isBlank(keyEnd[-1])) --keyEnd;
+        const char* value = equals + 1;
+        while (value < end && isBlank(*value)) ++value;
+        if (value == end) {
+            fail(line, static_cast<size_t>(equals - begin) + 2, "Missing value after '='");
+            return false;
+        }
+        item = SettingsTextItem{SettingsTextItemKind::VALUE, std::string_view(start, static_cast<size_t>(keyEnd - start)),
+                                std::string_view(value, static_cast<size_t>(end - value)), line, column,
+                                static_cast<size_t>(value - begin) + 1};
+        return true;
+    }
+    return false;
+}
+
+void SettingsTextParser::fail(size_t atLine, size_t atColumn, const char* message) {
+    if (failed()) return;
+    error = SettingsTextError{atLine, atColumn, message};
+}
+
+bool SettingsTextParser::failed() const {
+    return error.line != 0;
+}
+
+const SettingsTextError& SettingsTextParser::getError() const {
+    return error;
+}
+
+bool parseSettingValue(const SettingSpec& spec, std::string_view text, int& value) {
+    int number = 0;
+    const auto result = std::from_chars(text.data(), text.data() + text.size(), number);
+    if (result.ec == std::errc() && result.ptr == text.data() + text.size()) {
+        if (number < spec.minValue || number > spec.maxValue) return false;
+        value = number;
+        return true;
+    }
+    if (spec.type == SettingType::INTEGER) return false;
+    for (int i = spec.minValue; i <= spec.maxValue; ++i) {
+        if (equalsIgnoreCase(text, spec.choices[i])) {
+            value = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string_view settingValueText(const SettingSpec& spec, int value) {
+    if (value < spec.minValue || value > spec.maxValue) return {};
+    if (spec.type != SettingType::INTEGER) return spec.choices[value];
+    return NUMBERS.digits[value];
+}
@@ -0,0 +1,108 @@
+/**
+ * @file SolarSchedule.cpp
+ * @brief Implementation of the SolarSchedule class
+ */
+
+#include "SolarSchedule.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+const double PI = 3.14159265358979323846;
+const double DEG_TO_RAD = PI / 180.0;
+const int64_t SECONDS_PER_DAY = 86400;
+const double SECONDS_PER_DEGREE = 240.0;    // Earth turns one degree every four minutes
+const double SUNRISE_ZENITH = 90.833;       // Refraction and the sun's radius
+
+/**
+ * @brief Days since 1970-01-01 of 1 January in a year (proleptic Gregorian)
+ */
+int64_t daysToNewYear(int64_t year) {
+    const int64_t y = year - 1;
+    return 365 * (year - 1970) + (y / 4 - y / 100 + y / 400) - (1969 / 4 - 1969 / 100 + 1969 / 400);
+}
+
+/**
+ * @brief Day of the year (1-366) and year length for a day since the epoch
+ */
+void dayOfYear(int64_t day, int& yday, int& yearLength) {
+    int64_t year = 1970 + day / 366;
+    while (daysToNewYear(year + 1) <= day) ++year;
+    while (daysToNewYear(year) > day) --year;
+    yday = static_cast<int>(day - daysToNewYear(year)) + 1;
+    yearLength = static_cast<int>(daysToNewYear(year + 1) - daysToNewYear(year));
+}
+
+int64_t floorDiv(int64_t a, int64_t b) {
+    return a / b - ((a % b != 0) && ((a < 0) != (b < 0)));
+}
+} // namespace
+
+SolarSchedule::SolarSchedule()
+    : cachedDay(0), cachedLatCell(0), cachedLonCell(0), cached{0, 0, false, false}, hasCache(false),
+      computeCount(0) {}
+
+SunTimes SolarSchedule::compute(double latitude, double longitude, int64_t day) {
+    int yday = 1;
+    int yearLength = 365;
+    dayOfYear(day, yday, yearLength);
+
+    // NOAA fractional year, equation of time (minutes) and declination (radians)
+    const double gamma = 2.0 * PI / yearLength * (yday - 1);
+    const double eqTime = 229.18 * (0.000075 + 0.001868 * std::cos(gamma) - 0.032077 * std::sin(gamma) -
+                                    0.014615 * std::cos(2 * gamma) - 0.040849 * std::sin(2 * gamma));
+    const double declination = 0.006918 - 0.399912 * std::cos(gamma) + 0.070257 * std::sin(gamma) -
+                               0.006758 * std::cos(2 * gamma) + 0.000907 * std::sin(2 * gamma) -
+                               0.002697 * std::cos(3 * gamma) + 0.00148 * std::sin(3 * gamma);
+
+    const double lat = latitude * DEG_TO_RAD;
+    const double cosHourAngle = std::cos(SUNRISE_ZENITH * DEG_TO_RAD) / (std::cos(lat) * std::cos(declination)) -
+                                std::tan(lat) * std::tan(declination);
+
+    SunTimes times{0, 0, cosHourAngle < -1.0, cosHourAngle > 1.0};
+    if (times.polarDay || times.polarNight) return times;
+
+    const double hourAngle = std::acos(cosHourAngle) / DEG_TO_RAD;
+    const double sunriseMinutes = 720.0 - 4.0 * (longitude + hourAngle) - eqTime;
+    const double sunsetMinutes = 720.0 - 4.0 * (longitude - hourAngle) - eqTime;
+    times.sunrise = day * SECONDS_PER_DAY + static_cast<int64_t>(std::lround(sunriseMinutes * 60.0));
+    times.sunset = day * SECONDS_PER_DAY + static_cast<int64_t>(std::lround(sunsetMinutes * 60.0));
+    return times;
+}
+
+int64_t SolarSchedule::solarDay(double longitude, int64_t now) {
+    return floorDiv(now + static_cast<int64_t>(longitude * SECONDS_PER_DEGREE), SECONDS_PER_DAY);
+}
+
+const SunTimes& SolarSchedule::sunTimes(double latitude, double longitude, int64_t now) {
+    const int32_t latCell = static_cast<int32_t>(std::floor(latitude / CELL_DEGREES));
+    const int32_t lonCell = static_cast<int32_t>(std::floor(longitude / CELL_DEGREES));
+    const int64_t day = solarDay(longitude, now);
+    if (hasCache && day == cachedDay && latCell == cachedLatCell && lonCell == cachedLonCell) {
+        return cached;
+    }
+
+    // Use the cell center so every position in the cell shares one answer
+    cached = compute((latCell + 0.5) * CELL_DEGREES, (lonCell + 0.5) * CELL_DEGREES, day);
+    cachedDay = day;
+    cachedLatCell = latCell;
+    cachedLonCell = lonCell;
+    hasCache = true;
+    ++computeCount;
+    return cached;
+}
+
+double SolarSchedule::daylightLevel(double latitude, double longitude, int64_t now) {
+    const SunTimes& times = sunTimes(latitude, longitude, now);
+    if (times.polarDay) return 1.0;
+    if (times.polarNight) return 0.0;
+
+    const double ramp = static_cast<double>(TWILIGHT_RAMP_SECONDS);
+    const double dawn = static_cast<double>(now - times.sunrise) / ramp + 0.5;
+    const double dusk = static_cast<double>(times.sunset - now) / ramp + 0.5;
+    return std::clamp(std::min(dawn, dusk), 0.0, 1.0);
+}
+
+uint64_t SolarSchedule::getComputeCount() const {
+    return computeCount;
+}
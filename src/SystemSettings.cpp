@@ -4,186 +4,687 @@
  */
 
 #include "SystemSettings.h"
+#include "BinaryIO.h"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <iomanip>
+#include <iterator>
+
+namespace {
+// magic, version, payload length
+const size_t HEADER_BYTES = 12;
+const size_t CHECKSUM_BYTES = 4;
+
+// Version 1 held one unnamed set of values in a fixed payload
+const uint32_t VERSION_SINGLE = 1;
+// Version 2 had no history after the profiles
+const uint32_t VERSION_PROFILES = 2;
+const size_t SINGLE_PAYLOAD_BYTES = 7;
+const uint8_t FLAG_NIGHT_MODE = 1 << 0;
+const uint8_t FLAG_VOICE_GUIDANCE = 1 << 1;
+const uint8_t FLAG_NOTIFICATION_SOUNDS = 1 << 2;
+
+/**
+ * @brief Store one encoded value through its schema row
+ * @return False if the value is out of range for the setting
+ */
+bool decodeSetting(SettingsSnapshot& s, SettingKey key, uint8_t value) {
+    const SettingSpec& spec = settingSpec(key);
+    if (value < spec.minValue || value > spec.maxValue) return false;
+    spec.set(s, value);
+    return true;
+}
+
+/**
+ * @brief Decode a version 1 payload
+ * @return False if any value is out of range
+ */
+bool decodeSingle(BinaryReader& in, SettingsSnapshot& s) {
+    const uint8_t volume = in.u8();
+    const uint8_t brightness = in.u8();
+    const uint8_t theme = in.u8();
+    const uint8_t language = in.u8();
+    const uint8_t flags = in.u8();
+    const uint8_t hour24 = in.u8();
+    const uint8_t fahrenheit = in.u8();
+    return decodeSetting(s, SettingKey::SYSTEM_VOLUME, volume) &&
+           decodeSetting(s, SettingKey::DISPLAY_BRIGHTNESS, brightness) &&
+           decodeSetting(s, SettingKey::THEME, theme) && decodeSetting(s, SettingKey::LANGUAGE, language) &&
+           flags <= (FLAG_NIGHT_MODE | FLAG_VOICE_GUIDANCE | FLAG_NOTIFICATION_SOUNDS) &&
+           decodeSetting(s, SettingKey::NIGHT_MODE, (flags & FLAG_NIGHT_MODE) != 0) &&
+           decodeSetting(s, SettingKey::VOICE_GUIDANCE, (flags & FLAG_VOICE_GUIDANCE) != 0) &&
+           decodeSetting(s, SettingKey::NOTIFICATION_SOUNDS, (flags & FLAG_NOTIFICATION_SOUNDS) != 0) &&
+           decodeSetting(s, SettingKey::TIME_FORMAT, hour24) &&
+           decodeSetting(s, SettingKey::TEMPERATURE_UNIT, fahrenheit);
+}
+
+const int NIGHT_MODE_MAX_BRIGHTNESS = 30;
+
+// Top-level key of the settings text naming the active profile
+const std::string_view ACTIVE_PROFILE_KEY = "active_profile";
+
+int64_t nowMillis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+const char* const SystemSettings::DEFAULT_PROFILE = "Default";
 
 SystemSettings::SystemSettings(std::shared_ptr<NotificationManager> notifManager)
-    : systemVolume(50), displayBrightness(75), theme(DisplayTheme::AUTO),
-      language(Language::ENGLISH), nightModeEnabled(false), voiceGuidanceEnabled(true),
-      notificationSoundsEnabled(true), timeFormat("12h"), temperatureUnit("C"),
-      notificationManager(notifManager) {}
+    : notificationManager(notifManager), published(nullptr),
+      active(std::make_shared<const SettingsSnapshot>(defaultSettings())), activeProfile(DEFAULT_PROFILE),
+      nextSubscriptionId(1), persistHistory(false) {
+    profiles[activeProfile] = active;
+    published.store(active.get(), std::memory_order_release);
+}
+
+SystemSettings::~SystemSettings() {
+    stopWatching();
+    published.store(nullptr, std::memory_order_release);
+    EpochReclaimer::instance().retire(new std::shared_ptr<const SettingsSnapshot>(std::move(active)));
+}
+
+SettingsView SystemSettings::getSnapshot() const {
+    EpochReclaimer::Guard guard = EpochReclaimer::instance().pin();
+    return SettingsView(std::move(guard), published.load(std::memory_order_acquire));
+}
+
+SettingKeySet SystemSettings::install(std::shared_ptr<const SettingsSnapshot> next) {
+    // Locals keep both snapshots alive while observers run, even if one of
+    // them starts a nested transaction that replaces the new snapshot
+    const std::shared_ptr<const SettingsSnapshot> previous = std::move(active);
+    const std::shared_ptr<const SettingsSnapshot> current = std::move(next);
+    const SettingKeySet changed = diffSettings(*previous, *current);
+    active = current;
+    published.store(current.get(), std::memory_order_release);
+    // Readers may still hold the raw pointer; drop our reference after they leave
+    EpochReclaimer::instance().retire(new std::shared_ptr<const SettingsSnapshot>(previous));
+    if (changed == 0) return 0;
+
+    // Copy so observers can subscribe or unsubscribe while being notified
+    const std::vector<Subscription> observers = subscriptions;
+    const SettingsChange change{changed, *previous, *current};
+    for (const Subscription& subscription : observers) {
+        if ((subscription.keys & changed) != 0) {
+            subscription.observer(change);
+        }
+    }
+    return changed;
+}
+
+SettingKeySet SystemSettings::update(const std::function<void(SettingsSnapshot&)>& edit) {
+    return commit(edit, true);
+}
+
+SettingKeySet SystemSettings::applyAutomatic(const std::function<void(SettingsSnapshot&)>& edit) {
+    return commit(edit, false);
+}
+
+SettingKeySet SystemSettings::commit(const std::function<void(SettingsSnapshot&)>& edit, bool record) {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    auto draft = std::make_shared<SettingsSnapshot>(*active);
+    edit(*draft);
+    for (const SettingSpec& spec : SETTINGS_SCHEMA) {
+        if (spec.type == SettingType::INTEGER) {
+            spec.set(*draft, std::clamp(spec.get(*draft), spec.minValue, spec.maxValue));
+        }
+    }
+    if (!isValidSettings(*draft)) {
+        notificationManager->addNotification("Invalid settings change rejected", AlertLevel::WARNING);
+        return 0;
+    }
+    const SettingKeySet changed = diffSettings(*active, *draft);
+    if (changed == 0) return 0;
+
+    // Recorded before observers run so their own transactions follow this one
+    if (record) history.record(changed, *active, *draft, nowMillis());
+    // Copy-on-write: other profiles sharing the old snapshot keep it
+    profiles[activeProfile] = draft;
+    return install(std::move(draft));
+}
+
+bool SystemSettings::undo() {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    if (!history.canUndo()) return false;
+    bool applied = false;
+    commit([this, &applied](SettingsSnapshot& s) { applied = history.undo(s); }, false);
+    return applied;
+}
+
+bool SystemSettings::redo() {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    if (!history.canRedo()) return false;
+    bool applied = false;
+    commit([this, &applied](SettingsSnapshot& s) { applied = history.redo(s); }, false);
+    return applied;
+}
+
+std::vector<SettingsAuditEntry> SystemSettings::getAuditLog() const {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    std::vector<SettingsAuditEntry> log;
+    log.reserve(history.size());
+    for (size_t i = 0; i < history.size(); ++i) log.push_back(history.at(i));
+    return log;
+}
+
+void SystemSettings::setHistoryPersistence(bool enabled) {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    persistHistory = enabled;
+}
+
+bool SystemSettings::createProfile(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    if (name.empty() || name.size() > MAX_PROFILE_NAME || profiles.count(name) != 0) {
+        notificationManager->addNotification("Cannot create profile '" + name + "'", AlertLevel::WARNING);
+        return false;
+    }
+    profiles.emplace(name, active);
+    return true;
+}
+
+void SystemSettings::selectHistory(const std::string& name) {
+    if (name == activeProfile) return;
+    inactiveHistories[activeProfile] = history;
+    auto saved = inactiveHistories.find(name);
+    if (saved != inactiveHistories.end()) {
+        history = saved->second;
+        inactiveHistories.erase(saved);
+    } else {
+        history.clear();
+    }
+}
+
+bool SystemSettings::switchProfile(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    auto it = profiles.find(name);
+    if (it == profiles.end()) {
+        notificationManager->addNotification("Unknown profile '" + name + "'", AlertLevel::WARNING);
+        return false;
+    }
+    selectHistory(it->first);
+    activeProfile = it->first;
+    if (it->second != active) install(it->second);
+    return true;
+}
+
+bool SystemSettings::deleteProfile(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    if (name == activeProfile) return false;
+    inactiveHistories.erase(name);
+    return profiles.erase(name) != 0;
+}
+
+std::string SystemSettings::getActiveProfile() const {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    return activeProfile;
+}
+
+std::vector<std::string> SystemSettings::getProfileNames() const {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    std::vector<std::string> names;
+    names.reserve(profiles.size());
+    for (const auto& entry : profiles) names.push_back(entry.first);
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+SystemSettings::SubscriptionId SystemSettings::subscribe(std::initializer_list<SettingKey> keys,
+                                                         SettingsObserver observer) {
+    SettingKeySet mask = 0;
+    for (SettingKey key : keys) mask |= settingBit(key);
+
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    const SubscriptionId id = nextSubscriptionId++;
+    subscriptions.push_back(Subscription{id, mask, std::move(observer)});
+    return id;
+}
+
+bool SystemSettings::unsubscribe(SubscriptionId id) {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    auto it = std::find_if(subscriptions.begin(), subscriptions.end(),
+                           [id](const Subscription& subscription) { return subscription.id == id; });
+    if (it == subscriptions.end()) return false;
+    subscriptions.erase(it);
+    return true;
+}
+
+bool SystemSettings::setValue(SettingKey key, int value) {
+    const SettingSpec& spec = settingSpec(key);
+    if (spec.type == SettingType::INTEGER) {
+        value = std::clamp(value, spec.minValue, spec.maxValue);
+    } else if (value < spec.minValue || value > spec.maxValue) {
+        notificationManager->addNotification("Invalid value for " + std::string(spec.label), AlertLevel::WARNING);
+        return false;
+    }
+
+    update([&spec, value](SettingsSnapshot& s) { spec.set(s, value); });
+    const std::string text = formatSetting(spec, value);
+    std::cout << "\t" << spec.label << " set to " << text << std::endl;
+    if (spec.announce) {
+        notificationManager->addNotification(std::string(spec.label) + " changed to " + text, AlertLevel::INFO);
+    }
+    return true;
+}
+
+int SystemSettings::getValue(SettingKey key) const {
+    return settingSpec(key).get(*getSnapshot());
+}
 
 void SystemSettings::setSystemVolume(int volume) {
-    if (volume < 0) volume = 0;
-    if (volume > 100) volume = 100;
-    
-    systemVolume = volume;
-    std::cout << "\tSystem volume set to " << volume << "%" << std::endl;
-    
-    if (volume == 0) {
+    setValue(SettingKey::SYSTEM_VOLUME, volume);
+    if (volume <= 0) {
         notificationManager->addNotification("System muted", AlertLevel::INFO);
     }
 }
 int SystemSettings::getSystemVolume() const {
-    return systemVolume;
+    return getSnapshot()->systemVolume;
 }
 void SystemSettings::setDisplayBrightness(int brightness) {
-    if (brightness < 0) brightness = 0;
-    if (brightness > 100) brightness = 100;
-    
-    displayBrightness = brightness;
-    std::cout << "\tDisplay brightness set to " << brightness << "%" << std::endl;
-    
+    setValue(SettingKey::DISPLAY_BRIGHTNESS, brightness);
     if (brightness < 20) {
         notificationManager->addNotification("Low brightness - may affect visibility", AlertLevel::WARNING);
     }
 }
 int SystemSettings::getDisplayBrightness() const {
-    return displayBrightness;
+    return getSnapshot()->displayBrightness;
 }
 void SystemSettings::setDisplayTheme(DisplayTheme newTheme) {
-    theme = newTheme;
-    std::cout << "\tDisplay theme changed to: " << themeToString(newTheme) << std::endl;
-    notificationManager->addNotification("Theme changed to " + themeToString(newTheme), AlertLevel::INFO);
+    setValue(SettingKey::THEME, static_cast<int>(newTheme));
 }
 DisplayTheme SystemSettings::getDisplayTheme() const {
-    return theme;
+    return getSnapshot()->theme;
 }
 void SystemSettings::setLanguage(Language lang) {
-    language = lang;
-    std::cout << "\tLanguage changed to: " << languageToString(lang) << std::endl;
-    notificationManager->addNotification("Language changed to " + languageToString(lang), AlertLevel::INFO);
+    setValue(SettingKey::LANGUAGE, static_cast<int>(lang));
 }
-
 Language SystemSettings::getLanguage() const {
-    return language;
+    return getSnapshot()->language;
 }
 void SystemSettings::setNightMode(bool enabled) {
-    nightModeEnabled = enabled;
-    std::cout << "\tNight mode " << (enabled ? "enabled" : "disabled") << std::endl;
-    
-    if (enabled) {
-        // Automatically adjust brightness for night mode
-        if (displayBrightness > 30) {
-            setDisplayBrightness(30);
-            notificationManager->addNotification("Brightness auto-adjusted for night mode", AlertLevel::INFO);
+    const SettingKeySet changed = update([enabled](SettingsSnapshot& s) {
+        s.nightModeEnabled = enabled;
+        // Dim the display in the same transaction so observers see one change
+        if (enabled && s.displayBrightness > NIGHT_MODE_MAX_BRIGHTNESS) {
+            s.displayBrightness = NIGHT_MODE_MAX_BRIGHTNESS;
         }
+    });
+    const SettingSpec& nightMode = settingSpec(SettingKey::NIGHT_MODE);
+    std::cout << "\t" << nightMode.label << " set to " << formatSetting(nightMode, enabled) << std::endl;
+    
+    if (changed & settingBit(SettingKey::DISPLAY_BRIGHTNESS)) {
+        const SettingSpec& brightness = settingSpec(SettingKey::DISPLAY_BRIGHTNESS);
+        std::cout << "\t" << brightness.label << " set to " << formatSetting(brightness, NIGHT_MODE_MAX_BRIGHTNESS)
+                  << std::endl;
+        notificationManager->addNotification("Brightness auto-adjusted for night mode", AlertLevel::INFO);
     }
 }
 bool SystemSettings::isNightModeEnabled() const {
-    return nightModeEnabled;
+    return getSnapshot()->nightModeEnabled;
 }
 void SystemSettings::setVoiceGuidance(bool enabled) {
-    voiceGuidanceEnabled = enabled;
-    std::cout << "\tVoice guidance " << (enabled ? "enabled" : "disabled") << std::endl;
+    setValue(SettingKey::VOICE_GUIDANCE, enabled);
 }
 bool SystemSettings::isVoiceGuidanceEnabled() const {
-    return voiceGuidanceEnabled;
+    return getSnapshot()->voiceGuidanceEnabled;
 }
 void SystemSettings::setNotificationSounds(bool enabled) {
-    notificationSoundsEnabled = enabled;
-    notificationManager->setSoundEnabled(enabled);
-    std::cout << "\tNotification sounds " << (enabled ? "enabled" : "disabled") << std::endl;
+    setValue(SettingKey::NOTIFICATION_SOUNDS, enabled);
 }
 bool SystemSettings::areNotificationSoundsEnabled() const {
-    return notificationSoundsEnabled;
+    return getSnapshot()->notificationSoundsEnabled;
 }
 void SystemSettings::setTimeFormat(const std::string& format) {
-    if (format == "12h" || format == "24h") {
-        timeFormat = format;
-        std::cout << "\tTime format set to: " << format << std::endl;
-    } else {
-        notificationManager->addNotification("Invalid time format. Use '12h' or '24h'", AlertLevel::WARNING);
-    }
+    setValue(SettingKey::TIME_FORMAT, choiceIndex(TIME_FORMAT_NAMES, format));
 }
 
 std::string SystemSettings::getTimeFormat() const {
-    return timeFormat;
+    return getSnapshot()->timeFormat;
 }
 
 void SystemSettings::setTemperatureUnit(const std::string& unit) {
-    if (unit == "C" || unit == "F") {
-        temperatureUnit = unit;
-        std::cout << "\tTemperature unit set to: °" << unit << std::endl;
-    } else {
-        notificationManager->addNotification("Invalid temperature unit. Use 'C' or 'F'", AlertLevel::WARNING);
-    }
+    setValue(SettingKey::TEMPERATURE_UNIT, choiceIndex(TEMPERATURE_UNIT_NAMES, unit));
 }
 
 std::string SystemSettings::getTemperatureUnit() const {
-    return temperatureUnit;
+    return getSnapshot()->temperatureUnit;
 }
 
 void SystemSettings::displaySettings() const {
+    const SettingsView view = getSnapshot();
+    const std::pair<SettingGroup, const char*> groups[] = {
+        {SettingGroup::AUDIO, "Audio Settings"},
+        {SettingGroup::DISPLAY, "Display Settings"},
+        {SettingGroup::SYSTEM, "System Settings"},
+    };
+    
     std::cout << "\n\t=== SYSTEM SETTINGS ===" << std::endl;
     std::cout << std::string(35, '=') << std::endl;
-    
-    // Audio Settings
-    std::cout << " Audio Settings:" << std::endl;
-    std::cout << "   System Volume: " << systemVolume << "%" << std::endl;
-    std::cout << "   Notification Sounds: " << (notificationSoundsEnabled ? "ON" : "OFF") << std::endl;
-    std::cout << "   Voice Guidance: " << (voiceGuidanceEnabled ? "ON" : "OFF") << std::endl;
-    
-    // Display Settings
-    std::cout << "\n Display Settings:" << std::endl;
-    std::cout << "   Brightness: " << displayBrightness << "%" << std::endl;
-    std::cout << "   Theme: " << themeToString(theme) << std::endl;
-    std::cout << "   Night Mode: " << (nightModeEnabled ? "ON" : "OFF") << std::endl;
-    
-    // System Settings
-    std::cout << "\n System Settings:" << std::endl;
-    std::cout << "   Language: " << languageToString(language) << std::endl;
-    std::cout << "   Time Format: " << timeFormat << std::endl;
-    std::cout << "   Temperature Unit: °" << temperatureUnit << std::endl;
-    
+    for (const auto& group : groups) {
+        std::cout << (group.first == SettingGroup::AUDIO ? " " : "\n ") << group.second << ":" << std::endl;
+        for (const SettingSpec& spec : SETTINGS_SCHEMA) {
+            if (spec.group == group.first) {
+                std::cout << "   " << spec.label << ": " << formatSetting(spec, spec.get(*view)) << std::endl;
+            }
+        }
+    }
     std::cout << std::string(35, '=') << std::endl;
 }
 
+void SystemSettings::applyDefaults() {
+    update([](SettingsSnapshot& s) { s = defaultSettings(); });
+}
+
 void SystemSettings::resetToDefaults() {
-    systemVolume = 50;
-    displayBrightness = 75;
-    theme = DisplayTheme::AUTO;
-    language = Language::ENGLISH;
-    nightModeEnabled = false;
-    voiceGuidanceEnabled = true;
-    notificationSoundsEnabled = true;
-    timeFormat = "12h";
-    temperatureUnit = "C";
+    applyDefaults();
     
     std::cout << "\tSettings reset to defaults" << std::endl;
     notificationManager->addNotification("All settings reset to defaults", AlertLevel::INFO);
 }
 
-void SystemSettings::saveSettings() {
-    // Simulate saving to file
+bool SystemSettings::saveSettings(const std::string& path) {
+    BinaryWriter out;
+    {
+        std::lock_guard<std::recursive_mutex> lock(writeMutex);
+        const SettingsSnapshot base = defaultSettings();
+        const std::vector<std::string> names = getProfileNames();
+        uint32_t activeIndex = 0;
+        BinaryWriter payload;
+        payload.u32(static_cast<uint32_t>(names.size()));
+        for (size_t i = 0; i < names.size(); ++i) {
+            if (names[i] == activeProfile) activeIndex = static_cast<uint32_t>(i);
+        }
+        payload.u32(activeIndex);
+        for (const std::string& name : names) {
+            // Only values that differ from the defaults are stored
+            const SettingsSnapshot& values = *profiles.at(name);
+            const SettingKeySet overrides = diffSettings(base, values);
+            payload.str(name);
+            payload.u16(static_cast<uint16_t>(overrides));
+            for (unsigned k = 0; k < SETTING_COUNT; ++k) {
+                if (overrides & settingBit(static_cast<SettingKey>(k))) {
+                    payload.u8(static_cast<uint8_t>(SETTINGS_SCHEMA[k].get(values)));
+                }
+            }
+        }
+        const std::vector<SettingsAuditEntry> saved =
+            persistHistory ? history.undoableEntries() : std::vector<SettingsAuditEntry>();
+        payload.u32(static_cast<uint32_t>(saved.size()));
+        for (const SettingsAuditEntry& entry : saved) {
+            payload.u64(static_cast<uint64_t>(entry.timestamp));
+            payload.u32(entry.transaction);
+            payload.u8(static_cast<uint8_t>(entry.key));
+            payload.u8(entry.oldValue);
+            payload.u8(entry.newValue);
+        }
+        out.reserve(HEADER_BYTES + payload.data().size() + CHECKSUM_BYTES);
+        out.u32(SETTINGS_MAGIC);
+        out.u32(SETTINGS_VERSION);
+        out.u32(static_cast<uint32_t>(payload.data().size()));
+        out.bytes(payload.data().data(), payload.data().size());
+    }
+    out.u32(crc32(out.data().data(), out.data().size()));
+
+    if (!writeFileContents(path, out.data(), true)) {
+        notificationManager->addNotification("Failed to save settings", AlertLevel::WARNING);
+        return false;
+    }
     std::cout << "\tSettings saved successfully" << std::endl;
-    notificationManager->addNotification("Settings saved", AlertLevel::INFO);
+    return true;
 }
 
-void SystemSettings::loadSettings() {
-    // Simulate loading from file
-    std::cout << "\tSettings loaded successfully" << std::endl;
-    notificationManager->addNotification("Settings loaded", AlertLevel::INFO);
+bool SystemSettings::parseSettings(const std::string& contents, ProfileMap& loaded, std::string& loadedActive,
+                                   SettingsHistory& loadedHistory) {
+    const bool framed = contents.size() >= HEADER_BYTES + CHECKSUM_BYTES;
+    const size_t checkedBytes = framed ? contents.size() - CHECKSUM_BYTES : 0;
+    BinaryReader in(contents.data(), checkedBytes);
+    const uint32_t magic = in.u32();
+    const uint32_t version = in.u32();
+    const uint32_t payloadSize = in.u32();
+    BinaryReader tail(contents.data() + checkedBytes, contents.size() - checkedBytes);
+    const uint32_t checksum = tail.u32();
+    bool valid = framed && in.good() && magic == SETTINGS_MAGIC && payloadSize == in.remaining() &&
+                 checksum == crc32(contents.data(), checkedBytes);
+
+    if (valid && version == VERSION_SINGLE) {
+        SettingsSnapshot values = defaultSettings();
+        valid = payloadSize == SINGLE_PAYLOAD_BYTES && decodeSingle(in, values);
+        loadedActive = DEFAULT_PROFILE;
+        loaded[loadedActive] = std::make_shared<const SettingsSnapshot>(values);
+    } else if (valid && (version == VERSION_PROFILES || version == SETTINGS_VERSION)) {
+        // Profiles left at the defaults share one snapshot
+        const auto base = std::make_shared<const SettingsSnapshot>(defaultSettings());
+        const uint32_t count = in.u32();
+        const uint32_t activeIndex = in.u32();
+        valid = count > 0 && activeIndex < count;
+        for (uint32_t i = 0; valid && i < count; ++i) {
+            const std::string name = in.str();
+            const SettingKeySet overrides = in.u16();
+            valid = in.good() && !name.empty() && name.size() <= MAX_PROFILE_NAME &&
+                    overrides < settingBit(static_cast<SettingKey>(SETTING_COUNT)) && loaded.count(name) == 0;
+            SettingsSnapshot values = *base;
+            for (unsigned k = 0; valid && k < SETTING_COUNT; ++k) {
+                if (overrides & settingBit(static_cast<SettingKey>(k))) {
+                    valid = decodeSetting(values, static_cast<SettingKey>(k), in.u8());
+                }
+            }
+            if (!valid) break;
+            loaded[name] = overrides == 0 ? base : std::make_shared<const SettingsSnapshot>(values);
+            if (i == activeIndex) loadedActive = name;
+        }
+        if (valid && version == SETTINGS_VERSION) {
+            const uint32_t entryCount = in.u32();
+            valid = entryCount <= SettingsHistory::CAPACITY;
+            std::vector<SettingsAuditEntry> entries;
+            for (uint32_t i = 0; valid && i < entryCount; ++i) {
+                SettingsAuditEntry entry{};
+                entry.timestamp = static_cast<int64_t>(in.u64());
+                entry.transaction = in.u32();
+                entry.key = static_cast<SettingKey>(in.u8());
+                entry.oldValue = in.u8();
+                entry.newValue = in.u8();
+                entries.push_back(entry);
+            }
+            valid = valid && in.good() && loadedHistory.restore(entries);
+        }
+    } else {
+        valid = false;
+    }
+    return valid && in.good() && in.remaining() == 0;
 }
 
-std::string SystemSettings::themeToString(DisplayTheme theme) {
-    switch (theme) {
-        case DisplayTheme::LIGHT: return "Light";
-        case DisplayTheme::DARK: return "Dark";
-        case DisplayTheme::AUTO: return "Auto";
-        default: return "Unknown";
+void SystemSettings::applyProfiles(ProfileMap&& loaded, const std::string& loadedActive) {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    auto replaced = profiles.find(loadedActive);
+    const std::shared_ptr<const SettingsSnapshot> before = replaced != profiles.end() ? replaced->second : nullptr;
+    profiles = std::move(loaded);
+    selectHistory(loadedActive);
+    activeProfile = loadedActive;
+    // Histories of profiles the new set no longer has would never be used
+    for (auto it = inactiveHistories.begin(); it != inactiveHistories.end();) {
+        it = profiles.count(it->first) != 0 ? std::next(it) : inactiveHistories.erase(it);
     }
+    // The replacement is a transaction of its own, so it is audited and undo
+    // steps back to the replaced values rather than past them
+    const std::shared_ptr<const SettingsSnapshot>& after = profiles.at(activeProfile);
+    if (before) history.record(diffSettings(*before, *after), *before, *after, nowMillis());
+    install(after);
 }
 
-std::string SystemSettings::languageToString(Language lang) {
-    switch (lang) {
-        case Language::ENGLISH: return "English";
+bool SystemSettings::loadSettings(const std::string& path) {
+    std::string contents;
+    if (!readFileContents(path, contents)) return false;
+
+    ProfileMap loaded;
+    std::string loadedActive;
+    SettingsHistory loadedHistory;
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    if (!parseSettings(contents, loaded, loadedActive, loadedHistory)) {
+        ProfileMap fallback;
+        fallback[DEFAULT_PROFILE] = std::make_shared<const SettingsSnapshot>(defaultSettings());
+        applyProfiles(std::move(fallback), DEFAULT_PROFILE);
+        inactiveHistories.clear();
+        history.clear();
+        notificationManager->addNotification("Settings file damaged - defaults restored", AlertLevel::WARNING);
+        return false;
+    }
+    applyProfiles(std::move(loaded), loadedActive);
+    // The saved history belongs to the profile that was active when it was saved
+    inactiveHistories.clear();
+    history = loadedHistory;
+    return true;
+}
+
+bool SystemSettings::reloadSettings(const std::string& path) {
+    std::string contents;
+    ProfileMap loaded;
+    std::string loadedActive;
+    // The pushed file's history is ignored; edits made here stay undoable
+    SettingsHistory pushedHistory;
+    if (!readFileContents(path, contents) || !parseSettings(contents, loaded, loadedActive, pushedHistory)) {
+        notificationManager->addNotification("Pushed settings file rejected", AlertLevel::WARNING);
+        return false;
+    }
+    applyProfiles(std::move(loaded), loadedActive);
+    return true;
+}
+
+bool SystemSettings::parseSettingsText(std::string_view text, ProfileMap& loaded, std::string& loadedActive,
+                                       SettingsTextError& error) {
+    // Profiles left at the defaults share one snapshot, as in parseSettings
+    const auto base = std::make_shared<const SettingsSnapshot>(defaultSettings());
+    SettingsTextParser parser(text);
+    SettingsTextItem item{};
+    SettingsTextItem activeItem{};
+    std::string section;
+    std::string firstSection;
+    SettingsSnapshot values = *base;
+    auto finishSection = [&] {
+        if (section.empty()) return;
+        loaded[section] = diffSettings(*base, values) == 0 ? base : std::make_shared<const SettingsSnapshot>(values);
+    };
+
+    while (parser.next(item)) {
+        if (item.kind == SettingsTextItemKind::SECTION) {
+            finishSection();
+            if (item.name.size() > MAX_PROFILE_NAME) {
+                parser.fail(item.line, item.column, "Profile name too long");
+            } else if (loaded.count(section.assign(item.name)) != 0) {
+                parser.fail(item.line, item.column, "Duplicate profile");
+            }
+            if (firstSection.empty()) firstSection = section;
+            values = *base;
+        } else if (section.empty()) {
+            if (item.name != ACTIVE_PROFILE_KEY) {
+                parser.fail(item.line, item.column, "Unknown key outside a profile");
+            }
+            activeItem = item;
+        } else {
+            const SettingSpec* spec = findSetting(item.name);
+            int value = 0;
+            if (spec == nullptr) {
+                parser.fail(item.line, item.column, "Unknown setting");
+            } else if (!parseSettingValue(*spec, item.value, value)) {
+                parser.fail(item.line, item.valueColumn, "Invalid value for setting");
+            } else {
+                spec->set(values, value);
+            }
+        }
+    }
+    if (parser.failed()) {
+        error = parser.getError();
+        return false;
+    }
+    finishSection();
+
+    if (loaded.empty()) {
+        error = SettingsTextError{1, 1, "No profile sections"};
+        return false;
+    }
+    if (activeItem.line == 0) {
+        loadedActive = firstSection;
+    } else if (loaded.count(loadedActive.assign(activeItem.value)) == 0) {
+        error = SettingsTextError{activeItem.line, activeItem.valueColumn, "Unknown active profile"};
+        return false;
+    }
+    return true;
+}
 
-        case Language::SPANISH: return "Español";
-        case Language::FRENCH: return "Français";
-        case Language::GERMAN: return "Deutsch";
-        case Language::JAPANESE: return "日本語";
+bool SystemSettings::exportSettingsText(std::string& text) const {
+    std::lock_guard<std::recursive_mutex> lock(writeMutex);
+    if (activeProfile.find_first_of("\r\n") != std::string::npos || activeProfile.front() == ' ' ||
+        activeProfile.front() == '\t' || activeProfile.back() == ' ' || activeProfile.back() == '\t') {
+        return false;
+    }
+    text = "# Vehicle system settings\n"
+           "# One [section] per driver profile; settings left out take their defaults.\n";
+    text.append(ACTIVE_PROFILE_KEY).append(" = ").append(activeProfile).append("\n");
+    for (const std::string& name : getProfileNames()) {
+        if (name.find_first_of("\r\n") != std::string::npos) return false;
+        const SettingsSnapshot& values = *profiles.at(name);
+        text.append("\n[").append(name).append("]\n");
+        for (const SettingSpec& spec : SETTINGS_SCHEMA) {
+            text.append(spec.id).append(" = ").append(settingValueText(spec, spec.get(values))).append("\n");
+        }
+    }
+    return true;
+}
 
-        default: return "Unknown";
+bool SystemSettings::exportSettings(const std::string& path) const {
+    std::string text;
+    if (!exportSettingsText(text) || !writeFileContents(path, text)) {
+        notificationManager->addNotification("Failed to export settings", AlertLevel::WARNING);
+        return false;
     }
+    std::cout << "\tSettings exported to " << path << std::endl;
+    return true;
+}
+
+bool SystemSettings::importSettingsText(std::string_view text, SettingsTextError& error) {
+    ProfileMap loaded;
+    std::string loadedActive;
+    if (!parseSettingsText(text, loaded, loadedActive, error)) return false;
+    applyProfiles(std::move(loaded), loadedActive);
+    return true;
+}
+
+bool SystemSettings::importSettings(const std::string& path) {
+    std::string contents;
+    if (!readFileContents(path, contents)) {
+        notificationManager->addNotification("Cannot read settings import file", AlertLevel::WARNING);
+        return false;
+    }
+    SettingsTextError error{0, 0, nullptr};
+    if (!importSettingsText(contents, error)) {
+        notificationManager->addNotification("Settings import rejected at line " + std::to_string(error.line) +
+                                             ", column " + std::to_string(error.column) + ": " + error.message,
+                                             AlertLevel::WARNING);
+        return false;
+    }
+    std::cout << "\tSettings imported from " << path << std::endl;
+    return true;
+}
+
+bool SystemSettings::watchSettings(const std::string& path) {
+    stopWatching();
+    auto fileWatcher = std::make_unique<FileWatcher>();
+    if (!fileWatcher->start(path, [this, path] { reloadSettings(path); })) {
+        notificationManager->addNotification("Cannot watch settings file", AlertLevel::WARNING);
+        return false;
+    }
+    watcher = std::move(fileWatcher);
+    return true;
+}
+
+void SystemSettings::stopWatching() {
+    watcher.reset();
+}
+
+std::string SystemSettings::themeToString(DisplayTheme theme) {
+    return formatSetting(settingSpec(SettingKey::THEME), static_cast<int>(theme));
+}
+
+std::string SystemSettings::languageToString(Language lang) {
+    return formatSetting(settingSpec(SettingKey::LANGUAGE), static_cast<int>(lang));
 }
@@ -0,0 +1,187 @@
+/**
+ * @file TaskScheduler.cpp
+ * @brief Implementation of the TaskScheduler class
+ */
+
+#include "TaskScheduler.h"
+#include <algorithm>
+
+namespace {
+// Failed searches before an idle worker sleeps; covers the gap between
+// the pieces of a parallelFor without a condition-variable round trip
+const int SPIN_ROUNDS = 64;
+
+// Scheduler whose worker the current thread is, and its index there
+thread_local const TaskScheduler* workerOwner = nullptr;
+thread_local int workerIndex = -1;
+} // namespace
+
+TaskScheduler& TaskScheduler::instance() {
+    // Callers of parallelFor work too, so one core is left to them
+    static TaskScheduler scheduler(std::max(2u, std::thread::hardware_concurrency()) - 1);
+    return scheduler;
+}
+
+TaskScheduler::TaskScheduler(unsigned workerCount)
+    : injectedCount(0), queuedCount(0), unfinishedCount(0), sleepingCount(0), stopping(false) {
+    workers.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; ++i) workers.push_back(std::make_unique<Worker>());
+    // Every deque exists before any worker can steal from it
+    for (unsigned i = 0; i < workerCount; ++i) {
+        workers[i]->thread = std::thread(&TaskScheduler::workerLoop, this, static_cast<int>(i));
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping.store(true);
+    }
+    wakeSignal.notify_all();
+    for (auto& worker : workers) worker->thread.join();
+}
+
+int TaskScheduler::currentWorker() const {
+    return workerOwner == this ? workerIndex : -1;
+}
+
+void TaskScheduler::enqueue(Task* task, TaskPriority priority) {
+    const size_t level = static_cast<size_t>(priority);
+    unfinishedCount.fetch_add(1, std::memory_order_relaxed);
+    // Counted before it becomes visible, so a taker never sees the count short
+    queuedCount.fetch_add(1, std::memory_order_seq_cst);
+    const int self = currentWorker();
+    if (self >= 0) {
+        workers[self]->deques[level].push(task);
+    } else {
+        std::lock_guard<std::mutex> lock(injectMutex);
+        injected[level].push_back(task);
+        injectedCount.fetch_add(1, std::memory_order_release);
+    }
+    // Pairs with the sleeper's increment before it checks queuedCount
+    if (sleepingCount.load(std::memory_order_seq_cst) > 0) {
+        { std::lock_guard<std::mutex> lock(sleepMutex); }
+        wakeSignal.notify_one();
+    }
+}
+
+TaskScheduler::Task* TaskScheduler::findTask(int self) {
+    const size_t count = workers.size();
+    const size_t firstVictim = self >= 0 ? static_cast<size_t>(self) + 1 : 0;
+    for (size_t level = 0; level < TASK_PRIORITY_COUNT; ++level) {
+        Task* task = self >= 0 ? workers[self]->deques[level].pop() : nullptr;
+        if (task == nullptr && injectedCount.load(std::memory_order_acquire) > 0) {
+            std::lock_guard<std::mutex> lock(injectMutex);
+            if (!injected[level].empty()) {
+                task = injected[level].front();
+                injected[level].pop_front();
+                injectedCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+        for (size_t i = 0; task == nullptr && i < count; ++i) {
+            const size_t victim = (firstVictim + i) % count;
+            if (static_cast<int>(victim) != self) task = workers[victim]->deques[level].steal();
+        }
+        if (task != nullptr) {
+            queuedCount.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void TaskScheduler::execute(Task* task) {
+    (*task)();
+    delete task;
+    unfinishedCount.fetch_sub(1, std::memory_order_release);
+}
+
+void TaskScheduler::workerLoop(int index) {
+    workerOwner = this;
+    workerIndex = index;
+    int idleRounds = 0;
+    while (true) {
+        if (Task* task = findTask(index)) {
+            execute(task);
+            idleRounds = 0;
+            continue;
+        }
+        if (++idleRounds < SPIN_ROUNDS) {
+            std::this_thread::yield();
+            continue;
+        }
+        idleRounds = 0;
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepingCount.fetch_add(1, std::memory_order_seq_cst);
+        wakeSignal.wait(lock, [this] {
+            return queuedCount.load(std::memory_order_seq_cst) > 0 || stopping.load();
+        });
+        sleepingCount.fetch_sub(1, std::memory_order_relaxed);
+        // Queued work is finished before the scheduler stops
+        if (stopping.load() && queuedCount.load() == 0) return;
+    }
+}
+
+void TaskScheduler::submit(Task task, TaskPriority priority) {
+    if (workers.empty()) {
+        task();
+        return;
+    }
+    enqueue(new Task(std::move(task)), priority);
+}
+
+void TaskScheduler::splitRange(size_t begin, size_t end, size_t grain, const RangeBody& body,
+                               TaskPriority priority, std::atomic<size_t>& pending) {
+    // Thieves take the oldest, largest halves; this thread keeps halving its own
+    while (end - begin > grain) {
+        const size_t middle = begin + (end - begin) / 2;
+        pending.fetch_add(1, std::memory_order_relaxed);
+        enqueue(new Task([this, middle, end, grain, &body, priority, &pending]() {
+            splitRange(middle, end, grain, body, priority, pending);
+            pending.fetch_sub(1, std::memory_order_release);
+        }), priority);
+        end = middle;
+    }
+    body(begin, end);
+}
+
+void TaskScheduler::parallelFor(size_t begin, size_t end, size_t grain, const RangeBody& body,
+                                TaskPriority priority) {
+    if (begin >= end) return;
+    grain = std::max<size_t>(grain, 1);
+    if (workers.empty() || end - begin <= grain) {
+        body(begin, end);
+        return;
+    }
+
+    std::atomic<size_t> pending(0);
+    splitRange(begin, end, grain, body, priority, pending);
+    // Run queued work (ours or anyone's) until every piece has finished
+    const int self = currentWorker();
+    while (pending.load(std::memory_order_acquire) > 0) {
+        if (Task* task = findTask(self)) {
+            execute(task);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void TaskScheduler::waitIdle() {
+    const int self = currentWorker();
+    while (unfinishedCount.load(std::memory_order_acquire) > 0) {
+        if (Task* task = findTask(self)) {
+            execute(task);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+unsigned TaskScheduler::getWorkerCount() const {
+    return static_cast<unsigned>(workers.size());
+}
+
+unsigned TaskScheduler::getConcurrency() const {
+    return getWorkerCount() + 1;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file VehicleDataFeed.cpp
+ * @brief Implementation of the VehicleDataFeed class
+ */
+
+#include "VehicleDataFeed.h"
+#include "CanDecoder.h"
+#include "NmeaParser.h"
+#include <charconv>
+
+namespace {
+bool isBlank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+// Next blank-separated number, advancing text past it
+bool nextNumber(std::string_view& text, double& value) {
+    size_t start = 0;
+    while (start < text.size() && isBlank(text[start])) ++start;
+    const char* const begin = text.data() + start;
+    const auto result = std::from_chars(begin, text.data() + text.size(), value);
+    if (result.ec != std::errc() || (result.ptr != text.data() + text.size() && !isBlank(*result.ptr))) return false;
+    text.remove_prefix(static_cast<size_t>(result.ptr - text.data()));
+    return true;
+}
+
+bool onlyBlanks(std::string_view text) {
+    for (char c : text) {
+        if (!isBlank(c)) return false;
+    }
+    return true;
+}
+} // namespace
+
+VehicleDataFeed::VehicleDataFeed(std::shared_ptr<VehicleMonitor> vehicleMonitor,
+                                 std::shared_ptr<GPSNavigator> gpsNavigator)
+    : vehicle(std::move(vehicleMonitor)), gps(std::move(gpsNavigator)), counters{} {}
+
+bool VehicleDataFeed::apply(FeedFormat format, std::string_view line) {
+    size_t start = 0;
+    while (start < line.size() && isBlank(line[start])) ++start;
+    if (start == line.size() || line[start] == '#') return true;
+
+    FeedCounters& counter = counters[static_cast<size_t>(format)];
+    ++counter.lines;
+    counter.bytes += line.size();
+    line.remove_prefix(start);
+    bool applied = false;
+    switch (format) {
+        case FeedFormat::TELEMETRY: applied = applyTelemetry(line); break;
+        case FeedFormat::NMEA: applied = applyNmea(line); break;
+        case FeedFormat::CAN: applied = applyCan(line); break;
+        default: break;
+    }
+    if (!applied) ++counter.rejected;
+    return applied;
+}
+
+bool VehicleDataFeed::applyTelemetry(std::string_view line) {
+    size_t nameEnd = 0;
+    while (nameEnd < line.size() && !isBlank(line[nameEnd])) ++nameEnd;
+    const std::string_view sensor = line.substr(0, nameEnd);
+    std::string_view rest = line.substr(nameEnd);
+    double value = 0.0;
+    if (!nextNumber(rest, value)) return false;
+
+    if (sensor == "position") {
+        double longitude = 0.0;
+        if (!nextNumber(rest, longitude) || !onlyBlanks(rest)) return false;
+        GPSCoordinate location = gps->getCurrentLocation();
+        location.latitude = value;
+        location.longitude = longitude;
+        gps->updateLocation(location);
+        return true;
+    }
+    if (!onlyBlanks(rest)) return false;
+    if (sensor == "engine_temp") {
+        vehicle->setEngineTemperature(value);
+    } else if (sensor == "fuel") {
+        vehicle->setFuelLevel(value);
+    } else if (sensor == "speed") {
+        vehicle->setCurrentSpeed(value);
+        gps->updateSpeed(value);
+    } else if (sensor == "brake_wear") {
+        vehicle->setBrakeWearLevel(value);
+    } else if (sensor == "heading") {
+        gps->updateHeading(value);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool VehicleDataFeed::applyNmea(std::string_view line) {
+    NmeaFix fix;
+    if (!NmeaParser::parse(line, fix)) return false;
+    if (fix.hasPosition) {
+        GPSCoordinate location(fix.latitude, fix.longitude, gps->getCurrentLocation().altitude);
+        if (fix.hasAltitude) location.altitude = fix.altitude;
+        gps->updateLocation(location);
+    }
+    if (fix.hasMotion) {
+        gps->updateSpeed(fix.speedKmh);
+        gps->updateHeading(fix.course);
+    }
+    if (fix.hasQuality) gps->updateGPSSignal(fix.satellites, fix.accuracy);
+    return true;
+}
+
+bool VehicleDataFeed::applyCan(std::string_view line) {
+    CanFrame frame;
+    if (!CanDecoder::parseCandump(line, frame)) return false;
+    double value = 0.0;
+    switch (CanDecoder::decode(frame, value)) {
+        case CanSignal::ENGINE_TEMP:
+            vehicle->setEngineTemperature(value);
+            break;
+        case CanSignal::SPEED:
+            vehicle->setCurrentSpeed(value);
+            break;
+        case CanSignal::FUEL_LEVEL:
+            vehicle->setFuelLevel(value);
+            break;
+        case CanSignal::FUEL_RATE: {
+            // L/h to L/100km; meaningless while standing still
+            const double speed = vehicle->getCurrentSpeed();
+            if (speed >= 1.0) vehicle->setFuelConsumptionRate(value / speed * 100.0);
+            break;
+        }
+        default:
+            // Other traffic on the bus is valid input we do not track
+            break;
+    }
+    return true;
+}
+
+const FeedCounters& VehicleDataFeed::getCounters(FeedFormat format) const {
+    return counters[static_cast<size_t>(format)];
+}
+
+const char* VehicleDataFeed::formatName(FeedFormat format) {
+    switch (format) {
+        case FeedFormat::TELEMETRY: return "telemetry";
+        case FeedFormat::NMEA: return "nmea";
+        case FeedFormat::CAN: return "can";
+        default: return "unknown";
+    }
+}
@@ -4,6 +4,7 @@
  */
 
 #include "VehicleMonitor.h"
+#include "MessageCatalog.h"
 #include <iostream>
 #include <iomanip>
 #include <random>
@@ -11,7 +12,8 @@
 
 VehicleMonitor::VehicleMonitor(std::shared_ptr<NotificationManager> notifManager)
     : engineTemperature(85.0), fuelLevel(75.0), fuelConsumptionRate(8.5),
-      currentSpeed(0.0), brakeWearLevel(85.0), notificationManager(notifManager) {}
+      currentSpeed(0.0), brakeWearLevel(85.0), speedSimulated(true), engineAlert(SensorAlert::NONE), fuelAlert(SensorAlert::NONE),
+      speedAlert(SensorAlert::NONE), brakeAlert(SensorAlert::NONE), notificationManager(notifManager) {}
 void VehicleMonitor::setEngineTemperature(double temperature) {
     // Validate temperature range (-50°C to 200°C)
     if (temperature < -50.0) temperature = -50.0;
@@ -51,63 +53,70 @@ double VehicleMonitor::getFuelLevel() const { return fuelLevel; }
 double VehicleMonitor::getFuelConsumptionRate() const { return fuelConsumptionRate; }
 double VehicleMonitor::getCurrentSpeed() const { return currentSpeed; }
 double VehicleMonitor::getBrakeWearLevel() const { return brakeWearLevel; }
-void VehicleMonitor::checkEngineTemperature() {
-    if (engineTemperature > MAX_ENGINE_TEMP) {
-        std::stringstream ss;
-        ss << "Engine overheating! Temperature: " << std::fixed << std::setprecision(1) 
-           << engineTemperature << "°C (Max: " << MAX_ENGINE_TEMP << "°C)";
-        notificationManager->addNotification(ss.str(), AlertLevel::CRITICAL);
-    } else if (engineTemperature > MAX_ENGINE_TEMP - 10.0) {
-        std::stringstream ss;
-        ss << "Engine temperature elevated: " << std::fixed << std::setprecision(1) 
-           << engineTemperature << "°C";
-        notificationManager->addNotification(ss.str(), AlertLevel::WARNING);
-    }
+bool VehicleMonitor::shouldAlert(SensorAlert& last, SensorAlert current, bool force) {
+    const bool changed = current != last;
+    last = current;
+    return current != SensorAlert::NONE && (changed || force);
 }
 
-void VehicleMonitor::checkFuelLevel() {
-    if (fuelLevel <= CRITICAL_FUEL_THRESHOLD) {
-        std::stringstream ss;
-        ss << "CRITICAL: Fuel level extremely low! " << std::fixed << std::setprecision(1) 
-           << fuelLevel << "% remaining";
-        notificationManager->addNotification(ss.str(), AlertLevel::CRITICAL);
-    } else if (fuelLevel <= LOW_FUEL_THRESHOLD) {
-        std::stringstream ss;
-        ss << "Low fuel warning: " << std::fixed << std::setprecision(1) 
-           << fuelLevel << "% remaining";
-        notificationManager->addNotification(ss.str(), AlertLevel::WARNING);
+void VehicleMonitor::checkEngineTemperature(bool force) {
+    const SensorAlert level = engineTemperature > MAX_ENGINE_TEMP ? SensorAlert::CRITICAL
+        : engineTemperature > MAX_ENGINE_TEMP - 10.0 ? SensorAlert::WARNING : SensorAlert::NONE;
+    if (!shouldAlert(engineAlert, level, force)) return;
+    if (level == SensorAlert::CRITICAL) {
+        notificationManager->addNotification(
+            MessageCatalog::instance().format(MessageId::ENGINE_OVERHEATING,
+                                              {formatFixed(engineTemperature, 1), formatFixed(MAX_ENGINE_TEMP, 0)}),
+            AlertLevel::CRITICAL);
+    } else {
+        notificationManager->addNotification(
+            MessageCatalog::instance().format(MessageId::ENGINE_TEMPERATURE_HIGH, {formatFixed(engineTemperature, 1)}),
+            AlertLevel::WARNING);
     }
 }
 
-void VehicleMonitor::checkSpeed() {
-    if (currentSpeed > MAX_SPEED_LIMIT) {
-        std::stringstream ss;
-        ss << "Speed limit exceeded! Current: " << std::fixed << std::setprecision(1) 
-           << currentSpeed << " km/h (Limit: " << MAX_SPEED_LIMIT << " km/h)";
-        notificationManager->addNotification(ss.str(), AlertLevel::WARNING);
+void VehicleMonitor::checkFuelLevel(bool force) {
+    const SensorAlert level = fuelLevel <= CRITICAL_FUEL_THRESHOLD ? SensorAlert::CRITICAL
+        : fuelLevel <= LOW_FUEL_THRESHOLD ? SensorAlert::WARNING : SensorAlert::NONE;
+    if (!shouldAlert(fuelAlert, level, force)) return;
+    if (level == SensorAlert::CRITICAL) {
+        notificationManager->addNotification(
+            MessageCatalog::instance().format(MessageId::FUEL_CRITICAL, {formatFixed(fuelLevel, 1)}),
+            AlertLevel::CRITICAL);
+    } else {
+        notificationManager->addNotification(
+            MessageCatalog::instance().format(MessageId::FUEL_LOW, {formatFixed(fuelLevel, 1)}),
+            AlertLevel::WARNING);
     }
 }
 
-void VehicleMonitor::checkBrakeSystem() {
-    if (brakeWearLevel <= MIN_BRAKE_THRESHOLD) {
-        std::stringstream ss;
-        ss << "Brake system requires attention! Wear level: " << std::fixed << std::setprecision(1) 
-           << brakeWearLevel << "%";
-        if (brakeWearLevel <= 10.0) {
-            notificationManager->addNotification(ss.str(), AlertLevel::CRITICAL);
-        } else {
-            notificationManager->addNotification(ss.str(), AlertLevel::WARNING);
-        }
-    }
+void VehicleMonitor::checkSpeed(bool force) {
+    const SensorAlert level = currentSpeed > MAX_SPEED_LIMIT ? SensorAlert::WARNING : SensorAlert::NONE;
+    if (!shouldAlert(speedAlert, level, force)) return;
+    notificationManager->addNotification(
+        MessageCatalog::instance().format(MessageId::SPEED_LIMIT_EXCEEDED,
+                                          {formatFixed(currentSpeed, 1), formatFixed(MAX_SPEED_LIMIT, 0)}),
+        AlertLevel::WARNING);
+}
+
+void VehicleMonitor::checkBrakeSystem(bool force) {
+    const SensorAlert level = brakeWearLevel <= 10.0 ? SensorAlert::CRITICAL
+        : brakeWearLevel <= MIN_BRAKE_THRESHOLD ? SensorAlert::WARNING : SensorAlert::NONE;
+    if (!shouldAlert(brakeAlert, level, force)) return;
+    const std::string message =
+        MessageCatalog::instance().format(MessageId::BRAKES_WORN, {formatFixed(brakeWearLevel, 1)});
+    notificationManager->addNotification(message, level == SensorAlert::CRITICAL ? AlertLevel::CRITICAL
+                                                                                 : AlertLevel::WARNING);
 }
 void VehicleMonitor::performSystemCheck() {
     std::cout << "\n\tPerforming comprehensive system check..." << std::endl;    
-    checkEngineTemperature();
-    checkFuelLevel();
-    checkSpeed();
-    checkBrakeSystem();    
+    // An explicit check reports every active condition, even ones already announced
+    checkEngineTemperature(true);
+    checkFuelLevel(true);
+    checkSpeed(true);
+    checkBrakeSystem(true);    
     if (!notificationManager->hasCriticalAlerts()) {
-        notificationManager->addNotification("System check completed - All systems normal", AlertLevel::INFO);
+        notificationManager->addNotification(MessageCatalog::instance().text(MessageId::SYSTEM_CHECK_OK), AlertLevel::INFO);
     }
 }
 
@@ -164,17 +173,23 @@ void VehicleMonitor::displayStatus() const {
     std::cout << std::string(45, '=') << std::endl;
 }
 void VehicleMonitor::simulateRealTimeUpdate() {
-    std::random_device rd;
-    std::mt19937 gen(rd());    
-    std::uniform_real_distribution<> tempVar(-2.0, 3.0);
-    std::uniform_real_distribution<> fuelVar(-0.5, 0.0);  // Fuel only decreases
-    std::uniform_real_distribution<> speedVar(-5.0, 10.0);
-    std::uniform_real_distribution<> brakeVar(-0.1, 0.0); 
-    setEngineTemperature(engineTemperature + tempVar(gen));
+    // Seeded once: the event loop calls this every second
+    static std::mt19937 gen(std::random_device{}());
+    std::uniform_real_distribution<> tempVar(-1.0, 1.0);
+    std::uniform_real_distribution<> fuelVar(-0.005, 0.0);  // Fuel only decreases
+    std::uniform_real_distribution<> speedVar(-5.0, 5.0);
+    std::uniform_real_distribution<> brakeVar(-0.001, 0.0);
+    // Temperature and speed revert towards cruising values instead of
+    // drifting into permanent alerts over a long run
+    setEngineTemperature(engineTemperature + 0.1 * (SIMULATED_ENGINE_TEMP - engineTemperature) + tempVar(gen));
     setFuelLevel(fuelLevel + fuelVar(gen));
-    setCurrentSpeed(std::max(0.0, currentSpeed + speedVar(gen)));
+    if (speedSimulated) {
+        setCurrentSpeed(std::max(0.0, currentSpeed + 0.1 * (SIMULATED_CRUISE_SPEED - currentSpeed) + speedVar(gen)));
+    }
     setBrakeWearLevel(brakeWearLevel + brakeVar(gen));
-    std::cout << " Real-time data updated..." << std::endl;
+}
+void VehicleMonitor::setSpeedSimulation(bool enabled) {
+    speedSimulated = enabled;
 }
 double VehicleMonitor::calculateEstimatedRange() const {
     if (fuelConsumptionRate <= 0.0) return 0.0;
@@ -0,0 +1,134 @@
+/**
+ * @file WavDecoder.cpp
+ * @brief Implementation of the WavDecoder class
+ */
+
+#include "WavDecoder.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+const uint16_t WAVE_FORMAT_PCM = 1;
+const uint16_t WAVE_FORMAT_IEEE_FLOAT = 3;
+const uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+uint32_t readLE32(const unsigned char* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint16_t readLE16(const unsigned char* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+} // namespace
+
+WavDecoder::WavDecoder()
+    : dataOffset(0), totalFrames(0), position(0), sampleRate(0), channels(0),
+      bitsPerSample(0), blockAlign(0), floatSamples(false) {}
+
+bool WavDecoder::open(const std::string& path) {
+    file.close();
+    file.clear();
+    totalFrames = 0;
+    position = 0;
+    file.open(path, std::ios::binary);
+    if (!file) return false;
+
+    unsigned char riff[12];
+    if (!file.read(reinterpret_cast<char*>(riff), sizeof(riff)) ||
+        std::memcmp(riff, "RIFF", 4) != 0 || std::memcmp(riff + 8, "WAVE", 4) != 0) {
+        return false;
+    }
+
+    // Walk chunks by header only; the data chunk is never read here
+    bool haveFormat = false;
+    uint16_t format = 0;
+    unsigned char header[8];
+    while (file.read(reinterpret_cast<char*>(header), sizeof(header))) {
+        const uint32_t size = readLE32(header + 4);
+        const uint64_t body = static_cast<uint64_t>(file.tellg());
+
+        if (std::memcmp(header, "fmt ", 4) == 0 && size >= 16) {
+            unsigned char fmt[40] = {};
+            file.read(reinterpret_cast<char*>(fmt), std::min<uint32_t>(size, sizeof(fmt)));
+            format = readLE16(fmt);
+            channels = readLE16(fmt + 2);
+            sampleRate = readLE32(fmt + 4);
+            blockAlign = readLE16(fmt + 12);
+            bitsPerSample = readLE16(fmt + 14);
+            if (format == WAVE_FORMAT_EXTENSIBLE && size >= 26) {
+                format = readLE16(fmt + 24);    // first two bytes of the sub-format GUID
+            }
+            haveFormat = true;
+        } else if (std::memcmp(header, "data", 4) == 0) {
+            if (!haveFormat || channels == 0 || sampleRate == 0 ||
+                blockAlign != channels * ((bitsPerSample + 7) / 8)) {
+                return false;
+            }
+            floatSamples = format == WAVE_FORMAT_IEEE_FLOAT;
+            if (floatSamples ? bitsPerSample != 32
+                             : (format != WAVE_FORMAT_PCM || bitsPerSample < 8 || bitsPerSample > 32)) {
+                return false;
+            }
+            dataOffset = body;
+            totalFrames = size / blockAlign;
+            // Sized once, so read() never allocates on the audio thread
+            scratch.assign(READ_CHUNK_FRAMES * blockAlign, 0);
+            return static_cast<bool>(file.seekg(static_cast<std::streamoff>(dataOffset)));
+        }
+        file.seekg(static_cast<std::streamoff>(body + size + (size & 1)));   // chunks are word aligned
+    }
+    return false;
+}
+
+size_t WavDecoder::read(float* out, size_t frames) {
+    size_t done = 0;
+    frames = static_cast<size_t>(std::min<uint64_t>(frames, totalFrames - position));
+    const int bytesPerSample = blockAlign / channels;
+
+    while (done < frames) {
+        const size_t chunk = std::min(frames - done, READ_CHUNK_FRAMES);
+        file.read(reinterpret_cast<char*>(scratch.data()), static_cast<std::streamsize>(chunk * blockAlign));
+        const size_t got = static_cast<size_t>(file.gcount()) / blockAlign;
+
+        const unsigned char* p = scratch.data();
+        float* dst = out + done * channels;
+        const size_t samples = got * channels;
+        if (floatSamples) {
+            std::memcpy(dst, p, samples * sizeof(float));
+        } else if (bytesPerSample == 1) {
+            for (size_t i = 0; i < samples; ++i) dst[i] = (static_cast<int>(p[i]) - 128) / 128.0f;
+        } else if (bytesPerSample == 2) {
+            for (size_t i = 0; i < samples; ++i, p += 2) dst[i] = static_cast<int16_t>(readLE16(p)) / 32768.0f;
+        } else if (bytesPerSample == 3) {
+            for (size_t i = 0; i < samples; ++i, p += 3) {
+                int32_t value = static_cast<int32_t>((static_cast<uint32_t>(p[0]) << 8) |
+                                                     (static_cast<uint32_t>(p[1]) << 16) |
+                                                     (static_cast<uint32_t>(p[2]) << 24)) >> 8;
+                dst[i] = value / 8388608.0f;
+            }
+        } else {
+            for (size_t i = 0; i < samples; ++i, p += 4) dst[i] = static_cast<int32_t>(readLE32(p)) / 2147483648.0f;
+        }
+
+        done += got;
+        position += got;
+        if (got < chunk) {
+            file.clear();
+            break;
+        }
+    }
+    return done;
+}
+
+bool WavDecoder::seek(uint64_t frame) {
+    if (!file.is_open()) return false;
+    position = std::min(frame, totalFrames);
+    file.clear();
+    return static_cast<bool>(file.seekg(static_cast<std::streamoff>(dataOffset + position * blockAlign)));
+}
+
+uint64_t WavDecoder::tell() const { return position; }
+uint64_t WavDecoder::getTotalFrames() const { return totalFrames; }
+uint32_t WavDecoder::getSampleRate() const { return sampleRate; }
+uint16_t WavDecoder::getChannels() const { return channels; }
@@ -3,11 +3,55 @@
 #include "SystemSettings.h"
 #include "GPSNavigator.h"
 #include "NotificationManager.h"
+#include "PromptClipCache.h"
+#include "AudioFocusManager.h"
+#include "DisplayScheduler.h"
+#include "MessageCatalog.h"
+#include "EventLoop.h"
+#include "EventQueue.h"
+#include "VehicleEvents.h"
+#include "HeadlessDaemon.h"
+#include "VehicleDataFeed.h"
+#include <ctime>
 #include <iostream>
 #include <memory>
 #include <thread>
 #include <chrono>
-#include <limits>
+#include <future>
+#include <sstream>
+#include <filesystem>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Persistent media state, relative to the working directory
+static const std::string DATA_DIR = "data";
+static const std::string LIBRARY_FILE = DATA_DIR + "/media_library.bin";
+static const std::string PLAYLIST_FILE = DATA_DIR + "/playlist.bin";
+static const std::string ARTWORK_PACK_FILE = DATA_DIR + "/artwork.pack";
+static const std::string SETTINGS_FILE = DATA_DIR + "/settings.bin";
+// Operator-edited settings text, applied once at the next start
+static const std::string PROVISION_FILE = DATA_DIR + "/settings.ini";
+static const std::string CATALOG_FILE = DATA_DIR + "/messages.bin";
+// Translation sources compiled into CATALOG_FILE
+static const std::string LOCALE_DIR = "locale";
+// Named pipe accepting "<sensor> <value>" lines from sensor gateways (Linux)
+static const std::string SENSOR_FIFO = DATA_DIR + "/sensors";
+static const int STDIN_FD = 0;
+static const auto SENSOR_TICK = std::chrono::milliseconds(1000);
+static const auto DISPLAY_TICK = std::chrono::milliseconds(60000);
+// How soon the next track starts after the audio thread reaches the end of one
+static const auto PLAYBACK_TICK = std::chrono::milliseconds(100);
+// Simulated sensor data pauses while real readings arrive this often
+static const auto SENSOR_IDLE_TIMEOUT = std::chrono::seconds(5);
+// Notifications kept for the notification screen; older ones are dropped
+static const size_t NOTIFICATION_HISTORY_LIMIT = 500;
+static const size_t ARTWORK_MEMORY_BUDGET = 2 * 1024 * 1024;
+// Nonzero pages library metadata from the cache file, keeping this many tracks decoded (low-RAM units)
+static const size_t LIBRARY_CACHE_TRACKS = 0;
 
 void displayMenu() {
     std::cout << "\n            VEHICLE SYSTEM MENU     \n" << std::endl;
@@ -47,34 +91,209 @@ void gpsNavigationDemo(std::shared_ptr<GPSNavigator> gps) {
     gps->displayGPSStatus();
     gps->displayRoute();
 }
-int main() {
+// Open the sensor pipe for the event loop, creating it if needed; -1 if unavailable
+int openSensorFifo() {
+#if defined(__linux__)
+    struct stat info;
+    if (stat(SENSOR_FIFO.c_str(), &info) != 0 && mkfifo(SENSOR_FIFO.c_str(), 0660) != 0) return -1;
+    // Read-write keeps a writer attached, so gateways reconnecting never cause end of input
+    return ::open(SENSOR_FIFO.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+#else
+    return -1;
+#endif
+}
+
+// Map the message catalog, rebuilding it first if a locale source is newer
+void loadMessageCatalog() {
+    std::error_code ec;
+    auto catalogTime = std::filesystem::last_write_time(CATALOG_FILE, ec);
+    bool stale = static_cast<bool>(ec);
+    for (const auto& entry : std::filesystem::directory_iterator(LOCALE_DIR, ec)) {
+        std::error_code timeError;
+        if (!stale && std::filesystem::last_write_time(entry.path(), timeError) > catalogTime) {
+            stale = true;
+        }
+    }
+    if (!stale && MessageCatalog::instance().load(CATALOG_FILE)) return;
+    if (!MessageCatalog::compile(LOCALE_DIR, CATALOG_FILE) || !MessageCatalog::instance().load(CATALOG_FILE)) {
+        std::cout << "\tMessage catalog unavailable - using English" << std::endl;
+    }
+}
+
+// Republish every settings transaction as a bus event
+void publishSettingsChanges(SystemSettings& settings, VehicleEventBus& bus) {
+    settings.subscribe({SettingKey::SYSTEM_VOLUME, SettingKey::DISPLAY_BRIGHTNESS, SettingKey::THEME,
+                        SettingKey::LANGUAGE, SettingKey::NIGHT_MODE, SettingKey::VOICE_GUIDANCE,
+                        SettingKey::NOTIFICATION_SOUNDS, SettingKey::TIME_FORMAT, SettingKey::TEMPERATURE_UNIT},
+                       [&bus](const SettingsChange& change) {
+        bus.publish(SettingsChangedEvent{change.changed, change.previous, change.current});
+    });
+}
+
+// Headless mode: the vehicle subsystems driven by recorded or live streams, no menu
+int runHeadless(const DaemonOptions& options) {
+    // Before the settings watcher starts a thread, so signals reach the daemon
+    HeadlessDaemon::blockSignals();
+    // Subsystems render status to the console; outputs go to the daemon's sinks instead
+    std::cout.rdbuf(nullptr);
+    std::error_code ec;
+    std::filesystem::create_directories(DATA_DIR, ec);
+    loadMessageCatalog();
+    // Outlives every subsystem publishing on it
+    VehicleEventBus eventBus;
+    auto notificationManager = std::make_shared<NotificationManager>();
+    auto vehicleMonitor = std::make_shared<VehicleMonitor>(notificationManager);
+    auto gpsNavigator = std::make_shared<GPSNavigator>(notificationManager);
+    auto systemSettings = std::make_shared<SystemSettings>(notificationManager);
+    publishSettingsChanges(*systemSettings, eventBus);
+    // Only the language follows the bus here: vehicle speed comes from CAN, not GPS
+    eventBus.subscribe<SettingsChangedEvent>([](const SettingsChangedEvent& event) {
+        if (event.contains(SettingKey::LANGUAGE)) {
+            MessageCatalog::instance().setLanguage(static_cast<size_t>(event.current.language));
+        }
+    });
+    systemSettings->loadSettings(SETTINGS_FILE);
+    MessageCatalog::instance().setLanguage(static_cast<size_t>(systemSettings->getLanguage()));
+    systemSettings->watchSettings(SETTINGS_FILE);
+    auto displayScheduler = std::make_shared<DisplayScheduler>(systemSettings, gpsNavigator);
+
+    HeadlessDaemon daemon(options, notificationManager, vehicleMonitor, gpsNavigator, displayScheduler);
+    const int status = daemon.run();
+    systemSettings->stopWatching();
+    return status;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        const std::string first = argv[1];
+        if (first == "--help" || first == "-h") {
+            std::cout << HeadlessDaemon::usage();
+            return 0;
+        }
+        DaemonOptions options;
+        std::string error;
+        if (!HeadlessDaemon::parseArguments(argc, argv, options, error)) {
+            std::cerr << "vehicle_system: " << error << "\n" << HeadlessDaemon::usage();
+            return 2;
+        }
+        return runHeadless(options);
+    }
+
     std::cout << "          Vehicle Monitoring System with GPS Navigation" << std::endl;
     std::cout << "..........................................................................................................................................." << std::endl;    
+    std::error_code ec;
+    std::filesystem::create_directories(DATA_DIR, ec);
+    loadMessageCatalog();
+    // Cross-component events; declared first so it outlives every publisher
+    VehicleEventBus eventBus;
+    // Events for the menu thread, drained by the event loop (settings reloads arrive on the watcher thread)
+    EventQueue mainQueue;
     // Create shared notification manager
-    auto notificationManager = std::make_shared<NotificationManager>();    
+    auto notificationManager = std::make_shared<NotificationManager>();
+    notificationManager->setHistoryLimit(NOTIFICATION_HISTORY_LIMIT);
     // Create system components
     auto vehicleMonitor = std::make_shared<VehicleMonitor>(notificationManager);
     auto gpsNavigator = std::make_shared<GPSNavigator>(notificationManager);
     auto mediaPlayer = std::make_shared<MediaPlayer>(notificationManager);
     auto systemSettings = std::make_shared<SystemSettings>(notificationManager);    
-    // Initialize with some demo data
-    mediaPlayer->loadDemoPlaylist();    
+    // Components follow the settings they depend on through the bus
+    publishSettingsChanges(*systemSettings, eventBus);
+    eventBus.subscribe<SettingsChangedEvent>([notificationManager](const SettingsChangedEvent& event) {
+        if (event.contains(SettingKey::NOTIFICATION_SOUNDS)) {
+            notificationManager->setSoundEnabled(event.current.notificationSoundsEnabled);
+        }
+        if (event.contains(SettingKey::LANGUAGE)) {
+            MessageCatalog::instance().setLanguage(static_cast<size_t>(event.current.language));
+        }
+    }, &mainQueue);
+    // The vehicle's speedometer follows the GPS ground speed, so only the GPS simulates it
+    gpsNavigator->setEventBus(&eventBus);
+    eventBus.subscribe<SpeedChangedEvent>([vehicleMonitor](const SpeedChangedEvent& event) {
+        vehicleMonitor->setCurrentSpeed(event.speedKmh);
+    });
+    vehicleMonitor->setSpeedSimulation(false);
+    // Keep settings changes undoable across restarts
+    systemSettings->setHistoryPersistence(true);
+    systemSettings->loadSettings(SETTINGS_FILE);
+    if (std::filesystem::exists(PROVISION_FILE) && systemSettings->importSettings(PROVISION_FILE)) {
+        std::filesystem::rename(PROVISION_FILE, PROVISION_FILE + ".applied", ec);
+    }
+    MessageCatalog::instance().setLanguage(static_cast<size_t>(systemSettings->getLanguage()));
+    // Apply the loaded settings before anything is announced
+    mainQueue.drain();
+    // Preload voice prompts so the first one plays without disk access
+    auto promptCache = std::make_shared<PromptClipCache>();
+    promptCache->preload("prompts");
+    auto audioFocus = std::make_shared<AudioFocusManager>(mediaPlayer, promptCache);
+    gpsNavigator->setVoicePromptHandler([systemSettings, audioFocus](VoicePrompt prompt) {
+        if (systemSettings->isVoiceGuidanceEnabled()) {
+            audioFocus->requestPrompt(prompt);
+        }
+    });
+    // Restore the saved library and playlist, or fall back to demo data
+    mediaPlayer->setLibraryCacheLimit(LIBRARY_CACHE_TRACKS);
+    bool restored = std::filesystem::exists(LIBRARY_FILE) && std::filesystem::exists(PLAYLIST_FILE) &&
+                    mediaPlayer->loadLibrary(LIBRARY_FILE) && mediaPlayer->loadPlaylist(PLAYLIST_FILE);
+    if (!restored) {
+        mediaPlayer->loadDemoPlaylist();
+    }
+    // Settings files pushed by fleet management apply without a restart
+    systemSettings->watchSettings(SETTINGS_FILE);
+    // Album art is decoded once per track here, never on track change
+    auto artworkCache = std::make_shared<ArtworkCache>(ARTWORK_MEMORY_BUDGET);
+    if (artworkCache->open(ARTWORK_PACK_FILE)) {
+        mediaPlayer->setArtworkCache(artworkCache);
+        mediaPlayer->scanArtwork();
+    }
+
     // Set initial GPS location (example: Los Angeles)
     GPSCoordinate initialLocation(34.0522, -118.2437, 100.0);
     gpsNavigator->updateLocation(initialLocation);
     gpsNavigator->updateSpeed(60.0);
     gpsNavigator->updateHeading(45.0);
     gpsNavigator->updateGPSSignal(8, 3.5);    
-    int choice;
-    do {
-        displayMenu();        
-        // Input validation
-        if (!(std::cin >> choice)) {
+    // AUTO theme follows the sun at the vehicle's position
+    auto displayScheduler = std::make_shared<DisplayScheduler>(systemSettings, gpsNavigator);
+    displayScheduler->tick(std::time(nullptr));
+    EventLoop loop;
+    mainQueue.setWakeup([&loop, &mainQueue]() { loop.post([&mainQueue]() { mainQueue.drain(); }); });
+    // Anything queued before the wakeup was set
+    loop.post([&mainQueue]() { mainQueue.drain(); });
+    auto lastSensorReading = std::chrono::steady_clock::time_point();
+    // Sensors advance on their own; menu input is just another source
+    loop.addTimer(SENSOR_TICK, [&]() {
+        if (std::chrono::steady_clock::now() - lastSensorReading < SENSOR_IDLE_TIMEOUT) return;
+        vehicleMonitor->simulateRealTimeUpdate();
+        gpsNavigator->simulateGPSUpdate();
+    });
+    loop.addTimer(DISPLAY_TICK, [displayScheduler]() { displayScheduler->tick(std::time(nullptr)); });
+    loop.addTimer(PLAYBACK_TICK, [mediaPlayer]() { mediaPlayer->pollTrackEnd(); });
+    VehicleDataFeed sensorFeed(vehicleMonitor, gpsNavigator);
+    const int sensorFd = openSensorFifo();
+    if (sensorFd >= 0) {
+        loop.addLineReader(sensorFd, [&](std::string_view line) {
+            if (sensorFeed.apply(FeedFormat::TELEMETRY, line)) {
+                lastSensorReading = std::chrono::steady_clock::now();
+            }
+        }, nullptr);
+    }
+
+    // Handle one line of menu input; false once the user chose to exit
+    bool exiting = false;
+    auto handleInput = [&](std::string_view line) -> bool {
+        // Input read together with the exit choice is ignored
+        if (exiting) return false;
+        if (line.find_first_not_of(" \t") == std::string_view::npos) {
+            std::cout << "Choose an option: " << std::flush;
+            return true;
+        }
+        int choice = -1;
+        std::istringstream input{std::string(line)};
+        if (!(input >> choice)) {
             std::cout << "   Invalid input. Please enter a number." << std::endl;
-            std::cin.clear();
-            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            continue;
-        }        
+            displayMenu();
+            return true;
+        }
         switch (choice) {
             case 1:
                 vehicleMonitor->displayStatus();
@@ -86,8 +305,10 @@ int main() {
                 std::cout << "\n\tMedia Player Status:" << std::endl;
                 mediaPlayer->displayCurrentTrack();
                 mediaPlayer->displayPlaylist();
+                mediaPlayer->displayStatistics();
                 break;                
             case 4:
+                displayScheduler->tick(std::time(nullptr));
                 systemSettings->displaySettings();
                 break;                
             case 5:
@@ -96,7 +317,10 @@ int main() {
             case 6:
                 std::cout << "\n     Simulating real-time updates..." << std::endl;
                 vehicleMonitor->simulateRealTimeUpdate();
+                std::cout << " Real-time data updated..." << std::endl;
                 gpsNavigator->simulateGPSUpdate();
+                std::cout << "\tGPS data updated..." << std::endl;
+                displayScheduler->tick(std::time(nullptr));
                 std::cout << "Updates completed!" << std::endl;
                 break;                
             case 7:
@@ -107,16 +331,49 @@ int main() {
                 break;                
             case 0:
                 std::cout << "\n Shutting down vehicle system..." << std::endl;
-                break;                
+                exiting = true;
+                loop.stop();
+                return false;
             default:
                 std::cout << " Invalid option. Please try again." << std::endl;
                 break;
         }        
-        if (choice != 0) {
-            std::cout << "\nPress Enter to continue...";
-            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }        
-    } while (choice != 0);    
+        displayMenu();
+        std::cout << std::flush;
+        return true;
+    };
+
+    displayMenu();
+    std::cout << std::flush;
+    std::thread inputThread;
+    const auto stdinSource = loop.addLineReader(STDIN_FD, [&](std::string_view line) { handleInput(line); },
+                                                [&]() { loop.stop(); });
+    if (stdinSource == 0) {
+        // Without descriptor sources a thread reads lines and hands each to
+        // the loop, waiting for the verdict so it never reads past the exit
+        // choice
+        inputThread = std::thread([&]() {
+            std::string line;
+            while (std::getline(std::cin, line)) {
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                auto verdict = std::make_shared<std::promise<bool>>();
+                auto keepReading = verdict->get_future();
+                loop.post([&handleInput, verdict, line]() { verdict->set_value(handleInput(line)); });
+                if (!keepReading.get()) return;
+            }
+            loop.post([&loop]() { loop.stop(); });
+        });
+    }
+    loop.run();
+    if (inputThread.joinable()) inputThread.join();
+#if defined(__linux__)
+    if (sensorFd >= 0) ::close(sensorFd);
+#endif
+
+    mediaPlayer->saveLibrary(LIBRARY_FILE);
+    mediaPlayer->savePlaylist(PLAYLIST_FILE);
+    systemSettings->stopWatching();
+    systemSettings->saveSettings(SETTINGS_FILE);
     std::cout << "  Vehicle system shutdown complete." << std::endl;
     return 0;
 }
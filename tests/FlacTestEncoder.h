@@ -0,0 +1,207 @@
+/**
+ * @file FlacTestEncoder.h
+ * @brief Minimal FLAC writer used to produce fixtures for decoder tests and benchmarks
+ *
+ * Writes valid FLAC streams with a fixed block size, choosing per frame
+ * between VERBATIM, FIXED and LPC subframes and between the four channel
+ * assignments, so every decoder path is exercised. Compression quality is
+ * not a goal.
+ */
+
+#ifndef FLAC_TEST_ENCODER_H
+#define FLAC_TEST_ENCODER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace flactest {
+
+class BitWriter {
+public:
+    std::vector<uint8_t> bytes;
+    uint64_t accumulator = 0;
+    int pending = 0;
+
+    void write(uint64_t value, int bits) {
+        for (int i = bits - 1; i >= 0; --i) {
+            accumulator = (accumulator << 1) | ((value >> i) & 1);
+            if (++pending == 8) {
+                bytes.push_back(static_cast<uint8_t>(accumulator));
+                accumulator = 0;
+                pending = 0;
+            }
+        }
+    }
+    void writeSigned(int64_t value, int bits) { write(static_cast<uint64_t>(value) & ((1ull << bits) - 1), bits); }
+    void writeUnary(uint32_t zeros) {
+        for (uint32_t i = 0; i < zeros; ++i) write(0, 1);
+        write(1, 1);
+    }
+    void align() { while (pending != 0) write(0, 1); }
+};
+
+inline uint8_t crc8(const std::vector<uint8_t>& data) {
+    uint8_t crc = 0;
+    for (uint8_t byte : data) {
+        crc ^= byte;
+        for (int i = 0; i < 8; ++i) crc = static_cast<uint8_t>((crc << 1) ^ ((crc & 0x80) ? 0x07 : 0));
+    }
+    return crc;
+}
+
+inline uint16_t crc16(const std::vector<uint8_t>& data) {
+    uint16_t crc = 0;
+    for (uint8_t byte : data) {
+        crc ^= static_cast<uint16_t>(byte << 8);
+        for (int i = 0; i < 8; ++i) crc = static_cast<uint16_t>((crc << 1) ^ ((crc & 0x8000) ? 0x8005 : 0));
+    }
+    return crc;
+}
+
+inline void writeUtf8(BitWriter& out, uint64_t value) {
+    if (value < 0x80) { out.write(value, 8); return; }
+    int extra = value < 0x800 ? 1 : value < 0x10000 ? 2 : value < 0x200000 ? 3 : 4;
+    const uint8_t lead[] = {0, 0xC0, 0xE0, 0xF0, 0xF8};
+    out.write(lead[extra] | (value >> (6 * extra)), 8);
+    for (int i = extra - 1; i >= 0; --i) out.write(0x80 | ((value >> (6 * i)) & 0x3F), 8);
+}
+
+inline void writeResidual(BitWriter& out, const std::vector<int64_t>& residual) {
+    uint64_t sum = 0;
+    for (int64_t r : residual) sum += static_cast<uint64_t>(r < 0 ? -r : r);
+    uint32_t param = 0;
+    while (param < 14 && (static_cast<uint64_t>(residual.size()) << (param + 1)) < sum) ++param;
+    out.write(0, 2);        // 4-bit Rice parameters
+    out.write(0, 4);        // one partition
+    out.write(param, 4);
+    for (int64_t r : residual) {
+        uint64_t folded = r >= 0 ? static_cast<uint64_t>(r) << 1 : (static_cast<uint64_t>(-r) << 1) - 1;
+        out.writeUnary(static_cast<uint32_t>(folded >> param));
+        out.write(folded & ((1ull << param) - 1), static_cast<int>(param));
+    }
+}
+
+enum class Subframe { VERBATIM, FIXED, LPC };
+
+inline void writeSubframe(BitWriter& out, const std::vector<int64_t>& x, int bps, Subframe kind) {
+    bool constant = true;
+    for (int64_t v : x) constant = constant && v == x[0];
+    if (constant) {
+        out.write(0, 8);
+        out.writeSigned(x[0], bps);
+        return;
+    }
+    if (kind == Subframe::VERBATIM) {
+        out.write(1 << 1, 8);
+        for (int64_t v : x) out.writeSigned(v, bps);
+        return;
+    }
+
+    std::vector<int64_t> residual;
+    if (kind == Subframe::FIXED) {
+        out.write((8 + 2) << 1, 8);
+        out.writeSigned(x[0], bps);
+        out.writeSigned(x[1], bps);
+        for (size_t i = 2; i < x.size(); ++i) residual.push_back(x[i] - (2 * x[i - 1] - x[i - 2]));
+    } else {
+        // Order-3 predictor with 12-bit coefficients and a shift of 9
+        const int64_t coefficients[3] = {1100, -700, 110};
+        const int shift = 9, precision = 12;
+        out.write((31 + 3) << 1, 8);
+        for (int i = 0; i < 3; ++i) out.writeSigned(x[i], bps);
+        out.write(precision - 1, 4);
+        out.writeSigned(shift, 5);
+        for (int64_t c : coefficients) out.writeSigned(c, precision);
+        for (size_t i = 3; i < x.size(); ++i) {
+            int64_t prediction = coefficients[0] * x[i - 1] + coefficients[1] * x[i - 2] + coefficients[2] * x[i - 3];
+            residual.push_back(x[i] - (prediction >> shift));
+        }
+    }
+    writeResidual(out, residual);
+}
+
+/**
+ * Encode interleaved integer samples. Frame n uses subframe kind n % 3 and
+ * (for stereo) channel assignment n % 4: independent, left/side,
+ * side/right, mid/side. A SEEKTABLE with one point per 'seekEvery' frames
+ * is written when seekEvery > 0.
+ */
+inline bool writeFlac(const std::string& path, const std::vector<int32_t>& samples, int channels, int bps,
+                      uint32_t sampleRate, uint32_t blockSize = 4096, uint32_t seekEvery = 0) {
+    const uint64_t total = samples.size() / channels;
+    std::vector<uint8_t> frames;
+    std::vector<std::pair<uint64_t, uint64_t>> seekPoints;
+
+    for (uint64_t first = 0, number = 0; first < total; first += blockSize, ++number) {
+        const uint32_t n = static_cast<uint32_t>(std::min<uint64_t>(blockSize, total - first));
+        const int assignment = channels == 2 ? static_cast<int>(number % 4) : 0;
+        const Subframe kind = static_cast<Subframe>(number % 3);
+        if (seekEvery > 0 && number % seekEvery == 0) seekPoints.push_back({first, frames.size()});
+
+        BitWriter out;
+        out.write(0xFFF8, 16);
+        out.write(7, 4);                                    // 16-bit block size follows
+        out.write(sampleRate == 44100 ? 9 : 0, 4);
+        out.write(assignment == 0 ? channels - 1 : 7 + assignment, 4);
+        out.write(bps == 8 ? 1 : bps == 16 ? 4 : bps == 24 ? 6 : 0, 3);
+        out.write(0, 1);
+        writeUtf8(out, number);
+        out.write(n - 1, 16);
+        out.write(crc8(out.bytes), 8);
+
+        std::vector<std::vector<int64_t>> ch(channels, std::vector<int64_t>(n));
+        for (uint32_t i = 0; i < n; ++i) {
+            for (int c = 0; c < channels; ++c) ch[c][i] = samples[(first + i) * channels + c];
+        }
+        std::vector<int> widths(channels, bps);
+        if (assignment != 0) {
+            for (uint32_t i = 0; i < n; ++i) {
+                int64_t left = ch[0][i], right = ch[1][i];
+                if (assignment == 1) { ch[1][i] = left - right; }
+                else if (assignment == 2) { ch[0][i] = left - right; }
+                else { ch[0][i] = (left + right) >> 1; ch[1][i] = left - right; }
+            }
+            widths[assignment == 2 ? 0 : 1] = bps + 1;
+        }
+        for (int c = 0; c < channels; ++c) writeSubframe(out, ch[c], widths[c], kind);
+        out.align();
+        const uint16_t crc = crc16(out.bytes);
+        out.write(crc, 16);
+        frames.insert(frames.end(), out.bytes.begin(), out.bytes.end());
+    }
+
+    BitWriter header;
+    header.bytes = {'f', 'L', 'a', 'C'};
+    header.write(seekPoints.empty() ? 0x80 : 0x00, 8);
+    header.write(34, 24);
+    header.write(blockSize, 16);
+    header.write(blockSize, 16);
+    header.write(0, 24);
+    header.write(0, 24);
+    header.write(sampleRate, 20);
+    header.write(channels - 1, 3);
+    header.write(bps - 1, 5);
+    header.write(total, 36);
+    for (int i = 0; i < 16; ++i) header.write(0, 8);        // MD5 not computed
+    if (!seekPoints.empty()) {
+        header.write(0x80 | 3, 8);
+        header.write(seekPoints.size() * 18, 24);
+        for (const auto& point : seekPoints) {
+            header.write(point.first, 64);
+            header.write(point.second, 64);
+            header.write(blockSize, 16);
+        }
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(header.bytes.data()), static_cast<std::streamsize>(header.bytes.size()));
+    file.write(reinterpret_cast<const char*>(frames.data()), static_cast<std::streamsize>(frames.size()));
+    return static_cast<bool>(file);
+}
+
+} // namespace flactest
+
+#endif // FLAC_TEST_ENCODER_H
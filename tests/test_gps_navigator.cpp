@@ -5,10 +5,13 @@
 
 #include "GPSNavigator.h"
 #include "NotificationManager.h"
+#include "NmeaParser.h"
+#include "VehicleDataFeed.h"
 #include <iostream>
 #include <cassert>
 #include <memory>
 #include <cmath>
+#include <vector>
 
 class GPSNavigatorTest {
 private:
@@ -160,6 +163,84 @@ public:
         std::cout << "✅ Speed and heading update tests passed" << std::endl;
     }
     
+    void testVoicePrompts() {
+        std::cout << "🧪 Testing voice prompts..." << std::endl;
+        
+        gps->updateGPSSignal(8, 3.0);
+        std::vector<VoicePrompt> spoken;
+        gps->setVoicePromptHandler([&spoken](VoicePrompt prompt) { spoken.push_back(prompt); });
+        
+        gps->updateLocation(GPSCoordinate(37.7749, -122.4194));
+        gps->setDestination(GPSCoordinate(37.7750, -122.4195), "Nearby");
+        gps->startNavigation();
+        gps->updateLocation(GPSCoordinate(37.7750, -122.4195));
+        gps->updateGPSSignal(2, 15.0);
+        gps->updateGPSSignal(8, 3.0);
+        
+        assertTrue(spoken.size() == 4, "Four prompts should be spoken");
+        assertTrue(spoken[0] == VoicePrompt::NAVIGATION_STARTED, "Navigation start should be announced");
+        assertTrue(spoken[1] == VoicePrompt::DESTINATION_REACHED, "Arrival should be announced");
+        assertTrue(spoken[2] == VoicePrompt::GPS_SIGNAL_LOST, "Signal loss should be announced");
+        assertTrue(spoken[3] == VoicePrompt::GPS_SIGNAL_RESTORED, "Signal recovery should be announced");
+        
+        gps->setVoicePromptHandler(nullptr);
+        std::cout << "✅ Voice prompt tests passed" << std::endl;
+    }
+    
+    void testNmeaParsing() {
+        std::cout << "🧪 Testing NMEA sentence parsing..." << std::endl;
+        NmeaFix fix;
+
+        // RMC: position, knots and course; 4807.038 N = 48° 7.038'
+        assertTrue(NmeaParser::parse("$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A", fix),
+                   "Valid RMC sentence should parse");
+        assertTrue(fix.hasPosition && fix.hasMotion && !fix.hasQuality, "RMC should carry position and motion");
+        assertEqual(48.1173, fix.latitude, 0.0001);
+        assertEqual(11.516667, fix.longitude, 0.0001);
+        assertEqual(22.4 * NmeaParser::KNOTS_TO_KMH, fix.speedKmh);
+        assertEqual(84.4, fix.course);
+
+        // GGA: fix quality and altitude from any talker
+        assertTrue(NmeaParser::parse("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47  ", fix),
+                   "Valid GGA sentence should parse");
+        assertTrue(fix.hasPosition && fix.hasAltitude && fix.hasQuality, "GGA should carry position and quality");
+        assertTrue(fix.satellites == 8, "GGA satellite count should be read");
+        assertEqual(0.9 * NmeaParser::METERS_PER_HDOP, fix.accuracy);
+        assertEqual(545.4, fix.altitude);
+
+        // No fix: accepted, but nothing to apply except the satellite count
+        assertTrue(NmeaParser::parse("$GNRMC,000001,V,,,,,,,010124,,,N*4A", fix) && !fix.hasPosition,
+                   "Void RMC should parse without a position");
+        assertTrue(NmeaParser::parse("$GPGGA,000001,,,,,0,03,9.9,,,,,,*4A", fix) && !fix.hasPosition &&
+                   fix.hasQuality && fix.satellites == 3,
+                   "GGA without a fix should still report satellites");
+
+        // Damaged or unsupported sentences are rejected
+        assertTrue(!NmeaParser::parse("$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6B", fix),
+                   "Bad checksum should be rejected");
+        assertTrue(!NmeaParser::parse("$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W", fix),
+                   "Missing checksum should be rejected");
+        assertTrue(!NmeaParser::parse("$GPGSV,1,1,00*79", fix), "Unsupported sentence should be rejected");
+
+        // The feed applies fixes to the navigator and counts what it saw
+        auto monitor = std::make_shared<VehicleMonitor>(notificationManager);
+        VehicleDataFeed feed(monitor, gps);
+        assertTrue(feed.apply(FeedFormat::NMEA, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47") &&
+                   feed.apply(FeedFormat::NMEA, "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A"),
+                   "Feed should apply valid sentences");
+        assertTrue(!feed.apply(FeedFormat::NMEA, "garbage"), "Feed should reject garbage");
+        assertTrue(feed.apply(FeedFormat::NMEA, "   "), "Blank lines should be ignored");
+        assertEqual(48.1173, gps->getCurrentLocation().latitude, 0.0001);
+        assertEqual(545.4, gps->getCurrentLocation().altitude);
+        assertEqual(22.4 * NmeaParser::KNOTS_TO_KMH, gps->getCurrentSpeed());
+        assertEqual(84.4, gps->getCurrentHeading());
+        assertTrue(gps->getSatelliteCount() == 8 && gps->isGPSSignalAvailable(), "Fix quality should be applied");
+        const FeedCounters& counters = feed.getCounters(FeedFormat::NMEA);
+        assertTrue(counters.lines == 3 && counters.rejected == 1, "Feed should count lines and rejects");
+
+        std::cout << "✅ NMEA parsing tests passed" << std::endl;
+    }
+    
     void runAllTests() {
         std::cout << "\n🧪 === RUNNING GPS NAVIGATOR TESTS ===" << std::endl;
         std::cout << std::string(45, '=') << std::endl;
@@ -171,6 +252,8 @@ public:
         testGPSSignalHandling();
         testWaypointManagement();
         testSpeedAndHeadingUpdates();
+        testVoicePrompts();
+        testNmeaParsing();
         
         std::cout << std::string(45, '=') << std::endl;
         std::cout << "🎉 All GPS Navigator tests passed!" << std::endl;
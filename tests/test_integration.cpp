@@ -8,9 +8,30 @@
 #include "MediaPlayer.h"
 #include "SystemSettings.h"
 #include "NotificationManager.h"
+#include "MessageCatalog.h"
+#include "BinaryIO.h"
+#include "EventLoop.h"
+#include "EventQueue.h"
+#include "VehicleEvents.h"
+#include "HeadlessDaemon.h"
+#include "TaskScheduler.h"
 #include <iostream>
 #include <memory>
 #include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <sstream>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <csignal>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 class IntegrationTest {
 private:
@@ -160,6 +181,438 @@ public:
         std::cout << "✅ Error handling tests passed" << std::endl;
     }
     
+    void testMessageCatalog() {
+        std::cout << "🧪 Testing localized message catalog..." << std::endl;
+        const std::string catalogFile = "test_messages.bin";
+        MessageCatalog& catalog = MessageCatalog::instance();
+
+        assertTrue(MessageCatalog::compile("locale", catalogFile), "Shipped locale sources should compile");
+        assertTrue(catalog.load(catalogFile), "Compiled catalog should load");
+
+        // Language changes reach components through the settings subscription
+        auto subscription = systemSettings->subscribe({SettingKey::LANGUAGE}, [](const SettingsChange& change) {
+            MessageCatalog::instance().setLanguage(static_cast<size_t>(change.current.language));
+        });
+        systemSettings->setLanguage(Language::GERMAN);
+        gpsNavigator->stopNavigation();
+        assertTrue(notificationManager->getLatestMessage() == "Navigation beendet",
+                   "GPS notifications should follow the language setting");
+        vehicleMonitor->setCurrentSpeed(130.0);
+        assertTrue(notificationManager->getLatestMessage() ==
+                   "Geschwindigkeitsbegrenzung überschritten! Aktuell: 130.0 km/h (Limit: 120 km/h)",
+                   "Vehicle notifications should be formatted in the current language");
+        vehicleMonitor->setCurrentSpeed(60.0);
+
+        systemSettings->setLanguage(Language::ENGLISH);
+        gpsNavigator->stopNavigation();
+        assertTrue(notificationManager->getLatestMessage() == "Navigation stopped",
+                   "Switching back should restore English");
+        systemSettings->unsubscribe(subscription);
+
+        // Messages a translation lacks fall back to English
+        const std::string localeDir = "test_locale";
+        std::filesystem::create_directories(localeDir);
+        writeFileContents(localeDir + "/es.txt", "# partial\nGPS_SIGNAL_LOST=¡Señal GPS perdida!\n");
+        assertTrue(MessageCatalog::compile(localeDir, catalogFile) && catalog.load(catalogFile),
+                   "Partial catalog should compile and load");
+        catalog.setLanguage(static_cast<size_t>(Language::SPANISH));
+        assertTrue(std::string(catalog.text(MessageId::GPS_SIGNAL_LOST)) == "¡Señal GPS perdida!",
+                   "Translated message should be used");
+        assertTrue(catalog.text(MessageId::GPS_SIGNAL_RESTORED) ==
+                   std::string(MessageCatalog::englishText(MessageId::GPS_SIGNAL_RESTORED)),
+                   "Missing message should fall back to English");
+
+        writeFileContents(localeDir + "/es.txt", "NO_SUCH_MESSAGE=x\n");
+        assertTrue(!MessageCatalog::compile(localeDir, "test_messages_bad.bin"), "Unknown message name should be rejected");
+
+        // A damaged catalog is rejected and the loaded text stays in use
+        std::string contents;
+        readFileContents(catalogFile, contents);
+        contents[contents.size() / 2] ^= 0x20;
+        writeFileContents(catalogFile, contents);
+        assertTrue(!catalog.load(catalogFile), "Damaged catalog should be rejected");
+        assertTrue(std::string(catalog.text(MessageId::GPS_SIGNAL_LOST)) == "¡Señal GPS perdida!",
+                   "Rejected catalog should keep the previous text");
+
+        catalog.setLanguage(static_cast<size_t>(Language::ENGLISH));
+        std::filesystem::remove_all(localeDir);
+        std::remove(catalogFile.c_str());
+        std::remove("test_messages_bad.bin");
+
+        std::cout << "✅ Message catalog tests passed" << std::endl;
+    }
+    
+    void testEventLoop() {
+        std::cout << "🧪 Testing event loop..." << std::endl;
+        using std::chrono::milliseconds;
+        EventLoop loop;
+
+        // Timers fire repeatedly and stop once removed
+        int fastTicks = 0;
+        int slowTicks = 0;
+        EventLoop::SourceId fast = loop.addTimer(milliseconds(5), [&]() { ++fastTicks; });
+        loop.addTimer(milliseconds(40), [&]() { ++slowTicks; });
+        assertTrue(fast != 0, "Timer should be created");
+        const auto until = std::chrono::steady_clock::now() + milliseconds(100);
+        while (std::chrono::steady_clock::now() < until) loop.runOnce(milliseconds(10));
+        assertTrue(fastTicks >= 3 && slowTicks >= 1 && fastTicks > slowTicks, "Timers should fire at their own rates");
+        assertTrue(loop.removeSource(fast), "Timer should be removable");
+        assertTrue(!loop.removeSource(fast), "Removed timer should be gone");
+        const int ticksAfterRemoval = fastTicks;
+        loop.runOnce(milliseconds(50));
+        assertTrue(fastTicks == ticksAfterRemoval, "Removed timer should not fire");
+
+        // Tasks posted from another thread run on the loop, and stop() ends run()
+        int tasksRun = 0;
+        std::thread poster([&loop, &tasksRun]() {
+            for (int i = 0; i < 3; ++i) loop.post([&tasksRun]() { ++tasksRun; });
+            loop.post([&loop]() { loop.stop(); });
+        });
+        loop.run();
+        poster.join();
+        assertTrue(tasksRun == 3, "Posted tasks should run before the stop task");
+
+#if defined(__linux__)
+        // Descriptor input arrives as lines, partial lines are held back,
+        // and a timer keeps firing while no input is available
+        assertTrue(EventLoop::supportsDescriptors(), "Linux should support descriptor sources");
+        int fds[2];
+        assertTrue(pipe(fds) == 0, "Pipe should be created");
+        std::vector<std::string> lines;
+        bool closed = false;
+        assertTrue(loop.addLineReader(fds[0], [&](std::string_view line) { lines.emplace_back(line); },
+                                      [&]() { closed = true; }) != 0,
+                   "Pipe should be watchable");
+        const std::string input = "speed 72\r\nfuel 40\npartial";
+        assertTrue(write(fds[1], input.data(), input.size()) == static_cast<ssize_t>(input.size()), "Write should succeed");
+        loop.runOnce(milliseconds(100));
+        assertTrue(lines.size() == 2 && lines[0] == "speed 72" && lines[1] == "fuel 40", "Complete lines should be delivered");
+        slowTicks = 0;
+        while (slowTicks < 2) loop.runOnce(milliseconds(100));
+        assertTrue(lines.size() == 2, "Idle reader should not block the timer");
+        close(fds[1]);
+        while (!closed) loop.runOnce(milliseconds(100));
+        assertTrue(lines.size() == 3 && lines[2] == "partial", "Pending text should be delivered at end of input");
+        close(fds[0]);
+#else
+        assertTrue(loop.addReader(0, []() {}) == 0, "Descriptor sources should be reported unsupported");
+#endif
+
+        // Periodic simulation settles instead of drifting into alerts
+        std::ostringstream quiet;
+        std::streambuf* original = std::cout.rdbuf(quiet.rdbuf());
+        VehicleMonitor simulated(notificationManager);
+        double hottest = 0.0;
+        double fastest = 0.0;
+        for (int second = 0; second < 3600; ++second) {
+            simulated.simulateRealTimeUpdate();
+            hottest = std::max(hottest, simulated.getEngineTemperature());
+            fastest = std::max(fastest, simulated.getCurrentSpeed());
+        }
+        std::cout.rdbuf(original);
+        assertTrue(hottest < 100.0, "Simulated engine should not overheat over an hour");
+        assertTrue(fastest < 120.0, "Simulated speed should stay under the limit over an hour");
+        assertTrue(simulated.getFuelLevel() > 60.0, "An hour of simulation should use a plausible amount of fuel");
+        simulated.setSpeedSimulation(false);
+        simulated.setCurrentSpeed(42.0);
+        simulated.simulateRealTimeUpdate();
+        assertTrue(simulated.getCurrentSpeed() == 42.0, "Speed fed from elsewhere should not be simulated over");
+
+        std::cout << "✅ Event loop tests passed" << std::endl;
+    }
+
+    void testEventBus() {
+        std::cout << "🧪 Testing event bus..." << std::endl;
+        VehicleEventBus bus;
+
+        // Handlers receive only their own event type, in subscription order
+        std::vector<std::string> received;
+        bus.subscribe<SpeedChangedEvent>([&](const SpeedChangedEvent& event) {
+            received.push_back("a" + std::to_string(static_cast<int>(event.speedKmh)));
+        });
+        const auto second = bus.subscribe<SpeedChangedEvent>([&](const SpeedChangedEvent& event) {
+            received.push_back("b" + std::to_string(static_cast<int>(event.speedKmh)));
+        });
+        bus.publish(PositionChangedEvent{1.0, 2.0, 3.0});
+        assertTrue(received.empty(), "Speed handlers should not see position events");
+        bus.publish(SpeedChangedEvent{50.0});
+        assertTrue(received.size() == 2 && received[0] == "a50" && received[1] == "b50",
+                   "Every speed handler should run in order");
+        assertTrue(bus.subscriberCount<SpeedChangedEvent>() == 2, "Both speed handlers should be counted");
+
+        // A handler may unsubscribe another during delivery
+        received.clear();
+        bus.subscribe<PositionChangedEvent>([&](const PositionChangedEvent&) { bus.unsubscribe(second); });
+        bus.publish(PositionChangedEvent{1.0, 2.0, 3.0});
+        assertTrue(bus.subscriberCount<SpeedChangedEvent>() == 1, "Unsubscribe from a handler should take effect");
+        assertTrue(!bus.unsubscribe(second), "Handle should be gone");
+        bus.publish(SpeedChangedEvent{60.0});
+        assertTrue(received.size() == 1 && received[0] == "a60", "Removed handler should not run");
+
+        // Queued handlers run on the thread that drains their queue
+        EventQueue queue;
+        int wakeups = 0;
+        queue.setWakeup([&wakeups]() { ++wakeups; });
+        const std::thread::id consumer = std::this_thread::get_id();
+        std::vector<double> queuedSpeeds;
+        bool sameThread = true;
+        const auto queued = bus.subscribe<SpeedChangedEvent>([&](const SpeedChangedEvent& event) {
+            sameThread = sameThread && std::this_thread::get_id() == consumer;
+            queuedSpeeds.push_back(event.speedKmh);
+        }, &queue);
+        std::thread publisher([&bus]() {
+            for (int i = 1; i <= 100; ++i) bus.publish(SpeedChangedEvent{static_cast<double>(i)});
+        });
+        publisher.join();
+        assertTrue(queuedSpeeds.empty() && queue.size() == 100, "Queued events should wait for the consumer");
+        assertTrue(wakeups == 1, "A burst should wake the consumer once");
+        assertTrue(queue.drain() == 100, "Drain should run every queued event");
+        assertTrue(sameThread && queuedSpeeds.size() == 100 && queuedSpeeds.back() == 100.0,
+                   "Queued events should arrive in order on the draining thread");
+
+        // Events still queued when their handler unsubscribes are dropped
+        bus.publish(SpeedChangedEvent{1.0});
+        bus.unsubscribe(queued);
+        queue.drain();
+        assertTrue(queuedSpeeds.size() == 100, "Unsubscribed queued handler should not run");
+
+        // GPS speed reaches the vehicle monitor through the bus
+        std::ostringstream quiet;
+        std::streambuf* original = std::cout.rdbuf(quiet.rdbuf());
+        auto notifications = std::make_shared<NotificationManager>();
+        auto gps = std::make_shared<GPSNavigator>(notifications);
+        auto vehicle = std::make_shared<VehicleMonitor>(notifications);
+        gps->setEventBus(&bus);
+        int positions = 0;
+        bus.subscribe<PositionChangedEvent>([&positions](const PositionChangedEvent&) { ++positions; });
+        bus.subscribe<SpeedChangedEvent>([vehicle](const SpeedChangedEvent& event) {
+            vehicle->setCurrentSpeed(event.speedKmh);
+        });
+        gps->updateSpeed(88.0);
+        gps->updateLocation(GPSCoordinate(200.0, 0.0));
+        gps->updateLocation(GPSCoordinate(48.1, 11.6));
+        std::cout.rdbuf(original);
+        assertTrue(vehicle->getCurrentSpeed() == 88.0, "Vehicle speed should follow the GPS");
+        assertTrue(received.back() == "a88", "Other speed handlers should see the GPS update too");
+        assertTrue(positions == 1, "Only valid positions should be published");
+
+        // Settings transactions arrive as copies usable after the writer returns
+        SystemSettings settings(notifications);
+        SettingsChangedEvent lastSettings{};
+        bus.subscribe<SettingsChangedEvent>([&](const SettingsChangedEvent& event) { lastSettings = event; });
+        settings.subscribe({SettingKey::SYSTEM_VOLUME}, [&bus](const SettingsChange& change) {
+            bus.publish(SettingsChangedEvent{change.changed, change.previous, change.current});
+        });
+        original = std::cout.rdbuf(quiet.rdbuf());
+        const int oldVolume = settings.getSystemVolume();
+        settings.setSystemVolume(oldVolume == 30 ? 40 : 30);
+        std::cout.rdbuf(original);
+        assertTrue(lastSettings.contains(SettingKey::SYSTEM_VOLUME) && lastSettings.previous.systemVolume == oldVolume &&
+                   lastSettings.current.systemVolume == settings.getSystemVolume(),
+                   "Settings event should carry both snapshots");
+
+        std::cout << "✅ Event bus tests passed" << std::endl;
+    }
+
+    void testTaskScheduler() {
+        std::cout << "🧪 Testing task scheduler..." << std::endl;
+
+        // Owner pops newest first, thieves take oldest first, and every item
+        // is taken exactly once while the deque grows
+        WorkStealingDeque<int> deque;
+        std::vector<int> items(10000);
+        for (int i = 0; i < 3; ++i) deque.push(&items[i]);
+        assertTrue(deque.steal() == &items[0] && deque.pop() == &items[2], "Steal should take the oldest, pop the newest");
+        assertTrue(deque.pop() == &items[1] && deque.pop() == nullptr && deque.empty(), "Deque should end empty");
+        std::vector<std::atomic<int>> taken(items.size());
+        std::atomic<bool> pushing(true);
+        auto thief = [&]() {
+            while (pushing.load() || !deque.empty()) {
+                if (int* item = deque.steal()) taken[static_cast<size_t>(item - items.data())].fetch_add(1);
+            }
+        };
+        std::thread thief1(thief);
+        std::thread thief2(thief);
+        for (size_t i = 0; i < items.size(); ++i) {
+            deque.push(&items[i]);
+            if (i % 3 == 0) {
+                if (int* item = deque.pop()) taken[static_cast<size_t>(item - items.data())].fetch_add(1);
+            }
+        }
+        while (int* item = deque.pop()) taken[static_cast<size_t>(item - items.data())].fetch_add(1);
+        pushing.store(false);
+        thief1.join();
+        thief2.join();
+        bool exactlyOnce = true;
+        for (const auto& count : taken) exactlyOnce = exactlyOnce && count.load() == 1;
+        assertTrue(exactlyOnce, "Concurrent pop and steal should take every item exactly once");
+
+        // parallelFor covers the range once, including nested loops
+        TaskScheduler pool(3);
+        assertTrue(pool.getConcurrency() == 4, "Caller should count towards concurrency");
+        std::vector<std::atomic<int>> visits(100000);
+        pool.parallelFor(0, visits.size(), 1000, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) visits[i].fetch_add(1);
+        });
+        bool coveredOnce = true;
+        for (const auto& count : visits) coveredOnce = coveredOnce && count.load() == 1;
+        assertTrue(coveredOnce, "Every index should be visited exactly once");
+        std::atomic<size_t> nestedSum(0);
+        pool.parallelFor(0, 64, 1, [&](size_t begin, size_t end) {
+            for (size_t outer = begin; outer < end; ++outer) {
+                pool.parallelFor(0, 100, 10, [&](size_t b, size_t e) { nestedSum.fetch_add(e - b); });
+            }
+        });
+        assertTrue(nestedSum.load() == 6400, "Nested parallel loops should complete");
+
+        // Submissions from another thread all run
+        std::atomic<int> done(0);
+        std::thread submitter([&]() {
+            for (int i = 0; i < 1000; ++i) pool.submit([&done]() { done.fetch_add(1); });
+        });
+        submitter.join();
+        pool.waitIdle();
+        assertTrue(done.load() == 1000, "Every submitted task should run");
+
+        // Queued tasks start in priority order
+        TaskScheduler single(1);
+        std::atomic<bool> release(false);
+        std::mutex orderMutex;
+        std::string order;
+        auto record = [&](char tag) {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order += tag;
+        };
+        single.submit([&release]() { while (!release.load()) std::this_thread::yield(); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        single.submit([&]() { record('L'); }, TaskPriority::LOW);
+        single.submit([&]() { record('N'); }, TaskPriority::NORMAL);
+        single.submit([&]() { record('H'); }, TaskPriority::HIGH);
+        release.store(true);
+        for (int wait = 0; wait < 500; ++wait) {
+            {
+                std::lock_guard<std::mutex> lock(orderMutex);
+                if (order.size() == 3) break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        assertTrue(order == "HNL", "Higher priorities should run first");
+
+        // Without workers everything runs on the caller
+        TaskScheduler inline0(0);
+        bool ran = false;
+        inline0.submit([&ran]() { ran = true; });
+        assertTrue(ran, "Scheduler without workers should run tasks immediately");
+
+        std::cout << "✅ Task scheduler tests passed" << std::endl;
+    }
+
+    void testHeadlessDaemon() {
+        std::cout << "🧪 Testing headless daemon..." << std::endl;
+        DaemonOptions options;
+        std::string error;
+        const char* noInputs[] = {"vehicle_system", "--headless"};
+        assertTrue(!HeadlessDaemon::parseArguments(2, noInputs, options, error) && !error.empty(),
+                   "Daemon without inputs should be rejected");
+        const char* noHeadless[] = {"vehicle_system", "--nmea", "gps.log"};
+        assertTrue(!HeadlessDaemon::parseArguments(3, noHeadless, options, error), "Inputs need --headless");
+        const char* arguments[] = {"vehicle_system", "--headless", "--nmea", "test_gps.log", "--can", "test_can.log",
+                                   "--telemetry", "test_telemetry.log", "--alerts", "test_alerts.log",
+                                   "--state", "test_state.log", "--state-interval", "60000"};
+        assertTrue(HeadlessDaemon::parseArguments(14, arguments, options, error), "Daemon options should parse");
+        assertTrue(options.inputs.size() == 3 && options.inputs[1].format == FeedFormat::CAN &&
+                   options.stateInterval == std::chrono::milliseconds(60000),
+                   "Parsed options should match the command line");
+
+#if defined(__linux__)
+        // Replay recorded logs as fast as they parse; the daemon stops at their end
+        const int repeats = 2000;
+        std::string nmea, can, telemetry;
+        for (int i = 0; i < repeats; ++i) {
+            nmea += "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n";
+            nmea += "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A\r\n";
+            can += "(1700000000.000000) can0 7E8#03410582\n(1700000000.010000) can0 123#00\n";
+        }
+        can += "can0 7E8#03410D48\n";
+        telemetry = "fuel 40\n# comment\nspeed 130\nbogus 1\nspeed 72";
+        writeFileContents("test_gps.log", nmea);
+        writeFileContents("test_can.log", can);
+        writeFileContents("test_telemetry.log", telemetry);
+        std::remove("test_alerts.log");
+        std::remove("test_state.log");
+
+        auto daemonNotifications = std::make_shared<NotificationManager>();
+        auto daemonVehicle = std::make_shared<VehicleMonitor>(daemonNotifications);
+        auto daemonGps = std::make_shared<GPSNavigator>(daemonNotifications);
+        std::ostringstream console;
+        std::streambuf* original = std::cout.rdbuf(console.rdbuf());
+        int status = 0;
+        std::string report;
+        {
+            HeadlessDaemon daemon(options, daemonNotifications, daemonVehicle, daemonGps, nullptr);
+            status = daemon.run();
+            report = daemon.counterReport();
+            const FeedCounters& nmeaCounters = daemon.getFeed().getCounters(FeedFormat::NMEA);
+            const FeedCounters& canCounters = daemon.getFeed().getCounters(FeedFormat::CAN);
+            const FeedCounters& telemetryCounters = daemon.getFeed().getCounters(FeedFormat::TELEMETRY);
+            std::cout.rdbuf(original);
+            assertTrue(nmeaCounters.lines == 2u * repeats && nmeaCounters.rejected == 0, "Every NMEA line should be applied");
+            assertTrue(canCounters.lines == 2u * repeats + 1 && canCounters.rejected == 0, "Every CAN line should be applied");
+            assertTrue(telemetryCounters.lines == 4 && telemetryCounters.rejected == 1,
+                       "Telemetry comments should be skipped and unknown sensors rejected");
+        }
+        std::cout.rdbuf(original);
+        assertTrue(status == 0, "Replay should finish successfully");
+        assertTrue(console.str().empty(), "Headless alerts should not be rendered on the console");
+        assertTrue(report.find("nmea 4000 lines") != std::string::npos, "Report should include the NMEA count");
+        assertTrue(daemonVehicle->getCurrentSpeed() > 0.0 && daemonVehicle->getEngineTemperature() == 90.0,
+                   "Replayed CAN data should reach the vehicle monitor");
+        assertTrue(std::fabs(daemonGps->getCurrentLocation().latitude - 48.1173) < 0.0001,
+                   "Replayed NMEA data should reach the navigator");
+
+        std::string alerts, states;
+        readFileContents("test_alerts.log", alerts);
+        readFileContents("test_state.log", states);
+        assertTrue(alerts.find("\tWARNING\tSpeed limit exceeded! Current: 130.0 km/h") != std::string::npos,
+                   "Alerts should be written to the alert sink");
+        assertTrue(states.find("\tSTATE\t") != std::string::npos && states.find("fuel=40.0") != std::string::npos,
+                   "A final state record should be written");
+
+        // A FIFO input runs until a stop signal arrives
+        HeadlessDaemon::blockSignals();
+        const char* fifoPath = "test_daemon.fifo";
+        std::remove(fifoPath);
+        assertTrue(mkfifo(fifoPath, 0600) == 0, "FIFO should be created");
+        DaemonOptions live;
+        live.inputs.push_back(DaemonInput{FeedFormat::TELEMETRY, fifoPath});
+        live.alertSink.clear();
+        auto liveVehicle = std::make_shared<VehicleMonitor>(daemonNotifications);
+        HeadlessDaemon liveDaemon(live, daemonNotifications, liveVehicle, daemonGps, nullptr);
+        std::thread sender([fifoPath]() {
+            std::FILE* fifo = std::fopen(fifoPath, "w");
+            if (fifo != nullptr) {
+                std::fputs("engine_temp 97\n", fifo);
+                std::fclose(fifo);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            kill(getpid(), SIGUSR1);
+            kill(getpid(), SIGTERM);
+        });
+        status = liveDaemon.run();
+        sender.join();
+        assertTrue(status == 0 && liveVehicle->getEngineTemperature() == 97.0,
+                   "FIFO input should be applied until SIGTERM");
+        std::remove(fifoPath);
+        std::remove("test_gps.log");
+        std::remove("test_can.log");
+        std::remove("test_telemetry.log");
+        std::remove("test_alerts.log");
+        std::remove("test_state.log");
+#endif
+
+        std::cout << "✅ Headless daemon tests passed" << std::endl;
+    }
+
     void runAllTests() {
         std::cout << "\n🧪 === RUNNING INTEGRATION TESTS ===" << std::endl;
         std::cout << std::string(45, '=') << std::endl;
@@ -169,6 +622,11 @@ public:
         testVehicleGPSIntegration();
         testCompleteSystemScenario();
         testErrorHandling();
+        testMessageCatalog();
+        testEventLoop();
+        testEventBus();
+        testTaskScheduler();
+        testHeadlessDaemon();
         
         std::cout << std::string(45, '=') << std::endl;
         std::cout << "🎉 All integration tests passed!" << std::endl;
@@ -0,0 +1,948 @@
+/**
+ * @file test_media_player.cpp
+ * @brief Unit tests for MediaPlayer class
+ */
+
+#include "MediaPlayer.h"
+#include "PlaybackQueue.h"
+#include "AudioDSP.h"
+#include "AudioFocusManager.h"
+#include "PromptClipCache.h"
+#include "ArtworkCache.h"
+#include "ArtworkExtractor.h"
+#include "WavDecoder.h"
+#include "FlacDecoder.h"
+#include "FlacTestEncoder.h"
+#include "SeekIndex.h"
+#include "PlayStatistics.h"
+#include "MetadataNormalizer.h"
+#include "BinaryIO.h"
+#include "NotificationManager.h"
+#include <iostream>
+#include <cassert>
+#include <memory>
+#include <set>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+class MediaPlayerTest {
+private:
+    std::shared_ptr<NotificationManager> notificationManager;
+    std::shared_ptr<MediaPlayer> player;
+
+    void assertTrue(bool condition, const std::string& message) {
+        if (!condition) {
+            std::cout << "❌ FAIL: " << message << std::endl;
+            throw std::runtime_error("Test assertion failed: " + message);
+        }
+    }
+
+    // Test picture payload: u16 width, u16 height, then RGB bytes
+    static std::vector<uint8_t> makeRawPicture(int width, int height, uint8_t seed) {
+        std::vector<uint8_t> data = {static_cast<uint8_t>(width & 0xFF), static_cast<uint8_t>(width >> 8),
+                                     static_cast<uint8_t>(height & 0xFF), static_cast<uint8_t>(height >> 8)};
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                data.push_back(static_cast<uint8_t>(x + seed));
+                data.push_back(static_cast<uint8_t>(y + seed));
+                data.push_back(seed);
+            }
+        }
+        return data;
+    }
+
+    static bool decodeRawPicture(const EmbeddedArtwork& artwork, DecodedImage& image) {
+        if (artwork.mimeType != "image/x-test-rgb" || artwork.data.size() < 4) return false;
+        image.width = artwork.data[0] | (artwork.data[1] << 8);
+        image.height = artwork.data[2] | (artwork.data[3] << 8);
+        image.rgb.assign(artwork.data.begin() + 4, artwork.data.end());
+        return image.rgb.size() == static_cast<size_t>(image.width) * image.height * 3;
+    }
+
+    static void writeFlacWithPicture(const std::string& path, const std::vector<uint8_t>& picture) {
+        std::vector<uint8_t> block;
+        auto be32 = [&block](uint32_t v) {
+            for (int shift = 24; shift >= 0; shift -= 8) block.push_back(static_cast<uint8_t>(v >> shift));
+        };
+        const std::string mime = "image/x-test-rgb";
+        be32(ArtworkExtractor::FRONT_COVER);
+        be32(static_cast<uint32_t>(mime.size()));
+        block.insert(block.end(), mime.begin(), mime.end());
+        be32(0);
+        for (int i = 0; i < 4; ++i) be32(0);
+        be32(static_cast<uint32_t>(picture.size()));
+        block.insert(block.end(), picture.begin(), picture.end());
+
+        std::ofstream file(path, std::ios::binary);
+        const char streamInfo[4] = {0x00, 0x00, 0x00, 34};
+        file.write("fLaC", 4);
+        file.write(streamInfo, 4);
+        file.write(std::string(34, '\0').data(), 34);
+        const char pictureHeader[4] = {static_cast<char>(0x80 | 6), static_cast<char>(block.size() >> 16),
+                                       static_cast<char>(block.size() >> 8), static_cast<char>(block.size())};
+        file.write(pictureHeader, 4);
+        file.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(block.size()));
+    }
+
+    // Stereo 16-bit WAV whose left channel encodes the frame number (mod 32768)
+    static void writeRampWav(const std::string& path, uint32_t frames) {
+        std::ofstream file(path, std::ios::binary);
+        auto le32 = [&file](uint32_t v) { for (int i = 0; i < 4; ++i) file.put(static_cast<char>(v >> (8 * i))); };
+        auto le16 = [&file](uint16_t v) { file.put(static_cast<char>(v)); file.put(static_cast<char>(v >> 8)); };
+        file.write("RIFF", 4);
+        le32(36 + 8 + frames * 4 + 8);
+        file.write("WAVE", 4);
+        file.write("fmt ", 4);
+        le32(16);
+        le16(1);
+        le16(2);
+        le32(AUDIO_SAMPLE_RATE);
+        le32(AUDIO_SAMPLE_RATE * 4);
+        le16(4);
+        le16(16);
+        file.write("LIST", 4);          // unrelated chunk before the data must be skipped
+        le32(0);
+        file.write("data", 4);
+        le32(frames * 4);
+        for (uint32_t f = 0; f < frames; ++f) {
+            le16(static_cast<uint16_t>(f % 32768));
+            le16(static_cast<uint16_t>(-static_cast<int16_t>(f % 32768)));
+        }
+    }
+
+public:
+    MediaPlayerTest() {
+        notificationManager = std::make_shared<NotificationManager>();
+        player = std::make_shared<MediaPlayer>(notificationManager);
+    }
+
+    void testSequentialNavigation() {
+        std::cout << "🧪 Testing sequential track navigation..." << std::endl;
+
+        player->loadDemoPlaylist();
+        assertTrue(player->getCurrentTrackIndex() == 0, "Playlist should start at first track");
+
+        player->nextTrack();
+        player->nextTrack();
+        assertTrue(player->getCurrentTrackIndex() == 2, "Two skips should land on third track");
+
+        player->previousTrack();
+        assertTrue(player->getCurrentTrackIndex() == 1, "Previous should return to second track");
+
+        player->loadDemoPlaylist();
+        player->previousTrack();
+        assertTrue(player->getCurrentTrackIndex() == 13, "Previous from first track should wrap to last");
+
+        player->nextTrack();
+        assertTrue(player->getCurrentTrackIndex() == 0, "Next should replay forward history");
+
+        std::cout << "✅ Sequential navigation tests passed" << std::endl;
+    }
+
+    void testShuffleVisitsEveryTrack() {
+        std::cout << "🧪 Testing shuffle permutation..." << std::endl;
+
+        PlaybackQueue queue(42);
+        const size_t count = 1000;
+        queue.reset(count, 7);
+        queue.setShuffle(true);
+        queue.setRepeatMode(RepeatMode::OFF);
+
+        std::set<size_t> seen;
+        seen.insert(queue.current());
+        size_t index = 0;
+        while (queue.next(true, index)) {
+            assertTrue(seen.insert(index).second, "Shuffle should not repeat a track within a cycle");
+        }
+        assertTrue(seen.size() == count, "Shuffle cycle should visit every track exactly once");
+
+        std::cout << "✅ Shuffle permutation tests passed" << std::endl;
+    }
+
+    void testHistoryAndQueue() {
+        std::cout << "🧪 Testing history and play-next queue..." << std::endl;
+
+        PlaybackQueue queue(7);
+        queue.reset(100, 0);
+        queue.setShuffle(true);
+
+        size_t first = 0, second = 0, back = 0, forward = 0;
+        queue.next(false, first);
+        queue.next(false, second);
+        assertTrue(queue.previous(back) && back == first, "Previous should return the earlier shuffle pick");
+        assertTrue(queue.next(false, forward) && forward == second, "Next should replay the same shuffle pick");
+
+        queue.enqueue(50);
+        queue.playNext(60);
+        size_t queued = 0;
+        queue.next(false, queued);
+        assertTrue(queued == 60, "Play-next should jump ahead of the queue");
+        queue.next(false, queued);
+        assertTrue(queued == 50, "Queued track should follow");
+        assertTrue(queue.getQueueLength() == 0, "Queue should be drained");
+
+        std::cout << "✅ History and queue tests passed" << std::endl;
+    }
+
+    void testRepeatModes() {
+        std::cout << "🧪 Testing repeat modes..." << std::endl;
+
+        player->loadDemoPlaylist();
+        player->play();
+
+        player->setRepeatMode(RepeatMode::ONE);
+        player->trackFinished();
+        assertTrue(player->getCurrentTrackIndex() == 0, "Repeat one should replay the current track");
+
+        player->nextTrack();
+        assertTrue(player->getCurrentTrackIndex() == 1, "Manual skip should ignore repeat one");
+
+        player->setRepeatMode(RepeatMode::OFF);
+        for (int i = 0; i < 12; ++i) player->nextTrack();
+        assertTrue(player->getCurrentTrackIndex() == 13, "Should be on last track");
+        player->trackFinished();
+        assertTrue(player->getState() == PlayerState::STOPPED, "Playback should stop at the end with repeat off");
+
+        player->setRepeatMode(RepeatMode::ALL);
+        player->play();
+        player->trackFinished();
+        assertTrue(player->getCurrentTrackIndex() == 0, "Repeat all should wrap to the first track");
+        assertTrue(player->getState() == PlayerState::PLAYING, "Repeat all should keep playing");
+
+        std::cout << "✅ Repeat mode tests passed" << std::endl;
+    }
+
+    void testDspChain() {
+        std::cout << "🧪 Testing DSP chain..." << std::endl;
+
+        AudioDSP dsp;
+        dsp.setVolume(100);
+        dsp.reset();
+        std::vector<float> block(2 * AudioDSP::RAMP_FRAMES * AUDIO_CHANNELS, 1.0f);
+        dsp.process(block.data(), 2 * AudioDSP::RAMP_FRAMES);
+        assertTrue(std::fabs(block.back() - 1.0f) < 1e-6f, "Full volume with flat EQ should be transparent");
+
+        dsp.setVolume(50);
+        std::fill(block.begin(), block.end(), 1.0f);
+        dsp.process(block.data(), 2 * AudioDSP::RAMP_FRAMES);
+        assertTrue(block[0] > 0.99f, "Ramp should start from the previous gain");
+        assertTrue(block[AudioDSP::RAMP_FRAMES] < block[0], "Gain should decrease along the ramp");
+        assertTrue(std::fabs(block.back() - 0.25f) < 1e-6f, "Ramp should settle on the new gain");
+        for (size_t i = 2; i < AudioDSP::RAMP_FRAMES * AUDIO_CHANNELS; i += 2) {
+            assertTrue(block[i] <= block[i - 2] + 1e-7f, "Ramp should be monotonic");
+        }
+
+        dsp.setEqBand(0, 6.0f);
+        assertTrue(dsp.getEqBand(0) == 6.0f, "EQ band gain should be stored");
+        dsp.setEqBand(1, 40.0f);
+        assertTrue(dsp.getEqBand(1) == AudioDSP::MAX_EQ_GAIN_DB, "EQ band gain should be clamped");
+
+        std::vector<float> a(8, 0.0f), b(8, 1.0f), out(8);
+        AudioDSP::crossfade(a.data(), b.data(), out.data(), 4, 2, 0.0f, 1.0f);
+        assertTrue(out[0] == 0.0f && out[1] == 0.0f, "Crossfade should start on the outgoing track");
+        assertTrue(std::fabs(out[6] - 0.75f) < 1e-6f, "Crossfade should ramp towards the incoming track");
+
+        player->loadDemoPlaylist();
+        player->stop();
+        std::vector<float> output(256 * AUDIO_CHANNELS, 1.0f);
+        player->renderAudio(output.data(), 256);
+        assertTrue(output[0] == 0.0f && output.back() == 0.0f, "Stopped player should render silence");
+
+        std::cout << "✅ DSP chain tests passed" << std::endl;
+    }
+
+    void testPromptDucking() {
+        std::cout << "🧪 Testing voice prompt ducking..." << std::endl;
+
+        auto cache = std::make_shared<PromptClipCache>();
+        assertTrue(cache->preload("") == 0, "No prompt files should be loaded from an empty directory");
+        PromptClip clip = cache->get(VoicePrompt::DESTINATION_REACHED);
+        assertTrue(clip.samples != nullptr && clip.frames > 0, "Missing prompts should fall back to a chime");
+
+        AudioFocusManager focus(nullptr, cache);
+        std::vector<float> out(AudioFocusManager::ATTACK_FRAMES * AUDIO_CHANNELS);
+        focus.mix(out.data(), AudioFocusManager::ATTACK_FRAMES);
+        assertTrue(!focus.isPromptActive() && focus.getDuckGain() == 1.0f, "Mixer should idle without prompts");
+
+        assertTrue(focus.requestPrompt(VoicePrompt::DESTINATION_REACHED), "Prompt should be queued");
+        assertTrue(focus.isPromptActive(), "Queued prompt should count as active before it is mixed");
+        focus.mix(out.data(), AudioFocusManager::ATTACK_FRAMES - 1);
+        assertTrue(focus.isPromptActive(), "Prompt should stay active once taken from the queue");
+        assertTrue(focus.getDuckGain() > AudioFocusManager::DUCK_GAIN, "Duck attack should not finish early");
+        focus.mix(out.data(), 1);
+        assertTrue(focus.getDuckGain() <= AudioFocusManager::DUCK_GAIN, "Duck attack should finish on its last frame");
+
+        std::vector<float> tail((clip.frames + AudioFocusManager::RELEASE_FRAMES) * AUDIO_CHANNELS);
+        focus.mix(tail.data(), clip.frames + AudioFocusManager::RELEASE_FRAMES);
+        assertTrue(!focus.isPromptActive() && focus.getDuckGain() == 1.0f, "Media should be fully restored after release");
+
+        for (size_t i = 0; i < AudioFocusManager::PROMPT_QUEUE_SIZE; ++i) {
+            focus.requestPrompt(VoicePrompt::GPS_SIGNAL_LOST);
+        }
+        assertTrue(!focus.requestPrompt(VoicePrompt::GPS_SIGNAL_LOST), "Full prompt queue should drop requests");
+
+        std::cout << "✅ Voice prompt ducking tests passed" << std::endl;
+    }
+
+    void testPlaylistEditing() {
+        std::cout << "🧪 Testing playlist editing..." << std::endl;
+
+        player->loadDemoPlaylist();
+        player->nextTrack();
+        player->nextTrack();
+        TrackId current = player->getLibrary().findByPath("");
+        assertTrue(current == INVALID_TRACK_ID, "Demo tracks have no file path");
+
+        const Track* playing = player->getCurrentTrack();
+        assertTrue(player->moveTrack(2, 10), "Move should succeed");
+        assertTrue(player->getCurrentTrack() == playing && player->getCurrentTrackIndex() == 10,
+                   "Current track should follow a move");
+        assertTrue(player->moveTrack(0, 13), "Move across current should succeed");
+        assertTrue(player->getCurrentTrackIndex() == 9, "Current index should shift after moving an earlier entry");
+
+        assertTrue(player->insertTrack(0, 0), "Insert of a library track should succeed");
+        assertTrue(player->getPlaylistSize() == 15 && player->getCurrentTrackIndex() == 10,
+                   "Insert before current should shift current");
+        assertTrue(player->removeTrack(0), "Remove should succeed");
+        assertTrue(player->getCurrentTrack() == playing, "Current track should survive removal of another entry");
+        assertTrue(!player->removeTrack(99), "Out-of-range remove should fail");
+        assertTrue(!player->insertTrack(0, 9999), "Unknown track ID should be rejected");
+
+        std::cout << "✅ Playlist editing tests passed" << std::endl;
+    }
+
+    void testPlaylistPersistence() {
+        std::cout << "🧪 Testing playlist persistence..." << std::endl;
+
+        const std::string libraryFile = "test_library.bin";
+        const std::string playlistFile = "test_playlist.bin";
+        const std::string m3uFile = "test_playlist.m3u8";
+
+        MediaLibrary library;
+        Playlist big("Road Trip");
+        for (TrackId i = 0; i < 100; ++i) {
+            Track track("Song " + std::to_string(i), "Artist", "Album", 180 + static_cast<int>(i));
+            track.filePath = "/media/usb/song" + std::to_string(i) + ".flac";
+            library.addTrack(track);
+        }
+        for (size_t i = 0; i < 10000; ++i) {
+            big.append(static_cast<TrackId>((i * 37) % library.size()));
+        }
+        assertTrue(library.save(libraryFile) && big.save(playlistFile), "Library and playlist should save");
+
+        MediaLibrary reloadedLibrary;
+        Playlist reloaded;
+        assertTrue(reloadedLibrary.load(libraryFile), "Library should load");
+        assertTrue(reloadedLibrary.size() == 100 && reloadedLibrary.getTrack(42)->duration == 222,
+                   "Library contents should round-trip");
+        assertTrue(reloaded.load(playlistFile, reloadedLibrary), "Playlist should load");
+        assertTrue(reloaded.getEntries() == big.getEntries() && reloaded.getName() == "Road Trip",
+                   "Playlist should round-trip exactly");
+
+        MediaLibrary tooSmall;
+        tooSmall.addTrack(Track("Only", "One", "Track", 1));
+        assertTrue(!reloaded.load(playlistFile, tooSmall), "IDs outside the library should be rejected");
+
+        assertTrue(big.exportM3U8(m3uFile, library), "M3U8 export should succeed");
+        Playlist imported;
+        assertTrue(imported.importM3U8(m3uFile, reloadedLibrary) == big.size(), "M3U8 import should resolve every entry");
+        assertTrue(imported.getEntries() == big.getEntries(), "M3U8 should round-trip entries");
+
+        {
+            std::ofstream unresolved(m3uFile);
+            unresolved << "#EXTM3U\n#PLAYLIST:Broken\n/nonexistent.mp3\n";
+        }
+        assertTrue(imported.importM3U8(m3uFile, reloadedLibrary) == 0 && imported.getName() != "Broken" &&
+                   imported.getEntries() == big.getEntries(),
+                   "Unresolvable M3U8 should leave the playlist unchanged");
+        player->loadDemoPlaylist();
+        const size_t demoSize = player->getPlaylistSize();
+        assertTrue(!player->importPlaylist(m3uFile) && player->getPlaylistSize() == demoSize,
+                   "Player should keep its playlist after a failed import");
+        player->playNext(3);
+        player->nextTrack();
+        assertTrue(player->getPlaylistSize() == demoSize, "Queue should stay consistent after a failed import");
+        player->stop();
+
+        std::remove(libraryFile.c_str());
+        std::remove(playlistFile.c_str());
+        std::remove(m3uFile.c_str());
+        std::cout << "✅ Playlist persistence tests passed" << std::endl;
+    }
+
+    void testArtworkCache() {
+        std::cout << "🧪 Testing artwork cache..." << std::endl;
+
+        const std::string flacFile = "test_artwork.flac";
+        const std::string packFile = "test_artwork.pack";
+        std::remove(packFile.c_str());
+        writeFlacWithPicture(flacFile, makeRawPicture(256, 192, 10));
+
+        EmbeddedArtwork artwork;
+        assertTrue(ArtworkExtractor::extract(flacFile, artwork), "FLAC picture should be found");
+        assertTrue(artwork.mimeType == "image/x-test-rgb" && artwork.pictureType == ArtworkExtractor::FRONT_COVER,
+                   "FLAC picture metadata should be parsed");
+
+        const uint8_t apic[] = {0, 'i', 'm', 'a', 'g', 'e', '/', 'p', 'n', 'g', 0, 3, 'c', 0, 0x89, 'P', 'N', 'G'};
+        EmbeddedArtwork id3Artwork;
+        assertTrue(ArtworkExtractor::parseApicFrame(apic, sizeof(apic), id3Artwork) &&
+                   id3Artwork.mimeType == "image/png" && id3Artwork.data.size() == 4,
+                   "APIC frame should be parsed");
+
+        DecodedImage solid;
+        solid.width = 300;
+        solid.height = 100;
+        solid.rgb.assign(300 * 100 * 3, 0xFF);
+        Thumbnail scaled = ArtworkCache::downscale(solid, 128);
+        assertTrue(scaled.width == 128 && scaled.height == 42, "Downscale should keep the aspect ratio");
+        assertTrue(scaled.pixels.front() == 0xFFFF && scaled.pixels.back() == 0xFFFF, "Box filter should preserve flat colour");
+
+        const size_t thumbBytes = 128 * 96 * sizeof(uint16_t);
+        {
+            ArtworkCache cache(thumbBytes * 2);
+            assertTrue(cache.open(packFile), "Pack should be created");
+            cache.setDecoder(decodeRawPicture);
+            assertTrue(cache.importFromFile(flacFile), "Embedded artwork should be imported");
+            for (uint8_t i = 1; i <= 3; ++i) {
+                DecodedImage image;
+                ArtworkCache::ImageDecoder decode = decodeRawPicture;
+                decode(EmbeddedArtwork{"image/x-test-rgb", 3, makeRawPicture(256, 192, i)}, image);
+                assertTrue(cache.store("/media/album" + std::to_string(i) + ".flac", image), "Thumbnail should be stored");
+            }
+            assertTrue(cache.getMemoryUsage() <= cache.getMemoryBudget(), "Resident thumbnails should stay within budget");
+
+            auto thumbnail = cache.get(flacFile);
+            assertTrue(thumbnail && thumbnail->width == 128 && thumbnail->height == 96, "Evicted thumbnail should reload from the pack");
+            assertTrue(cache.getMisses() == 1, "Reload should count as a miss");
+            assertTrue(cache.get(flacFile) == thumbnail && cache.getHits() == 1, "Second lookup should hit");
+            assertTrue(cache.get("/media/none.flac") == nullptr, "Unknown file should have no artwork");
+        }
+
+        auto reference = [&]() {
+            ArtworkCache cache(thumbBytes);
+            cache.open(packFile);
+            return cache.get(flacFile);
+        }();
+        {
+            // A record cut short by a crash is dropped; earlier records survive
+            std::ofstream pack(packFile, std::ios::binary | std::ios::app);
+            pack.write("\x10\x00\x00\x00partial", 11);
+        }
+        auto shared = std::make_shared<ArtworkCache>(thumbBytes * 4);
+        assertTrue(shared->open(packFile) && shared->getPackedCount() == 4, "Pack should reopen with every complete record");
+        auto reopened = shared->get(flacFile);
+        assertTrue(reopened && reference && reopened->pixels == reference->pixels, "Pack should persist pixels exactly");
+
+        const auto compactSize = std::filesystem::file_size(packFile);
+        std::shared_ptr<const Thumbnail> latest;
+        {
+            ArtworkCache cache(thumbBytes);
+            cache.open(packFile);
+            for (uint8_t i = 4; i <= 8; ++i) {
+                DecodedImage image;
+                decodeRawPicture(EmbeddedArtwork{"image/x-test-rgb", 3, makeRawPicture(256, 192, i)}, image);
+                cache.store("/media/album1.flac", image);
+            }
+            latest = cache.get("/media/album1.flac");
+        }
+        {
+            ArtworkCache cache(thumbBytes);
+            assertTrue(cache.open(packFile) && cache.getPackedCount() == 4 &&
+                       std::filesystem::file_size(packFile) == compactSize,
+                       "Reopening should drop records of re-stored thumbnails");
+            auto restored = cache.get("/media/album1.flac");
+            assertTrue(restored && latest && restored->pixels == latest->pixels, "Compaction should keep the newest record");
+            assertTrue(cache.get(flacFile) && cache.get(flacFile)->pixels == reference->pixels,
+                       "Compaction should keep the other records");
+        }
+
+        player->loadDemoPlaylist();
+        Track withArt("Cover Song", "Artist", "Album", 200);
+        withArt.filePath = flacFile;
+        player->addTrack(withArt);
+        Track otherArt("Other Song", "Artist", "Album", 200);
+        otherArt.filePath = "/media/album1.flac";
+        player->addTrack(otherArt);
+        shared->setDecoder(decodeRawPicture);
+        player->setArtworkCache(shared);
+        assertTrue(player->scanArtwork() == 0, "Scan should skip tracks already in the pack");
+        while (player->getCurrentTrack()->filePath != flacFile) player->nextTrack();
+        auto current = player->getCurrentArtwork();
+        assertTrue(current && current->pixels == reference->pixels, "Player should show the current track's artwork");
+        player->setArtworkCache(nullptr);
+
+        std::remove(flacFile.c_str());
+        std::remove(packFile.c_str());
+        std::cout << "✅ Artwork cache tests passed" << std::endl;
+    }
+
+    void testWavDecoderSeek() {
+        std::cout << "🧪 Testing WAV decoding and seek index..." << std::endl;
+
+        const std::string wavFile = "test_ramp.wav";
+        writeRampWav(wavFile, 3 * AUDIO_SAMPLE_RATE);
+        auto decoder = AudioDecoder::create(wavFile);
+        assertTrue(decoder != nullptr, "WAV file should open");
+        assertTrue(decoder->getTotalFrames() == 3u * AUDIO_SAMPLE_RATE && decoder->getChannels() == 2 &&
+                   decoder->getSampleRate() == AUDIO_SAMPLE_RATE, "WAV header should be parsed");
+
+        std::vector<float> frames(2 * 8);
+        assertTrue(decoder->seek(100000) && decoder->tell() == 100000, "Seek should land on the exact frame");
+        assertTrue(decoder->read(frames.data(), 8) == 8, "Read after seek should succeed");
+        assertTrue(std::fabs(frames[0] * 32768.0f - (100000 % 32768)) < 0.5f &&
+                   std::fabs(frames[1] + frames[0]) < 1e-6f, "Samples should come from the seek target");
+        decoder->seek(decoder->getTotalFrames() - 3);
+        assertTrue(decoder->read(frames.data(), 8) == 3, "Read should stop at end of stream");
+
+        SeekIndex index(1000);
+        for (uint64_t frame = 0; frame < 10000; frame += 300) {
+            index.add(frame, frame * 2);
+        }
+        assertTrue(index.size() == 9, "Points closer than the spacing should be dropped");
+        assertTrue(index.find(5000)->frame == 4800 && index.find(4800)->byteOffset == 9600,
+                   "Lookup should return the last point at or before the target");
+        assertTrue(SeekIndex().find(0) == nullptr, "Empty index should have no points");
+
+        std::remove(wavFile.c_str());
+        std::cout << "✅ WAV decoding and seek index tests passed" << std::endl;
+    }
+
+    void testPlaybackClock() {
+        std::cout << "🧪 Testing playback clock and seek..." << std::endl;
+
+        const std::string wavFile = "test_clock.wav";
+        writeRampWav(wavFile, 2 * AUDIO_SAMPLE_RATE);
+        player->loadDemoPlaylist();
+        player->setVolume(100);
+        std::vector<float> block(512 * AUDIO_CHANNELS);
+
+        // Virtual tracks: the clock only advances while playing, and stops at the end
+        assertTrue(player->getPosition() == 0.0 && player->getTrackLength() == 355.0, "Clock should start at zero");
+        player->renderAudio(block.data(), 512);
+        assertTrue(player->getPositionFrames() == 0, "Clock should not advance while stopped");
+        player->play();
+        for (int i = 0; i < 100; ++i) player->renderAudio(block.data(), 512);
+        assertTrue(player->getPositionFrames() == 51200, "Clock should count rendered frames");
+        player->pause();
+        player->renderAudio(block.data(), 512);
+        assertTrue(player->getPositionFrames() == 51200, "Clock should hold while paused");
+        player->pause();
+        assertTrue(player->seek(354.99), "Seek should succeed");
+        for (int i = 0; i < 4; ++i) player->renderAudio(block.data(), 512);
+        assertTrue(player->getPositionFrames() == 355u * AUDIO_SAMPLE_RATE, "Clock should stop at end of track");
+        const size_t endedIndex = player->getCurrentTrackIndex();
+        player->setRepeatMode(RepeatMode::OFF);
+        assertTrue(player->pollTrackEnd() && player->getCurrentTrackIndex() != endedIndex &&
+                   player->getPositionFrames() == 0, "Control thread should advance once the track has ended");
+        assertTrue(!player->pollTrackEnd(), "Track end should be reported once");
+        player->seek(-5.0);
+        assertTrue(player->getPosition() == 0.0, "Negative seek should clamp to the start");
+        player->nextTrack();
+        assertTrue(player->getPosition() == 0.0, "Track change should reset the clock");
+
+        Track fileTrack("Ramp", "Test", "Test", 2);
+        fileTrack.filePath = wavFile;
+        player->addTrack(fileTrack);
+        while (player->getCurrentTrack()->filePath != wavFile) player->nextTrack();
+        assertTrue(player->getTrackLength() == 2.0, "Length should come from the decoder");
+        assertTrue(player->seek(1.5) && player->getPositionFrames() == 66150, "Seek should publish the new position at once");
+        // Let the volume ramp settle before comparing sample values
+        for (int i = 0; i < 2; ++i) player->renderAudio(block.data(), 512);
+        player->seek(1.0);
+        player->renderAudio(block.data(), 512);
+        const float gain = block[2] / (((AUDIO_SAMPLE_RATE + 1) % 32768) / 32768.0f);
+        assertTrue(std::fabs(block[0] * 32768.0f / gain - (AUDIO_SAMPLE_RATE % 32768)) < 0.5f,
+                   "Audio should resume at the seek target");
+        assertTrue(player->getPositionFrames() == AUDIO_SAMPLE_RATE + 512u, "Clock should continue from the seek target");
+        player->moveTrack(player->getCurrentTrackIndex(), 0);
+        assertTrue(player->getPositionFrames() == AUDIO_SAMPLE_RATE + 512u, "Moving the playing entry should not restart it");
+        const size_t longFrames = MediaPlayer::MAX_DECODE_FRAMES + 100;
+        std::vector<float> longBlock(longFrames * AUDIO_CHANNELS);
+        player->renderAudio(longBlock.data(), longFrames);
+        assertTrue(player->getPositionFrames() == AUDIO_SAMPLE_RATE + 512u + longFrames && longBlock.back() != 0.0f,
+                   "Blocks longer than one decode should be rendered in full");
+        player->stop();
+        assertTrue(player->getPosition() == 0.0, "Stop should rewind");
+
+        player->setVolume(50);
+        std::remove(wavFile.c_str());
+        std::cout << "✅ Playback clock tests passed" << std::endl;
+    }
+
+    void testTrackCrossfade() {
+        std::cout << "🧪 Testing crossfade on track change..." << std::endl;
+
+        const std::string firstFile = "test_fade_a.wav";
+        const std::string secondFile = "test_fade_b.wav";
+        writeRampWav(firstFile, 2 * AUDIO_SAMPLE_RATE);
+        writeRampWav(secondFile, 2 * AUDIO_SAMPLE_RATE);
+        MediaPlayer local(notificationManager);
+        Track first("Fade A", "Test", "Test", 2);
+        first.filePath = firstFile;
+        Track second("Fade B", "Test", "Test", 2);
+        second.filePath = secondFile;
+        local.addTrack(first);
+        local.addTrack(second);
+        local.setVolume(100);
+        local.play();
+        std::vector<float> block(512 * AUDIO_CHANNELS);
+        for (int i = 0; i < 20; ++i) local.renderAudio(block.data(), 512);
+
+        local.nextTrack();
+        local.renderAudio(block.data(), 512);
+        assertTrue(std::fabs(block[0] * 32768.0f - 10240.0f) < 1.0f, "Previous track should continue at the start of the fade");
+        assertTrue(local.getPositionFrames() == 512, "Clock should follow the new track during the fade");
+
+        std::vector<float> rest((MediaPlayer::CROSSFADE_FRAMES - 512) * AUDIO_CHANNELS);
+        local.renderAudio(rest.data(), MediaPlayer::CROSSFADE_FRAMES - 512);
+        const uint64_t position = local.getPositionFrames();
+        local.renderAudio(block.data(), 512);
+        assertTrue(std::fabs(block[0] * 32768.0f - static_cast<float>(position)) < 1.0f,
+                   "Only the new track should play after the fade");
+
+        // At the natural end the next track starts under the tail of this one
+        const std::string thirdFile = "test_fade_c.wav";
+        writeRampWav(thirdFile, 2 * AUDIO_SAMPLE_RATE);
+        Track third("Fade C", "Test", "Test", 2);
+        third.filePath = thirdFile;
+        local.addTrack(third);
+        local.seek(1.4);
+        uint64_t endPosition = 0;
+        do {
+            local.renderAudio(block.data(), 512);
+            endPosition = local.getPositionFrames();
+        } while (!local.pollTrackEnd() && endPosition < 2u * AUDIO_SAMPLE_RATE);
+        assertTrue(local.getCurrentTrack()->title == "Fade C" && endPosition < 2u * AUDIO_SAMPLE_RATE &&
+                   endPosition + MediaPlayer::CROSSFADE_FRAMES >= 2u * AUDIO_SAMPLE_RATE,
+                   "Track end should be flagged a crossfade ahead of the end");
+        local.renderAudio(block.data(), 512);
+        assertTrue(std::fabs(block[0] * 32768.0f - static_cast<float>(endPosition % 32768)) < 1.0f,
+                   "Ending track should play on into the fade");
+
+        // The last track has nothing to fade into and plays out in full
+        local.seek(1.4);
+        int blocks = 0;
+        do {
+            local.renderAudio(block.data(), 512);
+            endPosition = local.getPositionFrames();
+        } while (!local.pollTrackEnd() && ++blocks < 100);
+        assertTrue(endPosition == 2u * AUDIO_SAMPLE_RATE && local.getState() == PlayerState::STOPPED,
+                   "Last track should play to its end before playback stops");
+
+        local.stop();
+        std::remove(firstFile.c_str());
+        std::remove(secondFile.c_str());
+        std::remove(thirdFile.c_str());
+        std::cout << "✅ Crossfade tests passed" << std::endl;
+    }
+
+    void testPlayStatistics() {
+        std::cout << "🧪 Testing play statistics..." << std::endl;
+
+        // Compare the incremental indexes against a brute-force model
+        PlayStatistics statistics;
+        std::vector<uint32_t> counts;
+        std::vector<TrackId> recent;
+        std::mt19937 rng(7);
+        for (int step = 0; step < 5000; ++step) {
+            if (step % 500 == 0) {
+                counts.resize(counts.size() + 20, 0);
+                statistics.resize(counts.size());
+            }
+            // Skewed picks so counts spread out
+            TrackId id = static_cast<TrackId>(std::min<size_t>(rng() % counts.size(), rng() % counts.size()));
+            statistics.recordPlay(id);
+            ++counts[id];
+            recent.erase(std::remove(recent.begin(), recent.end(), id), recent.end());
+            recent.insert(recent.begin(), id);
+        }
+
+        auto top = statistics.mostPlayed(10);
+        std::vector<uint32_t> sorted = counts;
+        std::sort(sorted.rbegin(), sorted.rend());
+        bool topMatches = top.size() == 10;
+        for (size_t i = 0; topMatches && i < top.size(); ++i) {
+            topMatches = statistics.getPlayCount(top[i]) == sorted[i] && counts[top[i]] == sorted[i];
+        }
+        assertTrue(topMatches, "Most played should match a full sort");
+        assertTrue(statistics.recentlyPlayed(25) == std::vector<TrackId>(recent.begin(), recent.begin() + 25),
+                   "Recently played should match play order");
+        assertTrue(statistics.getPlayedCount() == recent.size(), "Played count should track distinct tracks");
+        assertTrue(statistics.mostPlayed(1000).size() == recent.size(), "Unplayed tracks should not be listed");
+
+        PlayStatistics restored;
+        assertTrue(restored.restore(counts, recent), "Statistics should restore");
+        assertTrue(restored.recentlyPlayed(recent.size()) == recent, "Restored recency should match");
+        restored.recordPlay(top.back());
+        assertTrue(restored.getPlayCount(top.back()) == counts[top.back()] + 1, "Restored index should keep counting");
+        assertTrue(!restored.restore(counts, {1, 1}), "Repeated recency entries should be rejected");
+
+        std::cout << "✅ Play statistics tests passed" << std::endl;
+    }
+
+    void testPlayStatisticsPersistence() {
+        std::cout << "🧪 Testing play statistics in the library cache..." << std::endl;
+
+        const std::string libraryFile = "test_stats_library.bin";
+        player->loadDemoPlaylist();
+        player->stop();
+        player->play();
+        player->nextTrack();
+        player->previousTrack();
+        player->pause();
+        player->play();
+        const PlayStatistics& statistics = player->getLibrary().getStatistics();
+        assertTrue(statistics.getPlayCount(0) == 2 && statistics.getPlayCount(1) == 1,
+                   "Starting and changing tracks while playing should count plays; resuming should not");
+        assertTrue(statistics.recentlyPlayed(2) == std::vector<TrackId>({0, 1}), "Most recent play should come first");
+
+        assertTrue(player->saveLibrary(libraryFile), "Library should save");
+        MediaLibrary reloaded;
+        assertTrue(reloaded.load(libraryFile), "Library should load");
+        assertTrue(reloaded.getStatistics().mostPlayed(5) == std::vector<TrackId>({0, 1}) &&
+                   reloaded.getStatistics().recentlyPlayed(5) == std::vector<TrackId>({0, 1}),
+                   "Statistics should survive the library cache");
+
+        // Version 1 caches predate statistics and still load
+        BinaryWriter v1;
+        v1.u32(MediaLibrary::CACHE_MAGIC);
+        v1.u32(1);
+        v1.u32(1);
+        for (const char* field : {"Title", "Artist", "Album", ""}) v1.str(field);
+        v1.i32(200);
+        v1.f32(0.0f);
+        writeFileContents(libraryFile, v1.data());
+        assertTrue(reloaded.load(libraryFile) && reloaded.size() == 1 && reloaded.getStatistics().getPlayedCount() == 0,
+                   "Version 1 cache should load with empty statistics");
+
+        player->stop();
+        std::remove(libraryFile.c_str());
+        std::cout << "✅ Play statistics persistence tests passed" << std::endl;
+    }
+
+    void testFlacDecoder() {
+        std::cout << "🧪 Testing FLAC decoding..." << std::endl;
+
+        const std::string flacFile = "test_stream.flac";
+        const uint32_t totalFrames = 12 * 4096 + 1000;
+        std::vector<int32_t> pcm(totalFrames * 2);
+        std::mt19937 rng(3);
+        for (uint32_t i = 0; i < totalFrames; ++i) {
+            bool silent = i >= 4096 && i < 8192;            // exercises CONSTANT subframes
+            double tone = 12000.0 * std::sin(i * 0.031) + static_cast<int>(rng() % 200) - 100;
+            pcm[i * 2] = silent ? 0 : static_cast<int32_t>(tone);
+            pcm[i * 2 + 1] = silent ? 0 : static_cast<int32_t>(tone * 0.5) - 300;
+        }
+        assertTrue(flactest::writeFlac(flacFile, pcm, 2, 16, AUDIO_SAMPLE_RATE), "Fixture should be written");
+
+        auto decoder = AudioDecoder::create(flacFile);
+        assertTrue(decoder != nullptr && decoder->getTotalFrames() == totalFrames && decoder->getChannels() == 2,
+                   "FLAC stream info should be parsed");
+        std::vector<float> sequential(pcm.size());
+        size_t got = 0;
+        while (got < totalFrames) {
+            size_t n = decoder->read(sequential.data() + got * 2, std::min<size_t>(777, totalFrames - got));
+            if (n == 0) break;
+            got += n;
+        }
+        bool exact = got == totalFrames;
+        for (size_t i = 0; exact && i < pcm.size(); ++i) exact = sequential[i] * 32768.0f == static_cast<float>(pcm[i]);
+        assertTrue(exact, "Every subframe type and channel assignment should decode losslessly");
+
+        FlacDecoder flac;
+        assertTrue(flac.open(flacFile), "FLAC should open");
+        std::vector<float> parallel;
+        assertTrue(flac.decodeAll(parallel, 3), "Parallel decode should cover every frame");
+        assertTrue(parallel == sequential, "Parallel decode should match sequential decode");
+
+        std::vector<float> window(16 * 2);
+        bool seeksMatch = true;
+        for (uint64_t target : std::vector<uint64_t>{40000, 5, 4096, 30000, totalFrames - 8}) {
+            flac.seek(target);
+            size_t n = flac.read(window.data(), 16);
+            seeksMatch = seeksMatch && flac.tell() == target + n &&
+                         std::equal(window.begin(), window.begin() + n * 2, sequential.begin() + target * 2);
+        }
+        assertTrue(seeksMatch, "Seeks should land on the exact frame");
+        assertTrue(flac.buildSeekIndex(2) == 7, "Seek index should hold a point every tenth of a second or block");
+
+        // A corrupted frame is skipped in playback and reported by the whole-file decode
+        {
+            std::fstream corrupt(flacFile, std::ios::in | std::ios::out | std::ios::binary);
+            corrupt.seekp(-20000, std::ios::end);
+            corrupt.put('\x5A');
+        }
+        FlacDecoder damaged;
+        damaged.open(flacFile);
+        size_t played = 0;
+        while (size_t n = damaged.read(sequential.data(), 4096)) played += n;
+        assertTrue(played < totalFrames && played >= totalFrames - 4096, "Playback should resync after a bad frame");
+        assertTrue(!damaged.decodeAll(parallel, 2), "Whole-file decode should report the bad frame");
+
+        // 24-bit mono with a SEEKTABLE
+        std::vector<int32_t> mono(100 * 1152);
+        for (size_t i = 0; i < mono.size(); ++i) mono[i] = static_cast<int32_t>(3000000.0 * std::sin(i * 0.01));
+        flactest::writeFlac(flacFile, mono, 1, 24, 48000, 1152, 40);
+        FlacDecoder hiRes;
+        assertTrue(hiRes.open(flacFile) && hiRes.getSeekPointCount() == 3, "SEEKTABLE points should seed the index");
+        hiRes.seek(95000);
+        float sample = 0.0f;
+        hiRes.read(&sample, 1);
+        assertTrue(sample * 8388608.0f == static_cast<float>(mono[95000]), "24-bit seek should be exact");
+
+        std::remove(flacFile.c_str());
+        std::cout << "✅ FLAC decoding tests passed" << std::endl;
+    }
+
+    void testMetadataNormalization() {
+        std::cout << "🧪 Testing metadata normalization and duplicate detection..." << std::endl;
+
+        assertTrue(MetadataNormalizer::normalizeText("  Mark   Ronson\tFeat. Bruno Mars ") == "Mark Ronson ft. Bruno Mars",
+                   "Whitespace should collapse and featuring variants become ft.");
+        assertTrue(MetadataNormalizer::normalizeText("Song (featuring X) [FT X]") == "Song (ft. X) [ft. X]",
+                   "Bracketed featuring variants should be canonical");
+        assertTrue(MetadataNormalizer::normalizeText("Left Feather") == "Left Feather", "Words starting with feat stay");
+
+        std::vector<Track> scanned;
+        scanned.emplace_back("Uptown Funk", "Mark Ronson feat. Bruno Mars", "Uptown Special", 269);
+        scanned.emplace_back("uptown funk ", "MARK RONSON FT BRUNO MARS", "Single", 269);
+        scanned.emplace_back("Uptown Funk", "Mark Ronson ft. Bruno Mars", "Uptown Special", 270);
+        scanned.emplace_back("Imagine", "John Lennon", "Imagine", 183);
+        scanned.back().filePath = "/usb/imagine.flac";
+        scanned.emplace_back("Imagine (Remaster)", "John Lennon", "Imagine", 184);
+        scanned.back().filePath = "/usb/imagine.flac";
+
+        MediaLibrary library;
+        std::vector<TrackId> ids = library.addScannedTracks(scanned, 2);
+        assertTrue(library.size() == 3, "Case, spacing and featuring variants of one recording should collapse");
+        assertTrue(ids == std::vector<TrackId>({0, 0, 1, 2, 2}), "Duplicates should map to the first copy");
+        assertTrue(library.getTrack(0)->artist == "Mark Ronson ft. Bruno Mars", "Stored artist should be normalized");
+
+        // Rescans and large batches split across threads
+        std::vector<Track> batch;
+        for (int i = 0; i < 10000; ++i) {
+            batch.emplace_back(" Track " + std::to_string(i % 5000), "Artist", "Album", 200);
+        }
+        batch.emplace_back("IMAGINE", "john lennon", "Imagine", 183);
+        ids = library.addScannedTracks(batch, 4);
+        assertTrue(library.size() == 5003, "Each distinct batch track should be added once");
+        assertTrue(ids[5000] == ids[0] && ids[4999] == 5002 && ids.back() == 2,
+                   "Batch duplicates should resolve against earlier entries and the existing library");
+        assertTrue(library.getTrack(3)->title == "Track 0", "Batch titles should be trimmed");
+
+        std::cout << "✅ Metadata normalization tests passed" << std::endl;
+    }
+
+    void testPagedLibrary() {
+        std::cout << "🧪 Testing paged library mode..." << std::endl;
+
+        const std::string libraryFile = "test_paged_library.bin";
+        const size_t trackCount = 100000;
+        const size_t cacheTracks = 32;
+        auto titleFor = [](size_t i) {
+            std::string digits = std::to_string(trackCount - 1 - i);
+            return "Song " + std::string(6 - digits.size(), '0') + digits;
+        };
+        {
+            MediaLibrary full;
+            for (size_t i = 0; i < trackCount; ++i) {
+                Track track(titleFor(i), "Artist " + std::to_string(i % 97), "Album", 120 + static_cast<int>(i % 300));
+                track.filePath = "/usb/" + std::to_string(i) + ".flac";
+                full.addTrack(track);
+            }
+            full.recordPlay(7);
+            full.recordPlay(7);
+            full.recordPlay(99999);
+            assertTrue(full.save(libraryFile), "Library should save");
+        }
+
+        MediaLibrary paged;
+        assertTrue(paged.openPaged(libraryFile, cacheTracks), "Library should open in paged mode");
+        assertTrue(paged.isPaged() && paged.size() == trackCount && paged.getCachedTrackCount() == 0,
+                   "Opening should index records without decoding them");
+        assertTrue(paged.getStatistics().mostPlayed(2) == std::vector<TrackId>({7, 99999}), "Statistics should stay resident");
+
+        std::mt19937 rng(85);
+        bool titlesMatch = true;
+        for (int i = 0; i < 20000; ++i) {
+            const TrackId id = static_cast<TrackId>(rng() % trackCount);
+            titlesMatch = titlesMatch && paged.getTrack(id)->title == titleFor(id);
+        }
+        assertTrue(titlesMatch, "Paged tracks should decode correctly");
+        assertTrue(paged.getCachedTrackCount() == cacheTracks, "Random browsing should stay within the LRU");
+
+        const std::vector<TrackId> firstPage = paged.browseByTitle(0, 3);
+        assertTrue(firstPage == std::vector<TrackId>({99999, 99998, 99997}), "Browsing should follow title order");
+        assertTrue(paged.browseByTitle(trackCount - 1, 10) == std::vector<TrackId>({0}), "Last page should be short");
+        assertTrue(paged.getCachedTrackCount() == cacheTracks, "Sorting by title should not decode records");
+        assertTrue(paged.findByPath("/usb/4242.flac") == 4242 && paged.findByPath("/usb/none.flac") == INVALID_TRACK_ID,
+                   "Path lookups should work in paged mode");
+
+        // New tracks are resident; duplicates of paged tracks are still found
+        Track extra("Extra", "Artist", "Album", 100);
+        const TrackId extraId = paged.addTrack(extra);
+        assertTrue(extraId == trackCount && paged.getTrack(extraId)->title == "Extra", "Added tracks should follow paged ones");
+        Track rescanned(titleFor(5), "artist 5", "Album", 125);
+        assertTrue(paged.addScannedTracks({rescanned}) == std::vector<TrackId>({5}),
+                   "Scans should detect duplicates of paged tracks");
+
+        // Saving over the mapped file replaces it by rename
+        assertTrue(paged.save(libraryFile), "Paged library should save over its own file");
+        assertTrue(paged.getTrack(12345)->title == titleFor(12345), "Mapping should survive the save");
+        MediaLibrary reloaded;
+        assertTrue(reloaded.load(libraryFile) && reloaded.size() == trackCount + 1 &&
+                   reloaded.getTrack(extraId)->title == "Extra" && reloaded.getStatistics().getPlayCount(7) == 2,
+                   "Saved paged library should round-trip");
+
+        player->setLibraryCacheLimit(16);
+        assertTrue(player->loadLibrary(libraryFile) && player->getLibrary().isPaged(), "Player should page the library");
+        player->setLibraryCacheLimit(0);
+        player->loadDemoPlaylist();
+        assertTrue(!player->getLibrary().isPaged(), "Demo playlist should replace the paged library");
+
+        std::remove(libraryFile.c_str());
+        std::cout << "✅ Paged library tests passed" << std::endl;
+    }
+
+    void runAllTests() {
+        std::cout << "\n🧪 === RUNNING MEDIA PLAYER TESTS ===" << std::endl;
+        std::cout << std::string(45, '=') << std::endl;
+
+        testSequentialNavigation();
+        testShuffleVisitsEveryTrack();
+        testHistoryAndQueue();
+        testRepeatModes();
+        testDspChain();
+        testPromptDucking();
+        testPlaylistEditing();
+        testPlaylistPersistence();
+        testArtworkCache();
+        testWavDecoderSeek();
+        testPlaybackClock();
+        testTrackCrossfade();
+        testPlayStatistics();
+        testPlayStatisticsPersistence();
+        testFlacDecoder();
+        testMetadataNormalization();
+        testPagedLibrary();
+
+        std::cout << std::string(45, '=') << std::endl;
+        std::cout << "🎉 All Media Player tests passed!" << std::endl;
+    }
+};
+
+int main() {
+    try {
+        MediaPlayerTest test;
+        test.runAllTests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+}
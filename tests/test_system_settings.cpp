@@ -0,0 +1,715 @@
+/**
+ * @file test_system_settings.cpp
+ * @brief Unit tests for SystemSettings class
+ */
+
+#include "SystemSettings.h"
+#include "NotificationManager.h"
+#include "BinaryIO.h"
+#include "DisplayScheduler.h"
+#include "SolarSchedule.h"
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <memory>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+class SystemSettingsTest {
+private:
+    std::shared_ptr<NotificationManager> notificationManager;
+    std::shared_ptr<SystemSettings> settings;
+    const std::string settingsFile = "test_settings.bin";
+
+    void assertTrue(bool condition, const std::string& message) {
+        if (!condition) {
+            std::cout << "❌ FAIL: " << message << std::endl;
+            throw std::runtime_error("Test assertion failed: " + message);
+        }
+    }
+
+    void configureNonDefaults(SystemSettings& target) {
+        target.setSystemVolume(80);
+        target.setDisplayBrightness(40);
+        target.setDisplayTheme(DisplayTheme::DARK);
+        target.setLanguage(Language::GERMAN);
+        target.setVoiceGuidance(false);
+        target.setNotificationSounds(false);
+        target.setTimeFormat("24h");
+        target.setTemperatureUnit("F");
+    }
+
+public:
+    SystemSettingsTest() {
+        notificationManager = std::make_shared<NotificationManager>();
+        settings = std::make_shared<SystemSettings>(notificationManager);
+    }
+
+    void testSaveAndLoad() {
+        std::cout << "🧪 Testing settings persistence..." << std::endl;
+
+        configureNonDefaults(*settings);
+        assertTrue(settings->saveSettings(settingsFile), "Settings should save");
+
+        SystemSettings restored(notificationManager);
+        assertTrue(restored.loadSettings(settingsFile), "Saved settings should load");
+        assertTrue(restored.getSystemVolume() == 80 && restored.getDisplayBrightness() == 40,
+                   "Volume and brightness should round-trip");
+        assertTrue(restored.getDisplayTheme() == DisplayTheme::DARK && restored.getLanguage() == Language::GERMAN,
+                   "Theme and language should round-trip");
+        assertTrue(!restored.isVoiceGuidanceEnabled() && !restored.areNotificationSoundsEnabled() &&
+                   !restored.isNightModeEnabled(), "Flags should round-trip");
+        assertTrue(restored.getTimeFormat() == "24h" && restored.getTemperatureUnit() == "F",
+                   "Units should round-trip");
+
+        std::ifstream leftover(settingsFile + ".tmp");
+        assertTrue(!leftover, "Temporary file should be renamed away");
+
+        std::cout << "✅ Settings persistence tests passed" << std::endl;
+    }
+
+    void testMissingFile() {
+        std::cout << "🧪 Testing missing settings file..." << std::endl;
+
+        SystemSettings fresh(notificationManager);
+        fresh.setSystemVolume(30);
+        assertTrue(!fresh.loadSettings("no_such_settings.bin"), "Missing file should not load");
+        assertTrue(fresh.getSystemVolume() == 30, "Missing file should leave settings unchanged");
+
+        std::cout << "✅ Missing settings file tests passed" << std::endl;
+    }
+
+    void testCorruptionFallsBackToDefaults() {
+        std::cout << "🧪 Testing corrupt settings files..." << std::endl;
+
+        configureNonDefaults(*settings);
+        assertTrue(settings->saveSettings(settingsFile), "Settings should save");
+        std::string good;
+        assertTrue(readFileContents(settingsFile, good), "Settings file should be readable");
+
+        // Flip each byte in turn; the checksum or header checks must catch every one
+        for (size_t i = 0; i < good.size(); ++i) {
+            std::string damaged = good;
+            damaged[i] = static_cast<char>(damaged[i] ^ 0x5A);
+            writeFileContents(settingsFile, damaged);
+
+            SystemSettings restored(notificationManager);
+            restored.setSystemVolume(99);
+            const int warningsBefore = notificationManager->getNotificationCount(AlertLevel::WARNING);
+            assertTrue(!restored.loadSettings(settingsFile), "Damaged byte " + std::to_string(i) + " should be rejected");
+            assertTrue(restored.getSystemVolume() == 50 && restored.getTemperatureUnit() == "C",
+                       "Damaged file should restore defaults");
+            assertTrue(notificationManager->getNotificationCount(AlertLevel::WARNING) == warningsBefore + 1,
+                       "Damaged file should raise a warning");
+        }
+
+        writeFileContents(settingsFile, good.substr(0, good.size() - 1));
+        assertTrue(!settings->loadSettings(settingsFile), "Truncated file should be rejected");
+        writeFileContents(settingsFile, good + "x");
+        assertTrue(!settings->loadSettings(settingsFile), "Trailing bytes should be rejected");
+
+        // A well-formed file with an out-of-range value is still rejected
+        // (header, profile count and index, "Default", override mask, then volume)
+        std::string outOfRange = good;
+        outOfRange[12 + 4 + 4 + 4 + 7 + 2] = static_cast<char>(150);
+        const uint32_t crc = crc32(outOfRange.data(), outOfRange.size() - 4);
+        for (int b = 0; b < 4; ++b) outOfRange[outOfRange.size() - 4 + b] = static_cast<char>(crc >> (8 * b));
+        writeFileContents(settingsFile, outOfRange);
+        assertTrue(!settings->loadSettings(settingsFile), "Out-of-range volume should be rejected");
+
+        std::remove(settingsFile.c_str());
+        std::cout << "✅ Corrupt settings file tests passed" << std::endl;
+    }
+
+    void testSnapshotReads() {
+        std::cout << "🧪 Testing lock-free settings snapshots..." << std::endl;
+
+        SystemSettings shared(notificationManager);
+        {
+            const SettingsView before = shared.getSnapshot();
+            const SettingsView nested = shared.getSnapshot();
+            std::ostringstream quiet;
+            std::streambuf* original = std::cout.rdbuf(quiet.rdbuf());
+            shared.setTemperatureUnit("F");
+            shared.setSystemVolume(10);
+            std::cout.rdbuf(original);
+            assertTrue(before->temperatureUnit == "C" && before->systemVolume == 50,
+                       "A held snapshot should not change");
+            assertTrue(&*nested == &*before, "Nested views should see the same snapshot");
+            assertTrue(shared.getTemperatureUnit() == "F" && shared.getSnapshot()->systemVolume == 10,
+                       "New readers should see the latest snapshot");
+            assertTrue(EpochReclaimer::instance().getPendingCount() >= 1,
+                       "Snapshots visible to a pinned reader should not be freed");
+        }
+        EpochReclaimer::instance().reclaim();
+        assertTrue(EpochReclaimer::instance().getPendingCount() == 0,
+                   "Replaced snapshots should be freed once readers leave");
+
+        // Readers on several threads while one writer keeps publishing
+        std::atomic<bool> stop(false);
+        std::atomic<int> badReads(0);
+        std::atomic<long> reads(0);
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&] {
+                while (!stop.load()) {
+                    const SettingsView view = shared.getSnapshot();
+                    if (view->systemVolume < 0 || view->systemVolume > 100 ||
+                        (view->timeFormat != "12h" && view->timeFormat != "24h")) {
+                        ++badReads;
+                    }
+                    ++reads;
+                }
+            });
+        }
+        std::ostringstream quiet;
+        std::streambuf* original = std::cout.rdbuf(quiet.rdbuf());
+        for (int i = 0; i < 2000; ++i) {
+            shared.setSystemVolume(i % 101);
+            shared.setTimeFormat(i % 2 ? "24h" : "12h");
+            if (i % 100 == 0) std::this_thread::yield();
+        }
+        while (reads.load() < 1000) std::this_thread::yield();
+        stop = true;
+        for (auto& reader : readers) reader.join();
+        std::cout.rdbuf(original);
+
+        assertTrue(badReads.load() == 0, "Readers should only ever see complete snapshots");
+        EpochReclaimer::instance().reclaim();
+        assertTrue(EpochReclaimer::instance().getPendingCount() == 0, "All replaced snapshots should be reclaimed");
+
+        std::cout << "✅ Lock-free settings snapshot tests passed" << std::endl;
+    }
+
+    void testChangeObservers() {
+        std::cout << "🧪 Testing settings change observers..." << std::endl;
+
+        SystemSettings observed(notificationManager);
+        std::vector<SettingKeySet> displayEvents;
+        int soundEvents = 0;
+        bool lastSound = true;
+        const auto displayId = observed.subscribe({SettingKey::DISPLAY_BRIGHTNESS, SettingKey::NIGHT_MODE},
+                                                  [&](const SettingsChange& change) {
+            displayEvents.push_back(change.changed);
+        });
+        observed.subscribe({SettingKey::NOTIFICATION_SOUNDS}, [&](const SettingsChange& change) {
+            ++soundEvents;
+            lastSound = change.current.notificationSoundsEnabled;
+        });
+
+        std::ostringstream quiet;
+        std::streambuf* original = std::cout.rdbuf(quiet.rdbuf());
+
+        // Night mode dims the display in the same transaction: one event, two keys
+        const int infoBefore = notificationManager->getNotificationCount(AlertLevel::INFO);
+        observed.setNightMode(true);
+        assertTrue(displayEvents.size() == 1, "Night mode should dispatch a single event");
+        assertTrue(displayEvents[0] == (settingBit(SettingKey::NIGHT_MODE) | settingBit(SettingKey::DISPLAY_BRIGHTNESS)),
+                   "Night mode event should carry both changed keys");
+        assertTrue(observed.getDisplayBrightness() == 30, "Night mode should cap brightness");
+        assertTrue(notificationManager->getNotificationCount(AlertLevel::INFO) == infoBefore + 1,
+                   "Night mode should raise one notification");
+
+        // Observers only hear about their own keys, and unchanged values are not events
+        observed.setVoiceGuidance(false);
+        observed.setNightMode(true);
+        assertTrue(displayEvents.size() == 1, "Unrelated or unchanged settings should not notify");
+        observed.setNotificationSounds(false);
+        assertTrue(soundEvents == 1 && !lastSound, "Sound observer should see the new value");
+
+        // A transaction publishes once and notifies once
+        const SettingKeySet changed = observed.update([](SettingsSnapshot& s) {
+            s.displayBrightness = 150;
+            s.nightModeEnabled = false;
+            s.notificationSoundsEnabled = true;
+            s.language = Language::FRENCH;
+        });
+        std::cout.rdbuf(original);
+        assertTrue(displayEvents.size() == 2 && soundEvents == 2, "Transaction should notify each observer once");
+        assertTrue(changed == (settingBit(SettingKey::DISPLAY_BRIGHTNESS) | settingBit(SettingKey::NIGHT_MODE) |
+                               settingBit(SettingKey::NOTIFICATION_SOUNDS) | settingBit(SettingKey::LANGUAGE)),
+                   "Transaction should report every changed key");
+        assertTrue(observed.getDisplayBrightness() == 100, "Transaction values should be clamped");
+
+        // An invalid draft is rejected as a whole
+        const int warningsBefore = notificationManager->getNotificationCount(AlertLevel::WARNING);
+        assertTrue(observed.update([](SettingsSnapshot& s) {
+            s.systemVolume = 10;
+            s.timeFormat = "36h";
+        }) == 0, "Invalid transaction should change nothing");
+        assertTrue(observed.getSystemVolume() == 50, "Invalid transaction should not be applied");
+        assertTrue(notificationManager->getNotificationCount(AlertLevel::WARNING) == warningsBefore + 1,
+                   "Invalid transaction should raise a warning");
+
+        // Observers can write settings and unsubscribe from inside a callback
+        SystemSettings::SubscriptionId follower = 0;
+        follower = observed.subscribe({SettingKey::THEME}, [&](const SettingsChange& change) {
+            if (change.current.theme == DisplayTheme::DARK) {
+                observed.update([](SettingsSnapshot& s) { s.nightModeEnabled = true; });
+                observed.unsubscribe(follower);
+            }
+        });
+        observed.update([](SettingsSnapshot& s) { s.theme = DisplayTheme::DARK; });
+        assertTrue(observed.isNightModeEnabled() && displayEvents.size() == 3, "Nested transaction should notify");
+        assertTrue(!observed.unsubscribe(follower), "Observer should have unsubscribed itself");
+        assertTrue(observed.unsubscribe(displayId), "Registered observer should unsubscribe");
+        observed.update([](SettingsSnapshot& s) { s.nightModeEnabled = false; });
+        assertTrue(displayEvents.size() == 3, "Removed observer should not be called");
+
+        EpochReclaimer::instance().reclaim();
+        assertTrue(EpochReclaimer::instance().getPendingCount() == 0, "Snapshots should be reclaimed after dispatch");
+
+        std::cout << "✅ Settings change observer tests passed" << std::endl;
+    }
+
+    void testProfiles() {
+        std::cout << "🧪 Testing driver profiles..." << std::endl;
+
+        std::ostringstream quiet;
+        std::streambuf* original = std::cout.rdbuf(quiet.rdbuf());
+
+        SystemSettings fleet(notificationManager);
+        assertTrue(fleet.getActiveProfile() == SystemSettings::DEFAULT_PROFILE, "Default profile should be active");
+        assertTrue(fleet.createProfile("Alice") && fleet.createProfile("Bob"), "Profiles should be created");
+        assertTrue(!fleet.createProfile("Alice") && !fleet.createProfile(""), "Duplicate or empty names should fail");
+
+        // New profiles share the current snapshot, so switching to one changes nothing
+        int events = 0;
+        SettingKeySet lastChange = 0;
+        fleet.subscribe({SettingKey::SYSTEM_VOLUME, SettingKey::THEME, SettingKey::LANGUAGE},
+                        [&](const SettingsChange& change) {
+            ++events;
+            lastChange = change.changed;
+        });
+        const SettingsSnapshot* shared = &*fleet.getSnapshot();
+        assertTrue(fleet.switchProfile("Alice") && &*fleet.getSnapshot() == shared && events == 0,
+                   "Switching to an identical profile should not notify");
+
+        // Editing one profile leaves the others untouched (copy-on-write)
+        fleet.setSystemVolume(20);
+        fleet.setLanguage(Language::SPANISH);
+        fleet.setNightMode(true);
+        assertTrue(fleet.switchProfile("Bob"), "Switch should succeed");
+        assertTrue(fleet.getSystemVolume() == 50 && fleet.getLanguage() == Language::ENGLISH &&
+                   !fleet.isNightModeEnabled(), "Other profiles should keep their values");
+        assertTrue(events == 3 && lastChange == (settingBit(SettingKey::SYSTEM_VOLUME) |
+                                                 settingBit(SettingKey::LANGUAGE) |
+                                                 settingBit(SettingKey::DISPLAY_BRIGHTNESS) |
+                                                 settingBit(SettingKey::NIGHT_MODE)),
+                   "Switch should dispatch once with only the differing keys");
+        assertTrue(!fleet.switchProfile("Carol"), "Unknown profile should not switch");
+        assertTrue(!fleet.deleteProfile("Bob") && fleet.getActiveProfile() == "Bob", "Active profile cannot be deleted");
+
+        // All profiles round-trip through one file
+        fleet.setDisplayTheme(DisplayTheme::LIGHT);
+        assertTrue(fleet.saveSettings(settingsFile), "Profiles should save");
+        SystemSettings restored(notificationManager);
+        assertTrue(restored.loadSettings(settingsFile), "Profiles should load");
+        std::cout.rdbuf(original);
+        assertTrue(restored.getProfileNames() == std::vector<std::string>({"Alice", "Bob", "Default"}),
+                   "Every profile should be restored");
+        assertTrue(restored.getActiveProfile() == "Bob" && restored.getDisplayTheme() == DisplayTheme::LIGHT,
+                   "Active profile should be restored");
+        assertTrue(restored.switchProfile("Alice") && restored.getSystemVolume() == 20 &&
+                   restored.getLanguage() == Language::SPANISH && restored.getDisplayBrightness() == 30,
+                   "Inactive profiles should be restored");
+        assertTrue(restored.deleteProfile("Default") && restored.getProfileNames().size() == 2,
+                   "Inactive profile should be deleted");
+
+        // Version 1 files load as the default profile
+        BinaryWriter v1;
+        v1.u32(SystemSettings::SETTINGS_MAGIC);
+        v1.u32(1);
+        v1.u32(7);
+        const uint8_t payload[] = {35, 60, 1, 2, 0x03, 1, 0};
+        v1.bytes(payload, sizeof(payload));
+        v1.u32(crc32(v1.data().data(), v1.data().size()));
+        writeFileContents(settingsFile, v1.data());
+        SystemSettings migrated(notificationManager);
+        assertTrue(migrated.loadSettings(settingsFile), "Version 1 file should load");
+        assertTrue(migrated.getProfileNames().size() == 1 && migrated.getSystemVolume() == 35 &&
+                   migrated.getLanguage() == Language::FRENCH && migrated.isNightModeEnabled() &&
+                   !migrated.areNotificationSoundsEnabled() && migrated.getTimeFormat() == "24h",
+                   "Version 1 values should be migrated");
+
+        std::remove(settingsFile.c_str());
+        std::cout << "✅ Driver profile tests passed" << std::endl;
+    }
+
+    void testHotReload() {
+        std::cout << "🧪 Testing settings hot-reload..." << std::endl;
+
+        std::ostringstream quiet;
+        std::streambuf* original = std::cout.rdbuf(quiet.rdbuf());
+        SystemSettings pushed(notificationManager);
+        pushed.saveSettings(settingsFile);
+
+        SystemSettings live(notificationManager);
+        live.loadSettings(settingsFile);
+        std::atomic<int> events(0);
+        std::atomic<SettingKeySet> lastChange(0);
+        std::atomic<bool> offMainThread(false);
+        const std::thread::id mainThread = std::this_thread::get_id();
+        live.subscribe({SettingKey::SYSTEM_VOLUME, SettingKey::THEME, SettingKey::TEMPERATURE_UNIT},
+                       [&](const SettingsChange& change) {
+            lastChange = change.changed;
+            offMainThread = std::this_thread::get_id() != mainThread;
+            ++events;
+        });
+        assertTrue(live.watchSettings(settingsFile), "Settings file should be watchable");
+
+        auto waitFor = [](const std::function<bool()>& done) {
+            for (int i = 0; i < 400 && !done(); ++i) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            return done();
+        };
+
+        // A replaced file is applied in the background with only its changed keys
+        pushed.setSystemVolume(65);
+        pushed.setTemperatureUnit("F");
+        pushed.saveSettings(settingsFile);
+        assertTrue(waitFor([&] { return events.load() > 0; }), "Pushed file should be applied");
+        std::cout.rdbuf(original);
+        assertTrue(live.getSystemVolume() == 65 && live.getTemperatureUnit() == "F",
+                   "Pushed values should be published");
+        assertTrue(events.load() == 1 && lastChange.load() == (settingBit(SettingKey::SYSTEM_VOLUME) |
+                                                               settingBit(SettingKey::TEMPERATURE_UNIT)),
+                   "One event should carry exactly the changed keys");
+        assertTrue(offMainThread.load(), "Reload should run off the main thread");
+
+        // A damaged push is rejected and the current settings stay
+        const int warningsBefore = notificationManager->getNotificationCount(AlertLevel::WARNING);
+        std::string contents;
+        readFileContents(settingsFile, contents);
+        contents[contents.size() / 2] ^= 0x5A;
+        writeFileContents(settingsFile, contents);
+        assertTrue(waitFor([&] { return notificationManager->getNotificationCount(AlertLevel::WARNING) > warningsBefore; }),
+                   "Damaged push should raise a warning");
+        assertTrue(live.getSystemVolume() == 65 && events.load() == 1, "Damaged push should change nothing");
+
+        live.stopWatching();
+        std::remove(settingsFile.c_str());
+        std::cout << "✅ Settings hot-reload tests passed" << std::endl;
+    }
+
+    void testSchema() {
+        std::cout << "🧪 Testing settings schema..." << std::endl;
+
+        // Defaults, validation and lookup all come from the table
+        const SettingsSnapshot base = defaultSettings();
+        for (const SettingSpec& spec : SETTINGS_SCHEMA) {
+            assertTrue(spec.get(base) == spec.defaultValue, std::string("Default should apply for ") + spec.id);
+            assertTrue(findSetting(spec.id) == &spec, std::string("Lookup should find ") + spec.id);
+        }
+        assertTrue(findSetting("warp_drive") == nullptr, "Unknown identifiers should not resolve");
+        static_assert(settingSpec(SettingKey::SYSTEM_VOLUME).maxValue == 100, "Rows resolve at compile time");
+
+        SettingsSnapshot broken = base;
+        broken.temperatureUnit = "K";
+        assertTrue(!isValidSettings(broken), "Unknown choices should be invalid");
+        assertTrue(diffSettings(base, broken) == settingBit(SettingKey::TEMPERATURE_UNIT),
+                   "Diff should report the changed key");
+
+        std::ostringstream output;
+        std::streambuf* original = std::cout.rdbuf(output.rdbuf());
+        SystemSettings generic(notificationManager);
+        const int warningsBefore = notificationManager->getNotificationCount(AlertLevel::WARNING);
+        assertTrue(generic.setValue(SettingKey::DISPLAY_BRIGHTNESS, 140), "Integers should be clamped, not rejected");
+        assertTrue(!generic.setValue(SettingKey::THEME, 7), "Out-of-range choices should be rejected");
+        generic.setTemperatureUnit("K");
+        generic.setLanguage(Language::GERMAN);
+        generic.displaySettings();
+        std::cout.rdbuf(original);
+
+        assertTrue(generic.getValue(SettingKey::DISPLAY_BRIGHTNESS) == 100, "Clamped value should be stored");
+        assertTrue(generic.getDisplayTheme() == DisplayTheme::AUTO && generic.getTemperatureUnit() == "C",
+                   "Rejected values should not be stored");
+        assertTrue(notificationManager->getNotificationCount(AlertLevel::WARNING) == warningsBefore + 2,
+                   "Each rejected value should raise a warning");
+        assertTrue(output.str().find("Language: Deutsch") != std::string::npos &&
+                   output.str().find("Brightness: 100%") != std::string::npos &&
+                   output.str().find("Temperature Unit: °C") != std::string::npos,
+                   "Settings screen should be generated from the schema");
+
+        std::cout << "✅ Settings schema tests passed" << std::endl;
+    }
+
+    void testSolarSchedule() {
+        std::cout << "🧪 Testing solar display scheduling..." << std::endl;
+
+        // Los Angeles, 2024-06-21: sunrise 05:42 PDT (12:42 UTC), sunset 20:08 PDT (03:08 UTC next day)
+        const int64_t midsummer = 1718928000;
+        const double lat = 34.0522;
+        const double lon = -118.2437;
+        const int64_t localNoon = midsummer + 20 * 3600;
+        const SunTimes la = SolarSchedule::compute(lat, lon, SolarSchedule::solarDay(lon, localNoon));
+        assertTrue(std::llabs(la.sunrise - (midsummer + 12 * 3600 + 42 * 60)) < 300, "Sunrise should be within 5 minutes");
+        assertTrue(std::llabs(la.sunset - (midsummer + 27 * 3600 + 8 * 60)) < 300, "Sunset should be within 5 minutes");
+        assertTrue(SolarSchedule::compute(69.65, 18.96, SolarSchedule::solarDay(18.96, midsummer)).polarDay,
+                   "Tromsø should have midnight sun in June");
+        assertTrue(SolarSchedule::compute(69.65, 18.96, SolarSchedule::solarDay(18.96, midsummer - 182 * 86400)).polarNight,
+                   "Tromsø should have polar night in December");
+
+        // Lookups within one day and cell reuse the cached times
+        SolarSchedule schedule;
+        for (int minute = 0; minute < 600; ++minute) {
+            schedule.daylightLevel(lat + minute * 1e-5, lon, localNoon + minute * 60);
+        }
+        assertTrue(schedule.getComputeCount() == 1, "Same day and cell should compute once");
+        assertTrue(schedule.daylightLevel(lat, lon, localNoon) == 1.0, "Noon should be full daylight");
+        assertTrue(schedule.daylightLevel(lat, lon, localNoon + 12 * 3600 - 3600) == 0.0, "Late night should be dark");
+        const double dusk = schedule.daylightLevel(lat, lon, la.sunset);
+        assertTrue(dusk > 0.3 && dusk < 0.7, "Sunset should be mid-ramp");
+        schedule.daylightLevel(lat + 1.0, lon, localNoon);
+        assertTrue(schedule.getComputeCount() == 2, "New cell should recompute");
+        schedule.daylightLevel(lat + 1.0, lon, localNoon + 86400);
+        assertTrue(schedule.getComputeCount() == 3, "New day should recompute");
+
+        // The scheduler drives night mode and brightness only under the AUTO theme
+        std::ostringstream quiet;
+        std::streambuf* original = std::cout.rdbuf(quiet.rdbuf());
+        auto autoSettings = std::make_shared<SystemSettings>(notificationManager);
+        auto gps = std::make_shared<GPSNavigator>(notificationManager);
+        gps->updateLocation(GPSCoordinate(lat, lon, 100.0));
+        gps->updateGPSSignal(8, 3.5);
+        DisplayScheduler scheduler(autoSettings, gps);
+        int batches = 0;
+        autoSettings->subscribe({SettingKey::NIGHT_MODE, SettingKey::DISPLAY_BRIGHTNESS},
+                                [&](const SettingsChange&) { ++batches; });
+
+        const bool nightApplied = scheduler.tick(localNoon + 12 * 3600);
+        const bool nightNightMode = autoSettings->isNightModeEnabled();
+        const int nightBrightness = autoSettings->getDisplayBrightness();
+        const bool repeated = scheduler.tick(localNoon + 12 * 3600 + 60);
+        const bool dayApplied = scheduler.tick(localNoon + 86400);
+        const bool dayNightMode = autoSettings->isNightModeEnabled();
+        autoSettings->setDisplayTheme(DisplayTheme::DARK);
+        const bool manualApplied = scheduler.tick(localNoon + 86400 + 12 * 3600);
+        std::cout.rdbuf(original);
+
+        assertTrue(nightApplied && nightNightMode && nightBrightness == DisplayScheduler::NIGHT_BRIGHTNESS,
+                   "Night should enable night mode at night brightness");
+        assertTrue(!repeated, "Unchanged conditions should not write settings");
+        assertTrue(dayApplied && !dayNightMode && autoSettings->getDisplayBrightness() == DisplayScheduler::DAY_BRIGHTNESS,
+                   "Day should restore day brightness");
+        assertTrue(batches == 2, "Each change should be one batched transaction");
+        assertTrue(autoSettings->getAuditLog().size() == 1 && autoSettings->getAuditLog()[0].key == SettingKey::THEME,
+                   "Scheduled changes should stay out of the undo history");
+        assertTrue(!manualApplied && !autoSettings->isNightModeEnabled(), "Manual themes should not be overridden");
+
+        std::cout << "✅ Solar display scheduling tests passed" << std::endl;
+    }
+
+    void testUndoHistory() {
+        std::cout << "🧪 Testing settings audit log and undo..." << std::endl;
+
+        SystemSettings edited(notificationManager);
+        int volumeEvents = 0;
+        edited.subscribe({SettingKey::SYSTEM_VOLUME}, [&volumeEvents](const SettingsChange&) { ++volumeEvents; });
+        edited.setSystemVolume(70);
+        edited.update([](SettingsSnapshot& s) {
+            s.displayBrightness = 40;
+            s.theme = DisplayTheme::DARK;
+        });
+        std::vector<SettingsAuditEntry> log = edited.getAuditLog();
+        assertTrue(log.size() == 3, "Each changed key should be recorded");
+        assertTrue(log[0].key == SettingKey::SYSTEM_VOLUME && log[0].oldValue == 50 && log[0].newValue == 70 &&
+                   log[0].timestamp > 0, "Entry should hold key, old and new value and time");
+        assertTrue(log[1].transaction == log[2].transaction && log[0].transaction != log[1].transaction,
+                   "One transaction should share a number");
+
+        assertTrue(edited.undo(), "Transaction should undo");
+        assertTrue(edited.getDisplayBrightness() == 75 && edited.getDisplayTheme() == DisplayTheme::AUTO &&
+                   edited.getSystemVolume() == 70, "Undo should revert the whole transaction only");
+        assertTrue(edited.undo() && edited.getSystemVolume() == 50 && volumeEvents == 2,
+                   "Undo should notify observers");
+        assertTrue(!edited.undo(), "Nothing should be left to undo");
+        assertTrue(edited.redo() && edited.getSystemVolume() == 70, "Redo should reapply");
+        edited.setVoiceGuidance(false);
+        assertTrue(!edited.redo(), "A new change should discard redo entries");
+
+        edited.resetToDefaults();
+        assertTrue(edited.getSystemVolume() == 50 && edited.undo() && edited.getSystemVolume() == 70 &&
+                   !edited.isVoiceGuidanceEnabled(), "Reset to defaults should be undoable");
+
+        // The history keeps constant memory and drops whole transactions
+        for (int i = 0; i < 1000; ++i) edited.setSystemVolume(i % 2 == 0 ? 20 : 30);
+        assertTrue(edited.getAuditLog().size() == SettingsHistory::CAPACITY, "History should stay bounded");
+        int undone = 0;
+        while (edited.undo()) ++undone;
+        assertTrue(undone == static_cast<int>(SettingsHistory::CAPACITY), "Every kept transaction should undo");
+
+        // Undoable entries round-trip through the settings file when enabled
+        edited.setSystemVolume(60);
+        edited.setLanguage(Language::FRENCH);
+        edited.setHistoryPersistence(true);
+        assertTrue(edited.saveSettings(settingsFile), "Settings with history should save");
+        SystemSettings restored(notificationManager);
+        assertTrue(restored.loadSettings(settingsFile), "Settings with history should load");
+        assertTrue(restored.getAuditLog().size() == 2 && restored.undo() &&
+                   restored.getLanguage() == Language::ENGLISH && restored.getSystemVolume() == 60,
+                   "Saved history should be undoable after loading");
+        edited.setHistoryPersistence(false);
+        assertTrue(edited.saveSettings(settingsFile) && restored.loadSettings(settingsFile) &&
+                   restored.getAuditLog().empty(), "History should not be saved when persistence is off");
+
+        // Each profile undoes only its own changes
+        SystemSettings shared(notificationManager);
+        shared.createProfile("Bob");
+        shared.switchProfile("Bob");
+        shared.setSystemVolume(90);
+        shared.switchProfile(SystemSettings::DEFAULT_PROFILE);
+        shared.setSystemVolume(20);
+        shared.switchProfile("Bob");
+        assertTrue(shared.getAuditLog().size() == 1 && shared.undo() && shared.getSystemVolume() == 50,
+                   "Undo should revert the active profile's own change");
+        assertTrue(!shared.undo(), "Another profile's changes should not be undoable");
+        shared.switchProfile(SystemSettings::DEFAULT_PROFILE);
+        assertTrue(shared.getSystemVolume() == 20 && shared.undo() && shared.getSystemVolume() == 50,
+                   "A profile's history should survive switching away and back");
+
+        // A pushed file is its own transaction; undo never skips past it
+        SystemSettings driver(notificationManager);
+        SystemSettings pusher(notificationManager);
+        driver.setSystemVolume(70);
+        pusher.setSystemVolume(30);
+        pusher.saveSettings(settingsFile);
+        std::ostringstream quiet;
+        std::streambuf* original = std::cout.rdbuf(quiet.rdbuf());
+        const bool reloaded = driver.reloadSettings(settingsFile);
+        std::cout.rdbuf(original);
+        log = driver.getAuditLog();
+        assertTrue(reloaded && log.size() == 2 && log[1].key == SettingKey::SYSTEM_VOLUME && log[1].oldValue == 70 &&
+                   log[1].newValue == 30, "Pushed changes should be audited");
+        assertTrue(driver.undo() && driver.getSystemVolume() == 70, "Undo should revert the push first");
+        assertTrue(driver.undo() && driver.getSystemVolume() == 50, "Then the driver's own change");
+
+        // Entries whose setting changed outside the history are skipped
+        driver.setSystemVolume(70);
+        driver.setDisplayTheme(DisplayTheme::DARK);
+        driver.applyAutomatic([](SettingsSnapshot& s) { s.systemVolume = 30; });
+        assertTrue(driver.undo() && driver.getDisplayTheme() == DisplayTheme::AUTO, "Undo should revert the theme");
+        assertTrue(!driver.undo() && driver.getSystemVolume() == 30, "Undo should not overwrite an unrecorded change");
+
+        std::remove(settingsFile.c_str());
+        std::cout << "✅ Settings audit log and undo tests passed" << std::endl;
+    }
+
+    void testTextImportExport() {
+        std::cout << "🧪 Testing settings text import/export..." << std::endl;
+
+        std::ostringstream quiet;
+        std::streambuf* original = std::cout.rdbuf(quiet.rdbuf());
+
+        SystemSettings fleet(notificationManager);
+        fleet.createProfile("Alice");
+        fleet.createProfile("Bob [night]");
+        fleet.switchProfile("Alice");
+        configureNonDefaults(fleet);
+        fleet.switchProfile("Bob [night]");
+        fleet.setLanguage(Language::JAPANESE);
+        fleet.setNightMode(true);
+
+        // Text and binary forms round-trip exactly
+        std::string text;
+        std::string binary;
+        assertTrue(fleet.exportSettingsText(text), "Settings should export as text");
+        assertTrue(fleet.saveSettings(settingsFile) && readFileContents(settingsFile, binary), "Settings should save");
+        SystemSettings imported(notificationManager);
+        SettingsTextError error{0, 0, nullptr};
+        assertTrue(imported.importSettingsText(text, error), "Exported text should import");
+        std::string reimported;
+        assertTrue(imported.saveSettings(settingsFile) && readFileContents(settingsFile, reimported),
+                   "Imported settings should save");
+        assertTrue(reimported == binary, "Imported text should produce the same binary file");
+        assertTrue(imported.getActiveProfile() == "Bob [night]" && imported.getLanguage() == Language::JAPANESE,
+                   "Active profile should be restored");
+
+        // Hand-written text: comments, CRLF, BOM, any case, defaults for missing keys
+        const std::string handWritten = "\xEF\xBB\xBF# provisioning\r\n; fleet\r\n\r\n"
+                                        "[Carol]\r\n  theme = dark  \r\nsystem_volume=35\r\n"
+                                        "[Dave]\r\nvoice_guidance = off\r\n";
+        assertTrue(imported.importSettingsText(handWritten, error), "Hand-written text should import");
+        assertTrue(imported.getProfileNames() == std::vector<std::string>({"Carol", "Dave"}) &&
+                   imported.getActiveProfile() == "Carol", "First profile should be active by default");
+        assertTrue(imported.getDisplayTheme() == DisplayTheme::DARK && imported.getSystemVolume() == 35 &&
+                   imported.getLanguage() == Language::ENGLISH, "Listed values should apply, others default");
+
+        // Errors carry line and column, and leave settings untouched
+        struct BadText {
+            const char* text;
+            size_t line;
+            size_t column;
+        };
+        const BadText badTexts[] = {
+            {"[Alice]\nsystem_volume = 101\n", 2, 17},
+            {"[Alice]\n\n  brightness = 10\n", 3, 3},
+            {"[Alice]\ntheme = Purple\n", 2, 9},
+            {"system_volume = 5\n[Alice]\n", 1, 1},
+            {"[Alice\n", 1, 7},
+            {"[Alice]\nnight_mode\n", 2, 1},
+            {"[Alice]\nnight_mode =\n", 2, 13},
+            {"[Alice]\n[Alice]\n", 2, 2},
+            {"active_profile = Zed\n[Alice]\n", 1, 18},
+            {"# nothing here\n", 1, 1},
+        };
+        for (const BadText& bad : badTexts) {
+            error = SettingsTextError{0, 0, nullptr};
+            assertTrue(!imported.importSettingsText(bad.text, error), std::string("Should reject: ") + bad.text);
+            assertTrue(error.line == bad.line && error.column == bad.column && error.message != nullptr,
+                       std::string("Error position for: ") + bad.text + " got " + std::to_string(error.line) +
+                       ":" + std::to_string(error.column));
+        }
+        assertTrue(imported.getActiveProfile() == "Carol" && imported.getSystemVolume() == 35,
+                   "Rejected text should not change settings");
+
+        const int warnings = notificationManager->getNotificationCount(AlertLevel::WARNING);
+        writeFileContents(settingsFile, "[Alice]\nvolume = 1\n");
+        assertTrue(!imported.importSettings(settingsFile) &&
+                   notificationManager->getNotificationCount(AlertLevel::WARNING) == warnings + 1,
+                   "Rejected file should raise a warning");
+
+        std::cout.rdbuf(original);
+        std::remove(settingsFile.c_str());
+        std::cout << "✅ Settings text import/export tests passed" << std::endl;
+    }
+
+    void runAllTests() {
+        std::cout << "\n🧪 === RUNNING SYSTEM SETTINGS TESTS ===" << std::endl;
+        std::cout << std::string(45, '=') << std::endl;
+
+        testSaveAndLoad();
+        testMissingFile();
+        testCorruptionFallsBackToDefaults();
+        testSnapshotReads();
+        testChangeObservers();
+        testProfiles();
+        testHotReload();
+        testSchema();
+        testSolarSchedule();
+        testUndoHistory();
+        testTextImportExport();
+
+        std::cout << std::string(45, '=') << std::endl;
+        std::cout << "🎉 All System Settings tests passed!" << std::endl;
+    }
+};
+
+int main() {
+    try {
+        SystemSettingsTest test;
+        test.runAllTests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+}
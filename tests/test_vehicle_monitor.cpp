@@ -5,6 +5,8 @@
 
 #include "VehicleMonitor.h"
 #include "NotificationManager.h"
+#include "CanDecoder.h"
+#include "VehicleDataFeed.h"
 #include <iostream>
 #include <cassert>
 #include <memory>
@@ -161,9 +163,71 @@ public:
         // Should have at least one notification (system check completed)
         assertTrue(notificationManager->getNotificationCount() > 0, "System check should generate notifications");
         
+        // A sensor that stays out of range alerts once per change of severity
+        notificationManager->clearNotifications();
+        for (int i = 0; i < 10; ++i) monitor->setFuelLevel(12.0 - i * 0.1);
+        assertTrue(notificationManager->getNotificationCount() == 1, "Low fuel should alert once while it stays low");
+        monitor->setFuelLevel(4.0);
+        assertTrue(notificationManager->getNotificationCount() == 2, "Reaching critical fuel should alert again");
+        monitor->setFuelLevel(75.0);
+        monitor->setFuelLevel(12.0);
+        assertTrue(notificationManager->getNotificationCount() == 3, "Falling low again after a refill should alert");
+        notificationManager->clearNotifications();
+        monitor->performSystemCheck();
+        assertTrue(notificationManager->getNotificationCount(AlertLevel::WARNING) == 1,
+                   "System check should report conditions already announced");
+        monitor->setFuelLevel(75.0);
+        
         std::cout << "✅ System check tests passed" << std::endl;
     }
     
+    void testCanDecoding() {
+        std::cout << "🧪 Testing CAN OBD-II decoding..." << std::endl;
+        CanFrame frame;
+        double value = 0.0;
+
+        // The three candump spellings of one speed response (0x48 = 72 km/h)
+        assertTrue(CanDecoder::parseCandump("(1700000000.123456) can0 7E8#03410D48", frame), "Log format should parse");
+        assertTrue(frame.id == 0x7E8 && frame.length == 4 && frame.data[3] == 0x48, "Log frame fields should be read");
+        assertTrue(CanDecoder::decode(frame, value) == CanSignal::SPEED, "PID 0D should decode as speed");
+        assertEqual(72.0, value);
+        assertTrue(CanDecoder::parseCandump("  can0  7E8   [4]  03 41 0D 48", frame) && frame.data[3] == 0x48,
+                   "Default candump format should parse");
+        assertTrue(CanDecoder::parseCandump("7E8#03410D48", frame) && frame.length == 4, "cansend syntax should parse");
+
+        assertTrue(CanDecoder::parseCandump("can0 7E9#03410582", frame) &&
+                   CanDecoder::decode(frame, value) == CanSignal::ENGINE_TEMP, "PID 05 should decode as coolant");
+        assertEqual(90.0, value);
+        assertTrue(CanDecoder::parseCandump("can0 7E8#03412F80", frame) &&
+                   CanDecoder::decode(frame, value) == CanSignal::FUEL_LEVEL, "PID 2F should decode as fuel level");
+        assertEqual(128.0 * 100.0 / 255.0, value);
+        assertTrue(CanDecoder::parseCandump("can0 7E8#04415E00C8", frame) &&
+                   CanDecoder::decode(frame, value) == CanSignal::FUEL_RATE, "PID 5E should decode as fuel rate");
+        assertEqual(10.0, value);
+
+        // Unrelated traffic parses but carries nothing we track
+        assertTrue(CanDecoder::parseCandump("can0 123#DEADBEEF", frame) &&
+                   CanDecoder::decode(frame, value) == CanSignal::NONE, "Non-OBD frame should decode as NONE");
+        assertTrue(!CanDecoder::parseCandump("can0 7E8#0341G", frame), "Malformed payload should be rejected");
+        assertTrue(!CanDecoder::parseCandump("can0 7E8 [9] 00", frame), "Oversized length should be rejected");
+
+        // The feed applies decoded signals to the monitor
+        auto gps = std::make_shared<GPSNavigator>(notificationManager);
+        VehicleDataFeed feed(monitor, gps);
+        assertTrue(feed.apply(FeedFormat::CAN, "(1.0) can0 7E8#03410D48") &&
+                   feed.apply(FeedFormat::CAN, "(1.1) can0 7E8#04415E00C8") &&
+                   feed.apply(FeedFormat::CAN, "(1.2) can0 7E8#03410582"), "Feed should apply CAN lines");
+        assertEqual(72.0, monitor->getCurrentSpeed());
+        assertEqual(90.0, monitor->getEngineTemperature());
+        assertEqual(10.0 / 72.0 * 100.0, monitor->getFuelConsumptionRate());
+        assertTrue(feed.apply(FeedFormat::TELEMETRY, "brake_wear 55") && !feed.apply(FeedFormat::TELEMETRY, "brake_wear x"),
+                   "Telemetry lines should be applied or rejected");
+        assertEqual(55.0, monitor->getBrakeWearLevel());
+        monitor->setFuelConsumptionRate(8.5);
+
+        std::cout << "✅ CAN decoding tests passed" << std::endl;
+    }
+    
     void runAllTests() {
         std::cout << "\n🧪 === RUNNING VEHICLE MONITOR TESTS ===" << std::endl;
         std::cout << std::string(45, '=') << std::endl;
@@ -174,6 +238,7 @@ public:
         testBrakeWearMonitoring();
         testFuelConsumptionAndRange();
         testSystemCheck();
+        testCanDecoding();
         
         std::cout << std::string(45, '=') << std::endl;
         std::cout << "🎉 All Vehicle Monitor tests passed!" << std::endl;